@@ -0,0 +1,10 @@
+uniform float bloomIntensity;
+
+uniform sampler2D blurMap;
+
+vec3 CalcBloomAccumulation (vec3 in_diffuse, vec2 texCoord)
+{
+	vec3 in_blur = texture2D (blurMap, texCoord).xyz;
+
+	return in_diffuse + in_blur * bloomIntensity;
+}
@@ -19,9 +19,6 @@ uniform vec3 cameraPosition;
 
 uniform vec2 screenSize;
 
-uniform float bloomIntensity;
-
-uniform sampler2D blurMap;
 uniform sampler2D postProcessMap;
 
 vec2 CalcTexCoord()
@@ -29,11 +26,12 @@ vec2 CalcTexCoord()
 	return gl_FragCoord.xy / screenSize;
 }
 
+#include "Bloom/bloomAccumulation.glsl"
+
 void main ()
 {
 	vec2 texCoord = CalcTexCoord();
 	vec3 in_diffuse = texture2D (postProcessMap, texCoord).xyz;
-	vec3 in_blur = texture2D (blurMap, texCoord).xyz;
 
-	out_color = in_diffuse + in_blur * bloomIntensity;
+	out_color = CalcBloomAccumulation (in_diffuse, texCoord);
 }
@@ -0,0 +1,80 @@
+#version 430
+
+/*
+ * Separable gaussian blur along one direction. Each work group loads a
+ * segment of a row (or column) of the source, with the kernel apron,
+ * in shared memory once, then every invocation applies the kernel from
+ * shared memory instead of sampling the source once per tap.
+*/
+
+#pragma keywords BLUR_RADIUS BLUR_WEIGHTS BLUR_FORMAT
+
+/*
+ * Kernel center and one side weights, the same as the fragment backend
+*/
+
+#ifndef BLUR_RADIUS
+	#define BLUR_RADIUS 4
+	#define BLUR_WEIGHTS 0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216
+#endif
+
+#ifndef BLUR_FORMAT
+	#define BLUR_FORMAT rgba16f
+#endif
+
+#define TILE_SIZE 128
+
+layout (local_size_x = TILE_SIZE) in;
+
+uniform sampler2D blurMap;
+
+uniform ivec2 blurDirection;
+
+layout (binding = 0, BLUR_FORMAT) uniform writeonly image2D blurImage;
+
+shared vec3 tile [TILE_SIZE + 2 * BLUR_RADIUS];
+
+void main()
+{
+	ivec2 size = imageSize (blurImage);
+	vec2 texelSize = vec2 (1.0) / vec2 (size);
+
+	int localIndex = int (gl_LocalInvocationID.x);
+	int tileStart = int (gl_WorkGroupID.x) * TILE_SIZE - BLUR_RADIUS;
+
+	/*
+	 * Work groups go along the blur direction, one line after another
+	*/
+
+	ivec2 lineStart = blurDirection.x == 1 ? ivec2 (0, gl_WorkGroupID.y) : ivec2 (gl_WorkGroupID.y, 0);
+
+	/*
+	 * Load the segment with its apron, clamped to the edge by the sampler
+	*/
+
+	for (int index = localIndex; index < TILE_SIZE + 2 * BLUR_RADIUS; index += TILE_SIZE) {
+		vec2 texCoord = (vec2 (lineStart + blurDirection * (tileStart + index)) + 0.5) * texelSize;
+
+		tile [index] = textureLod (blurMap, texCoord, 0).xyz;
+	}
+
+	memoryBarrierShared ();
+	barrier ();
+
+	ivec2 pixel = lineStart + blurDirection * (tileStart + BLUR_RADIUS + localIndex);
+
+	if (any (greaterThanEqual (pixel, size))) {
+		return;
+	}
+
+	const float weight [BLUR_RADIUS + 1] = float[] (BLUR_WEIGHTS);
+
+	vec3 color = tile [localIndex + BLUR_RADIUS] * weight [0];
+
+	for (int i = 1; i <= BLUR_RADIUS; i++) {
+		color += tile [localIndex + BLUR_RADIUS + i] * weight [i];
+		color += tile [localIndex + BLUR_RADIUS - i] * weight [i];
+	}
+
+	imageStore (blurImage, pixel, vec4 (color, 1.0));
+}
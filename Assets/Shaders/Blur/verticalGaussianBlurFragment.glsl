@@ -1,5 +1,16 @@
 #version 330 core
 
+/*
+ * Kernel center and one side weights, the same as the compute backend
+*/
+
+#pragma keywords BLUR_RADIUS BLUR_WEIGHTS
+
+#ifndef BLUR_RADIUS
+	#define BLUR_RADIUS 4
+	#define BLUR_WEIGHTS 0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216
+#endif
+
 layout(location = 0) out vec3 out_color;
 
 uniform mat4 modelMatrix;
@@ -23,13 +34,13 @@ vec2 CalcTexCoord()
 
 vec3 CalcBlur (vec2 texCoord)
 {
-	const float weight [5] = float[] (0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+	const float weight [BLUR_RADIUS + 1] = float[] (BLUR_WEIGHTS);
 
 	vec3 color = texture (blurMap, texCoord).xyz * weight [0];
 
 	vec2 texelSize = vec2 (1.0f) / blurMapResolution;
 
-	for (int i = 1; i < 5; ++i) {
+	for (int i = 1; i <= BLUR_RADIUS; ++i) {
 		color += texture (blurMap, texCoord + vec2 (0.0f, texelSize.y * i)).rgb * weight [i];
 		color += texture (blurMap, texCoord - vec2 (0.0f, texelSize.y * i)).rgb * weight [i];
 	}
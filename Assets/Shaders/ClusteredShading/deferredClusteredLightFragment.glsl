@@ -0,0 +1,123 @@
+#version 430
+
+layout(location = 0) out vec3 out_color;
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 modelViewMatrix;
+uniform mat4 modelViewProjectionMatrix;
+uniform mat3 normalMatrix;
+uniform mat3 normalWorldMatrix;
+
+uniform vec3 cameraPosition;
+uniform vec2 cameraZLimits;
+
+uniform ivec3 clusterGridSize;
+
+#define CLUSTERED_LIGHT_SPOT 1
+
+struct ClusteredLight
+{
+	vec4 positionRange;
+	vec4 colorIntensity;
+	vec4 directionType;
+	vec4 spotCutoffs;
+};
+
+layout (std430, binding = 0) readonly buffer clusteredLights
+{
+	ClusteredLight lights [];
+};
+
+layout (std430, binding = 1) readonly buffer lightClusters
+{
+	uvec2 clusters [];
+};
+
+layout (std430, binding = 2) readonly buffer clusteredLightIndices
+{
+	uint lightIndices [];
+};
+
+#include "deferred.glsl"
+
+vec3 CalcClusteredLight (ClusteredLight light, vec3 in_position, vec3 in_normal, vec3 in_diffuse, vec3 in_specular, float in_shininess)
+{
+	vec3 lightPosition = light.positionRange.xyz;
+	float lightRange = light.positionRange.w;
+
+	// Vector direction from fragment to light source
+	vec3 lightDir = lightPosition - in_position;
+
+	// Distance from fragment to light source
+	float dist2 = dot (lightDir, lightDir);
+
+	if (dist2 > lightRange * lightRange) {
+		return vec3 (0.0);
+	}
+
+	// Normalize light direction
+	lightDir = normalize (lightDir);
+
+	// Compute point light attenuation over distance
+	float attenuation = pow (clamp (1.0 - pow (dist2 / (lightRange * lightRange), 2), 0.0, 1.0), 2);
+
+	// Compute spot light attenuation over angle
+	if (int (light.directionType.w) == CLUSTERED_LIGHT_SPOT) {
+		float theta = dot (lightDir, normalize (-light.directionType.xyz));
+		float epsilon = light.spotCutoffs.x - light.spotCutoffs.y;
+		attenuation *= clamp ((theta - light.spotCutoffs.y) / epsilon, 0.0, 1.0);
+	}
+
+	// Diffuse light intensity
+	float diffuseLightIntensity = max (dot (in_normal, lightDir), 0.0);
+
+	// Compute diffuse color
+	vec3 diffuseColor = light.colorIntensity.rgb * in_diffuse * diffuseLightIntensity * attenuation;
+
+	// Vector from fragment to camera position
+	vec3 surface2view = normalize (-in_position);
+	vec3 reflection = reflect (-lightDir, in_normal);
+
+	// Specular light intensity
+	float specularLightIntensity = pow (max (dot (surface2view, reflection), 0.0), in_shininess);
+
+	// Compute specular color
+	vec3 specularColor = light.colorIntensity.rgb * in_specular * specularLightIntensity * attenuation;
+
+	return (diffuseColor + specularColor) * light.colorIntensity.w;
+}
+
+int CalcClusterIndex (vec2 texCoord, vec3 in_position)
+{
+	ivec2 tile = clamp (ivec2 (texCoord * vec2 (clusterGridSize.xy)), ivec2 (0), clusterGridSize.xy - 1);
+
+	// Slices are distributed exponentially between near and far planes
+	float depth = max (-in_position.z, cameraZLimits.x);
+	int slice = int (log (depth / cameraZLimits.x) / log (cameraZLimits.y / cameraZLimits.x) * clusterGridSize.z);
+	slice = clamp (slice, 0, clusterGridSize.z - 1);
+
+	return tile.x + clusterGridSize.x * (tile.y + clusterGridSize.y * slice);
+}
+
+void main()
+{
+	vec2 texCoord = CalcTexCoord();
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_diffuse = textureLod (gDiffuseMap, texCoord, 0).xyz;
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
+	vec3 in_specular = textureLod (gSpecularMap, texCoord, 0).xyz;
+	float in_shininess = GBufferShininess (gNormalMap, gSpecularMap, texCoord, 0);
+
+	in_normal = normalize(in_normal);
+
+	uvec2 cluster = clusters [CalcClusterIndex (texCoord, in_position)];
+
+	vec3 color = vec3 (0.0);
+
+	for (uint index = cluster.x; index < cluster.x + cluster.y; index ++) {
+		color += CalcClusteredLight (lights [lightIndices [index]], in_position, in_normal, in_diffuse, in_specular, in_shininess);
+	}
+
+	out_color = color;
+}
@@ -0,0 +1,8 @@
+vec3 CalcGammaCorrection (vec3 in_diffuse)
+{
+	float gamma = 2.2;
+
+	vec3 color = pow (in_diffuse, vec3 (1.0 / gamma));
+
+	return color;
+}
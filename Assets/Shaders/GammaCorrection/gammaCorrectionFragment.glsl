@@ -27,14 +27,7 @@ vec2 CalcTexCoord()
 	return gl_FragCoord.xy / screenSize;
 }
 
-vec3 CalcGammaCorrection (vec3 in_diffuse)
-{
-	float gamma = 2.2;
-
-	vec3 color = pow (in_diffuse, vec3 (1.0 / gamma));
-
-	return color;
-}
+#include "GammaCorrection/gammaCorrection.glsl"
 
 void main ()
 {
@@ -0,0 +1,18 @@
+uniform float exposure;
+
+vec3 ReinhardToneMapping (const vec3 color)
+{
+	return color / (color + vec3 (1.0));
+}
+
+vec3 ExposureToneMapping (vec3 color)
+{
+	vec3 ldrColor = vec3 (1.0) - exp (-color * exposure);
+
+	return ldrColor;
+}
+
+vec3 CalcHighDynamicRange (vec3 in_diffuse)
+{
+	return ExposureToneMapping (in_diffuse);
+}
@@ -19,8 +19,6 @@ uniform vec3 cameraPosition;
 
 uniform vec2 screenSize;
 
-uniform float exposure;
-
 uniform sampler2D postProcessMap;
 
 vec2 CalcTexCoord()
@@ -28,22 +26,7 @@ vec2 CalcTexCoord()
 	return gl_FragCoord.xy / screenSize;
 }
 
-vec3 ReinhardToneMapping (const vec3 color)
-{
-	return color / (color + vec3 (1.0));
-}
-
-vec3 ExposureToneMapping (vec3 color)
-{
-	vec3 ldrColor = vec3 (1.0) - exp (-color * exposure);
-
-	return ldrColor;
-}
-
-vec3 CalcHighDynamicRange (vec3 in_diffuse)
-{
-	return ExposureToneMapping (in_diffuse);
-}
+#include "HighDynamicRange/highDynamicRange.glsl"
 
 void main ()
 {
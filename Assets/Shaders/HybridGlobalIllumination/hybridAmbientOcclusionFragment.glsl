@@ -66,7 +66,7 @@ float CalcScreenSpaceAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 te
 			continue;
 		}
 
-		vec3 samplePos = textureLod (gPositionMap, offset.xy, 0).xyz;
+		vec3 samplePos = GBufferPosition (gPositionMap, gDepthMap, offset.xy, 0);
 
 		float rangeCheck = smoothstep (0.0, 1.0, ssaoRadius / abs (in_position.z - samplePos.z));
 
@@ -112,8 +112,8 @@ float CalcAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 texCoord)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
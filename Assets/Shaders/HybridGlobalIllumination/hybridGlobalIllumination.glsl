@@ -94,7 +94,7 @@ vec3 CalcHGIIndirectDiffuseLight (in vec3 in_position, in vec3 in_normal)
 			continue;
 		}
 
-		vec3 samplePos = textureLod (gPositionMap, offset.xy, 0).xyz;
+		vec3 samplePos = GBufferPosition (gPositionMap, gDepthMap, offset.xy, 0);
 
 		float sampleDistance = distance (in_position, samplePos);
 
@@ -102,7 +102,7 @@ vec3 CalcHGIIndirectDiffuseLight (in vec3 in_position, in vec3 in_normal)
 			continue;
 		}
 
-		vec3 sampleNormal = textureLod (gNormalMap, offset.xy, 0).xyz;
+		vec3 sampleNormal = GBufferNormal (gNormalMap, offset.xy, 0);
 		vec3 sampleDiffuse = texture2D (directLightMap, offset.xy).xyz;
 
 		sampleNormal = normalize (sampleNormal);
@@ -87,7 +87,7 @@ vec3 CalcSSRIndirectSpecularLight (in vec3 in_position, in vec3 in_normal,
 
 	vec3 reflectionDirection = normalize (reflect (normalize (in_position), in_normal));
 
-	vec3 reflectionViewPos = textureLod (gPositionMap, reflectionPos, 0).xyz;
+	vec3 reflectionViewPos = GBufferPosition (gPositionMap, gDepthMap, reflectionPos, 0);
 	float d = distance (reflectionViewPos, in_position);
 
 	return (reflectionColor * screenEdgeFade *
@@ -124,8 +124,8 @@ vec3 CalcIndirectSpecularLight (vec3 in_position, vec3 in_normal, vec2 texCoord)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -109,8 +109,8 @@ vec3 CalcAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 texCoord)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
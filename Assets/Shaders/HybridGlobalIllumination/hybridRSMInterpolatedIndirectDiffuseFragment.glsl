@@ -29,8 +29,8 @@ vec2 CalcTexCoordHGI ()
 void main()
 {
 	vec2 texCoord = CalcTexCoordHGI();
-	vec3 in_position = textureLod (gPositionMap, texCoord, log2 (1.0 / hgiInterpolationScale)).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, log2 (1.0 / hgiInterpolationScale)).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / hgiInterpolationScale));
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / hgiInterpolationScale));
 
 	in_normal = normalize(in_normal);
 
@@ -23,6 +23,7 @@ uniform int hgiDebugInterpolation;
 uniform sampler2D ssdoIndirectDiffuseMap;
 
 #include "HybridGlobalIllumination/hybridGlobalIllumination.glsl"
+#include "TemporalFiltering/amortization.glsl"
 
 vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec2 texCoord)
 {
@@ -32,8 +33,8 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 
 	vec3 indirectDiffuseLight = vec3 (0);
 
-	vec3 interpolatedPosition = textureLod (gPositionMap, texCoord, log2 (1.0 / hgiInterpolationScale)).xyz;
-	vec3 interpolatedNormal = textureLod (gNormalMap, texCoord, log2 (1.0 / hgiInterpolationScale)).xyz;
+	vec3 interpolatedPosition = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / hgiInterpolationScale));
+	vec3 interpolatedNormal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / hgiInterpolationScale));
 
 	if (distance (interpolatedPosition, in_position) < hgiMinInterpolationDistance
 		&& dot (interpolatedNormal, in_normal) > hgiMinInterpolationAngle) {
@@ -52,8 +53,16 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+
+#ifdef AMORTIZED
+	if (IsAmortizedPixelSkipped ()) {
+		out_color = CalcAmortizedHistory (in_position, texCoord);
+		return;
+	}
+#endif
+
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -0,0 +1,147 @@
+/*
+ * Camera following cascades of light propagation volumes. Fragments
+ * sample the finest cascade that holds them. Cascades above the first
+ * one have their index appended to the uniform names.
+*/
+
+#pragma keywords LPV_CASCADES
+
+#ifndef LPV_CASCADES
+	#define LPV_CASCADES 1
+#endif
+
+uniform sampler3D volumeTextureR;
+uniform sampler3D volumeTextureG;
+uniform sampler3D volumeTextureB;
+uniform vec3 minVertex;
+uniform vec3 maxVertex;
+
+#if LPV_CASCADES > 1
+	uniform sampler3D volumeTextureR1;
+	uniform sampler3D volumeTextureG1;
+	uniform sampler3D volumeTextureB1;
+	uniform vec3 minVertex1;
+	uniform vec3 maxVertex1;
+#endif
+
+#if LPV_CASCADES > 2
+	uniform sampler3D volumeTextureR2;
+	uniform sampler3D volumeTextureG2;
+	uniform sampler3D volumeTextureB2;
+	uniform vec3 minVertex2;
+	uniform vec3 maxVertex2;
+#endif
+
+int lpvCascade = 0;
+
+vec3 GetCascadeMinVertex ()
+{
+#if LPV_CASCADES > 2
+	if (lpvCascade == 2) {
+		return minVertex2;
+	}
+#endif
+
+#if LPV_CASCADES > 1
+	if (lpvCascade == 1) {
+		return minVertex1;
+	}
+#endif
+
+	return minVertex;
+}
+
+vec3 GetCascadeMaxVertex ()
+{
+#if LPV_CASCADES > 2
+	if (lpvCascade == 2) {
+		return maxVertex2;
+	}
+#endif
+
+#if LPV_CASCADES > 1
+	if (lpvCascade == 1) {
+		return maxVertex1;
+	}
+#endif
+
+	return maxVertex;
+}
+
+bool IsInsideCascade (vec3 origin, vec3 cascadeMinVertex, vec3 cascadeMaxVertex)
+{
+	/*
+	 * Keep a border, so the filtering near the edge of a finer cascade
+	 * does not fade to black
+	*/
+
+	vec3 border = (cascadeMaxVertex - cascadeMinVertex) / 16.0;
+
+	return all (greaterThan (origin, cascadeMinVertex + border)) &&
+		all (lessThan (origin, cascadeMaxVertex - border));
+}
+
+void SelectLightPropagationVolume (vec3 origin)
+{
+	lpvCascade = LPV_CASCADES - 1;
+
+#if LPV_CASCADES > 2
+	if (IsInsideCascade (origin, minVertex1, maxVertex1)) {
+		lpvCascade = 1;
+	}
+#endif
+
+#if LPV_CASCADES > 1
+	if (IsInsideCascade (origin, minVertex, maxVertex)) {
+		lpvCascade = 0;
+	}
+#endif
+}
+
+float GetInterpolatedComp (float comp, float minValue, float maxValue)
+{
+	return ((comp - minValue) / (maxValue - minValue));
+}
+
+vec3 GetPositionInVolume (vec3 origin)
+{
+	vec3 cascadeMinVertex = GetCascadeMinVertex ();
+	vec3 cascadeMaxVertex = GetCascadeMaxVertex ();
+
+	vec3 positionInVolume;
+
+	positionInVolume.x = GetInterpolatedComp (origin.x, cascadeMinVertex.x, cascadeMaxVertex.x);
+	positionInVolume.y = GetInterpolatedComp (origin.y, cascadeMinVertex.y, cascadeMaxVertex.y);
+	positionInVolume.z = GetInterpolatedComp (origin.z, cascadeMinVertex.z, cascadeMaxVertex.z);
+
+	return positionInVolume;
+}
+
+vec3 SampleLightPropagationVolume (vec4 SHintensity, vec3 volumePos)
+{
+#if LPV_CASCADES > 2
+	if (lpvCascade == 2) {
+		return vec3 (
+			dot (SHintensity, texture (volumeTextureR2, volumePos)),
+			dot (SHintensity, texture (volumeTextureG2, volumePos)),
+			dot (SHintensity, texture (volumeTextureB2, volumePos))
+		);
+	}
+#endif
+
+#if LPV_CASCADES > 1
+	if (lpvCascade == 1) {
+		return vec3 (
+			dot (SHintensity, texture (volumeTextureR1, volumePos)),
+			dot (SHintensity, texture (volumeTextureG1, volumePos)),
+			dot (SHintensity, texture (volumeTextureB1, volumePos))
+		);
+	}
+#endif
+
+	return vec3 (
+		dot (SHintensity, texture (volumeTextureR, volumePos)),
+		dot (SHintensity, texture (volumeTextureG, volumePos)),
+		dot (SHintensity, texture (volumeTextureB, volumePos))
+	);
+}
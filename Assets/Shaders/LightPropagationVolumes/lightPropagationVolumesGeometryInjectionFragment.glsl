@@ -91,8 +91,8 @@ void GeometryInjection (vec3 in_position, vec3 in_normal)
 void main ()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	GeometryInjection (in_position, in_normal);
 }
@@ -15,31 +15,12 @@ uniform mat3 inverseNormalWorldMatrix;
 
 uniform vec3 cameraPosition;
 
-uniform sampler3D volumeTextureR;
-uniform sampler3D volumeTextureG;
-uniform sampler3D volumeTextureB;
-uniform vec3 minVertex;
-uniform vec3 maxVertex;
 
 uniform float lpvIntensity;
 
 #include "deferred.glsl"
 
-float GetInterpolatedComp (float comp, float minValue, float maxValue)
-{
-	return ((comp - minValue) / (maxValue - minValue));
-}
-
-vec3 GetPositionInVolume (vec3 origin)
-{
-	vec3 positionInVolume;
-
-	positionInVolume.x = GetInterpolatedComp (origin.x, minVertex.x, maxVertex.x);
-	positionInVolume.y = GetInterpolatedComp (origin.y, minVertex.y, maxVertex.y);
-	positionInVolume.z = GetInterpolatedComp (origin.z, minVertex.z, maxVertex.z);
-
-	return positionInVolume;
-}
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
 
 /*Spherical harmonics coefficients - precomputed*/
 #define SH_C0 0.282094792f // 1 / 2sqrt(pi)
@@ -62,13 +43,10 @@ vec3 CalcIndirectDiffuseLight (vec3 in_position, vec3 in_normal)
 
 	vec4 SHintensity = evalSH_direct( -worldSpaceNormal );
 
+	SelectLightPropagationVolume (worldSpacePos);
 	vec3 volumePos = GetPositionInVolume (worldSpacePos);
 
-	vec3 indirectColor = vec3( 
-		dot( SHintensity, texture( volumeTextureR, volumePos) ),
-		dot( SHintensity, texture( volumeTextureG, volumePos ) ),
-		dot( SHintensity, texture( volumeTextureB, volumePos ) )
-	);
+	vec3 indirectColor = SampleLightPropagationVolume (SHintensity, volumePos);
 
 	indirectColor = max (indirectColor, 0.0) / PI;
 
@@ -78,8 +56,8 @@ vec3 CalcIndirectDiffuseLight (vec3 in_position, vec3 in_normal)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
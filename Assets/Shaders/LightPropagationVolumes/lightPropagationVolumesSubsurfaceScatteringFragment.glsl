@@ -15,32 +15,13 @@ uniform mat3 inverseNormalWorldMatrix;
 
 uniform vec3 cameraPosition;
 
-uniform sampler3D volumeTextureR;
-uniform sampler3D volumeTextureG;
-uniform sampler3D volumeTextureB;
-uniform vec3 minVertex;
-uniform vec3 maxVertex;
 uniform ivec3 volumeSize;
 
 uniform float lpvIndirectRefractiveIntensity;
 
 #include "deferred.glsl"
 
-float GetInterpolatedComp (float comp, float minValue, float maxValue)
-{
-	return ((comp - minValue) / (maxValue - minValue));
-}
-
-vec3 GetPositionInVolume (vec3 origin)
-{
-	vec3 positionInVolume;
-
-	positionInVolume.x = GetInterpolatedComp (origin.x, minVertex.x, maxVertex.x);
-	positionInVolume.y = GetInterpolatedComp (origin.y, minVertex.y, maxVertex.y);
-	positionInVolume.z = GetInterpolatedComp (origin.z, minVertex.z, maxVertex.z);
-
-	return positionInVolume;
-}
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
 
 /*Spherical harmonics coefficients - precomputed*/
 #define SH_C0 0.282094792f // 1 / 2sqrt(pi)
@@ -67,17 +48,14 @@ vec3 CalcIndirectRefractiveLight (vec3 in_position, vec3 in_normal, float in_ref
 	vec4 SHintensity = evalSH_direct( -refractiveDir );
 
 	vec3 refractiveStep = 1.0f / volumeSize * refractiveDir * 1.732;
+	SelectLightPropagationVolume (worldSpacePos);
 	vec3 volumePos = GetPositionInVolume (worldSpacePos);
 
 	vec3 subsurfaceScatteringColor = vec3 (0.0f);
 
 	for(float refractiveIndex = 0; refractiveIndex < 5; refractiveIndex++) {
 
-		vec3 indirectColor = vec3( 
-			dot( SHintensity, texture( volumeTextureR, volumePos) ),
-			dot( SHintensity, texture( volumeTextureG, volumePos ) ),
-			dot( SHintensity, texture( volumeTextureB, volumePos ) )
-		);
+		vec3 indirectColor = SampleLightPropagationVolume (SHintensity, volumePos);
 
 		subsurfaceScatteringColor += max (indirectColor, 0.0) / PI / 5;
 
@@ -90,10 +68,10 @@ vec3 CalcIndirectRefractiveLight (vec3 in_position, vec3 in_normal, float in_ref
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 	float in_transparency = textureLod (gDiffuseMap, texCoord, 0).w;
-	float in_refractiveIndex = textureLod (gNormalMap, texCoord, 0).w;
+	float in_refractiveIndex = GBufferRefractiveIndex (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
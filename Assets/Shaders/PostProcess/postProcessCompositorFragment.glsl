@@ -0,0 +1,55 @@
+#version 330 core
+
+/*
+ * Per pixel post processing stages fused in a single pass. The stages
+ * compiled in are chosen by the BLOOM_ENABLED, HDR_ENABLED, LUT_ENABLED
+ * and GAMMA_ENABLED defines, and run in the order of the separate passes.
+*/
+
+layout(location = 0) out vec3 out_color;
+
+uniform sampler2D postProcessMap;
+
+#pragma keywords BLOOM_ENABLED HDR_ENABLED LUT_ENABLED GAMMA_ENABLED
+
+#include "deferred.glsl"
+
+#ifdef BLOOM_ENABLED
+	#include "Bloom/bloomAccumulation.glsl"
+#endif
+
+#ifdef HDR_ENABLED
+	#include "HighDynamicRange/highDynamicRange.glsl"
+#endif
+
+#ifdef LUT_ENABLED
+	#include "TextureLUT/textureLUT.glsl"
+#endif
+
+#ifdef GAMMA_ENABLED
+	#include "GammaCorrection/gammaCorrection.glsl"
+#endif
+
+void main ()
+{
+	vec2 texCoord = CalcTexCoord();
+	vec3 color = texture2D (postProcessMap, texCoord).xyz;
+
+#ifdef BLOOM_ENABLED
+	color = CalcBloomAccumulation (color, texCoord);
+#endif
+
+#ifdef HDR_ENABLED
+	color = CalcHighDynamicRange (color);
+#endif
+
+#ifdef LUT_ENABLED
+	color = CalcTextureLUT (color);
+#endif
+
+#ifdef GAMMA_ENABLED
+	color = CalcGammaCorrection (color);
+#endif
+
+	out_color = color;
+}
@@ -26,6 +26,7 @@ uniform sampler2D indirectDiffuseMap;
 
 #include "deferred.glsl"
 #include "ReflectiveShadowMapping/reflectiveShadowMapping.glsl"
+#include "TemporalFiltering/amortization.glsl"
 
 vec2 CalcTexCoordRSM ()
 {
@@ -40,8 +41,8 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 
 	vec3 indirectDiffuseLight = vec3 (0);
 
-	vec3 interpolatedPosition = textureLod (gPositionMap, texCoord, log2 (1.0 / rsmInterpolationScale)).xyz;
-	vec3 interpolatedNormal = textureLod (gNormalMap, texCoord, log2 (1.0 / rsmInterpolationScale)).xyz;
+	vec3 interpolatedPosition = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / rsmInterpolationScale));
+	vec3 interpolatedNormal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / rsmInterpolationScale));
 
 	if (distance (interpolatedPosition, in_position) < rsmMinInterpolationDistance
 		&& dot (interpolatedNormal, in_normal) > rsmMinInterpolationAngle) {
@@ -60,8 +61,16 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 void main()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+
+#ifdef AMORTIZED
+	if (IsAmortizedPixelSkipped ()) {
+		out_color = CalcAmortizedHistory (in_position, texCoord);
+		return;
+	}
+#endif
+
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -97,8 +97,8 @@ vec3 CalcRSMIndirectSpecular (vec3 in_position, vec3 in_normal)
 void main()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -30,8 +30,8 @@ vec2 CalcTexCoordRSM ()
 void main()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, log2 (1.0 / rsmInterpolationScale)).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, log2 (1.0 / rsmInterpolationScale)).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / rsmInterpolationScale));
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / rsmInterpolationScale));
 
 	in_normal = normalize(in_normal);
 
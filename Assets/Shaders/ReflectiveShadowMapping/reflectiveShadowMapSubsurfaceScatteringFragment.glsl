@@ -93,10 +93,10 @@ vec3 CalcIndirectRefractiveLight (vec3 in_position, vec3 in_normal, float in_ref
 void main()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 	float in_transparency = textureLod (gDiffuseMap, texCoord, 0).w;
-	float in_refractiveIndex = textureLod (gNormalMap, texCoord, 0).w;
+	float in_refractiveIndex = GBufferRefractiveIndex (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -13,6 +13,16 @@ layout(std140) uniform rsmSamples
 	vec2 rsmSample[2000];
 };
 
+/*
+ * Samples count may be compiled in, otherwise the uniform one is used
+*/
+
+#pragma keywords RSM_SAMPLES
+
+#ifndef RSM_SAMPLES
+	#define RSM_SAMPLES rsmSamplesCount
+#endif
+
 uniform float rsmRadius;
 
 /*
@@ -31,7 +41,7 @@ vec3 CalcViewIndirectDiffuseLight (in vec3 viewPosition, in vec3 viewNormal)
 	vec4 lightSpacePos = lightProjectionMatrix * vec4 (lightViewSpacePos, 1.0);
 	vec3 rsmProjCoords = (lightSpacePos.xyz / lightSpacePos.w) * 0.5 + 0.5;
 
-	for (int index = 0; index < rsmSamplesCount; index ++) {
+	for (int index = 0; index < RSM_SAMPLES; index ++) {
 
 		vec2 rnd = rsmSample [index].xy;
 
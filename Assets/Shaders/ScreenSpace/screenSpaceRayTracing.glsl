@@ -19,6 +19,9 @@ bool traceScreenSpaceRay(
  // The camera-space Z buffer (all negative values)
  sampler2D csZBuffer,
 
+ // Depth buffer to reconstruct camera-space Z from, with a packed GBuffer
+ sampler2D csDepthBuffer,
+
  // Dimensions of csZBuffer
  vec2 csZBufferSize,
 
@@ -115,7 +118,7 @@ bool traceScreenSpaceRay(
         hitPixel = permute ? P.yx : P;
         // You may need hitPixel.y = csZBufferSize.y - hitPixel.y; here if your vertical axis
         // is different than ours in screen space
-        sceneZMax = texelFetch(csZBuffer, ivec2(hitPixel), 0).z;
+        sceneZMax = GBufferFetchPosition(csZBuffer, csDepthBuffer, ivec2(hitPixel)).z;
     }
 
     // Advance Q based on the number of steps
@@ -6,6 +6,7 @@ uniform sampler2D gPositionMap;
 uniform sampler2D gNormalMap;
 uniform sampler2D gDiffuseMap;
 uniform sampler2D gSpecularMap;
+uniform sampler2D gDepthMap;
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -25,6 +26,16 @@ layout(std140) uniform ssaoSamples
 	vec3 ssaoSample[200];
 };
 
+/*
+ * Samples count may be compiled in, otherwise the uniform one is used
+*/
+
+#pragma keywords SSAO_SAMPLES
+
+#ifndef SSAO_SAMPLES
+	#define SSAO_SAMPLES ssaoSamplesCount
+#endif
+
 uniform sampler2D noiseMap;
 uniform ivec2 noiseMapSize;
 
@@ -32,6 +43,8 @@ uniform vec2 ssaoResolution;
 uniform float ssaoRadius;
 uniform float ssaoBias;
 
+#include "gBuffer.glsl"
+
 vec2 CalcTexCoord()
 {
 	return gl_FragCoord.xy / ssaoResolution;
@@ -59,7 +72,7 @@ float CalcScreenSpaceAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 te
 
 	int samplesCount = 0;
 
-	for (int sampleIndex = 0; sampleIndex < ssaoSamplesCount; ++ sampleIndex) {
+	for (int sampleIndex = 0; sampleIndex < SSAO_SAMPLES; ++ sampleIndex) {
 		vec3 sample = tangentMatrix * ssaoSample [sampleIndex];
 		sample = in_position + sample * ssaoRadius;
 
@@ -71,7 +84,7 @@ float CalcScreenSpaceAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 te
 			continue;
 		}
 
-		vec3 samplePos = textureLod (gPositionMap, offset.xy, 0).xyz;
+		vec3 samplePos = GBufferPosition (gPositionMap, gDepthMap, offset.xy, 0);
 
 		float rangeCheck = smoothstep (0.0, 1.0, ssaoRadius / abs (in_position.z - samplePos.z));
 
@@ -90,8 +103,8 @@ float CalcScreenSpaceAmbientOcclusion (vec3 in_position, vec3 in_normal, vec2 te
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
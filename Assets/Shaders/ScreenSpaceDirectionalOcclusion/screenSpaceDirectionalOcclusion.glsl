@@ -73,8 +73,8 @@ vec3 CalcScreenSpaceDirectionalOcclusion (vec3 in_position, vec3 in_normal)
 			continue;
 		}
 
-		vec3 samplePos = textureLod (gPositionMap, offset.xy, 0).xyz;
-		vec3 sampleNormal = textureLod (gNormalMap, offset.xy, 0).xyz;
+		vec3 samplePos = GBufferPosition (gPositionMap, gDepthMap, offset.xy, 0);
+		vec3 sampleNormal = GBufferNormal (gNormalMap, offset.xy, 0);
 		vec3 sampleDiffuse = texture2D (postProcessMap, offset.xy).xyz;
 
 		sampleNormal = normalize (sampleNormal);
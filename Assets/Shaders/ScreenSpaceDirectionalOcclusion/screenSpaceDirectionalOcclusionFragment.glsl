@@ -29,6 +29,7 @@ vec2 CalcTexCoordSSDO()
 
 #include "deferred.glsl"
 #include "ScreenSpaceDirectionalOcclusion/screenSpaceDirectionalOcclusion.glsl"
+#include "TemporalFiltering/amortization.glsl"
 
 vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec2 texCoord)
 {
@@ -38,8 +39,8 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 
 	vec3 indirectDiffuseLight = vec3 (0);
 
-	vec3 interpolatedPosition = textureLod (gPositionMap, texCoord, log2 (1.0 / ssdoInterpolationScale)).xyz;
-	vec3 interpolatedNormal = textureLod (gNormalMap, texCoord, log2 (1.0 / ssdoInterpolationScale)).xyz;
+	vec3 interpolatedPosition = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / ssdoInterpolationScale));
+	vec3 interpolatedNormal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / ssdoInterpolationScale));
 
 	if (distance (interpolatedPosition, in_position) < ssdoMinInterpolationDistance
 		&& dot (interpolatedNormal, in_normal) > ssdoMinInterpolationAngle) {
@@ -58,8 +59,16 @@ vec3 CalcInterpolatedIndirectDiffuseLight (vec3 in_position, vec3 in_normal, vec
 void main()
 {
 	vec2 texCoord = CalcTexCoordSSDO();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+
+#ifdef AMORTIZED
+	if (IsAmortizedPixelSkipped ()) {
+		out_color = CalcAmortizedHistory (in_position, texCoord);
+		return;
+	}
+#endif
+
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -30,8 +30,8 @@ vec2 CalcTexCoordSSDO()
 void main()
 {
 	vec2 texCoord = CalcTexCoordSSDO();
-	vec3 in_position = textureLod (gPositionMap, texCoord, log2 (1.0 / ssdoInterpolationScale)).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, log2 (1.0 / ssdoInterpolationScale)).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, log2 (1.0 / ssdoInterpolationScale));
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, log2 (1.0 / ssdoInterpolationScale));
 
 	in_normal = normalize(in_normal);
 
@@ -65,12 +65,12 @@ vec3 CalcDirectionalLight (vec3 in_position, vec3 in_normal, vec3 in_diffuse, ve
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
 	vec3 in_diffuse = textureLod (gDiffuseMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 	vec3 in_specular = textureLod (gSpecularMap, texCoord, 0).xyz;
 	vec3 in_emissive = textureLod (gEmissiveMap, texCoord, 0).xyz;
-	float in_shininess = textureLod (gSpecularMap, texCoord, 0).w;
+	float in_shininess = GBufferShininess (gNormalMap, gSpecularMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -6,6 +6,7 @@ uniform sampler2D gPositionMap;
 uniform sampler2D gNormalMap;
 uniform sampler2D gDiffuseMap;
 uniform sampler2D gSpecularMap;
+uniform sampler2D gDepthMap;
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -30,6 +31,7 @@ vec2 CalcTexCoord()
 	return gl_FragCoord.xy / ssdoShadowResolution;
 }
 
+#include "gBuffer.glsl"
 #include "ScreenSpace/screenSpaceRayTracing.glsl"
 
 float CalcShadow (vec3 in_position)
@@ -44,7 +46,7 @@ float CalcShadow (vec3 in_position)
 	vec3 reflectionViewPos;
 
 	bool intersect = traceScreenSpaceRay (in_position, -lightDirection, pixelProjectionMatrix,
-		gPositionMap, screenSize, 1, -cameraZLimits.x, ssdoShadowStride, 5, 500,
+		gPositionMap, gDepthMap, screenSize, 1, -cameraZLimits.x, ssdoShadowStride, 5, 500,
 		100.0f, reflectionPos, reflectionViewPos);
 
 	return intersect == false ? 1.0 : 0.0;
@@ -53,7 +55,7 @@ float CalcShadow (vec3 in_position)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = texture2D (gPositionMap, texCoord).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
 
 	out_color = CalcShadow (in_position);
 }
@@ -31,8 +31,8 @@ vec3 fresnelSchlick(float cosTheta, vec3 F0)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 	vec3 in_diffuse = texture (postProcessMap, texCoord).xyz;
 	vec3 in_specular = textureLod (gSpecularMap, texCoord, 0).xyz;
 	vec2 in_reflection = textureLod (reflectionMap, texCoord, 0).xy;
@@ -51,7 +51,7 @@ void main()
 
 	vec3 fresnel = fresnelSchlick(max(dot(in_normal, normalize(-in_position)), 0.0), vec3 (0.0f));
 
-	vec3 reflectionViewPos = textureLod (gPositionMap, in_reflection, 0).xyz;
+	vec3 reflectionViewPos = GBufferPosition (gPositionMap, gDepthMap, in_reflection, 0);
 	float d = distance (reflectionViewPos, in_position);
 
 	out_color = in_diffuse + (in_specular * reflection * screenEdgeFade *
@@ -30,6 +30,7 @@ uniform int ssrStride;
 
 uniform sampler2D postProcessMap;
 
+#include "gBuffer.glsl"
 #include "ScreenSpace/screenSpaceRayTracing.glsl"
 
 vec2 CalcTexCoord()
@@ -64,7 +65,7 @@ vec3 CalcScreenSpaceReflection (vec3 in_position, vec3 in_normal, vec2 texCoord)
 	vec3 reflectionViewPos;
 
 	bool intersect = traceScreenSpaceRay (in_position, reflectionDirection, pixelProjectionMatrix,
-		gPositionMap, screenSize, ssrThickness, -cameraZLimits.x, ssrStride, 2, ssrIterations,
+		gPositionMap, gDepthMap, screenSize, ssrThickness, -cameraZLimits.x, ssrStride, 2, ssrIterations,
 		1000.0f, reflectionPos, reflectionViewPos);
 
 	if (intersect == false) {
@@ -80,8 +81,8 @@ void main()
 {
 	vec2 texCoord = CalcTexCoord();
 	vec3 in_diffuse = texture (postProcessMap, texCoord).xyz;
-	vec3 in_position = texture (gPositionMap, texCoord).xyz;
-	vec3 in_normal = texture (gNormalMap, texCoord).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 	vec3 in_specular = texture (gSpecularMap, texCoord).xyz;
 	float in_depth = texture (gDepthMap, texCoord).x;
 
@@ -51,7 +51,7 @@ vec2 CalcScreenSpaceSubsurfaceScattering (vec3 in_position, vec3 in_normal, floa
 	vec3 reflectionViewPos;
 
 	bool intersect = traceScreenSpaceRay (in_position, refractiveDirection, pixelProjectionMatrix,
-		gPositionMap, screenSize, 5, -cameraZLimits.x, 1, 2, ssrIterations,
+		gPositionMap, gDepthMap, screenSize, 5, -cameraZLimits.x, 1, 2, ssrIterations,
 		1000.0f, reflectionPos, reflectionViewPos);
 
 	if (intersect == false) {
@@ -65,9 +65,9 @@ void main()
 {
 	vec2 texCoord = CalcTexCoord();
 	vec3 in_diffuse = texture (postProcessMap, texCoord).xyz;
-	vec3 in_position = texture (gTrPositionMap, texCoord).xyz;
-	vec3 in_normal = texture (gTrNormalMap, texCoord).xyz;
-	float in_refractiveIndex = texture (gTrNormalMap, texCoord).w;
+	vec3 in_position = GBufferPosition (gTrPositionMap, gTrDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gTrNormalMap, texCoord, 0);
+	float in_refractiveIndex = GBufferRefractiveIndex (gTrNormalMap, texCoord, 0);
 	float in_transparency = texture (gTrDiffuseMap, texCoord).w;
 
 	in_normal = normalize(in_normal);
@@ -0,0 +1,44 @@
+#pragma keywords AMORTIZED
+
+#ifdef AMORTIZED
+
+uniform sampler2D temporalFilterMap;
+
+uniform int amortizationInterval;
+uniform int amortizationFrame;
+uniform int amortizationInterleaved;
+
+#include "TemporalFiltering/temporalFiltering.glsl"
+
+/*
+ * Pixels of an amortized pass not computed this frame. Either the whole
+ * frame but one every interval frames, or every pixel out of the current
+ * checkerboard or 2x2 subset.
+*/
+
+bool IsAmortizedPixelSkipped ()
+{
+	if (amortizationInterval <= 1) {
+		return false;
+	}
+
+	if (amortizationInterleaved == 0) {
+		return amortizationFrame != 0;
+	}
+
+	ivec2 pixel = ivec2 (gl_FragCoord.xy);
+
+	int subset = amortizationInterval == 2 ? (pixel.x + pixel.y) & 1 :
+		(pixel.x & 1) + 2 * (pixel.y & 1);
+
+	return subset != amortizationFrame;
+}
+
+vec3 CalcAmortizedHistory (const in vec3 in_position, const in vec2 texCoord)
+{
+	vec2 lastTexCoord = CalcReprojectedTexCoord (in_position, texCoord);
+
+	return texture2D (temporalFilterMap, lastTexCoord).xyz;
+}
+
+#endif
@@ -20,6 +20,7 @@ uniform float rsmIntensity;
 
 #include "deferred.glsl"
 #include "ReflectiveShadowMapping/reflectiveShadowMapping.glsl"
+#include "TemporalFiltering/amortization.glsl"
 
 float rand(vec2 co){
   return fract(sin(dot(co.xy ,vec2(12.9898,78.233))) * 43758.5453);
@@ -80,8 +81,16 @@ vec3 CalcIndirectDiffuseLight (vec3 in_position, vec3 in_normal)
 void main()
 {
 	vec2 texCoord = CalcTexCoordRSM();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+
+#ifdef AMORTIZED
+	if (IsAmortizedPixelSkipped ()) {
+		out_color = CalcAmortizedHistory (in_position, texCoord);
+		return;
+	}
+#endif
+
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -0,0 +1,9 @@
+uniform sampler3D lutTexture;
+uniform float lutIntensity;
+
+vec3 CalcTextureLUT (vec3 in_diffuse)
+{
+	vec3 color = texture (lutTexture, in_diffuse.rbg).xyz;
+
+	return mix (color, in_diffuse, 1.0 - lutIntensity);
+}
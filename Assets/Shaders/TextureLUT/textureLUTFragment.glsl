@@ -14,17 +14,8 @@ uniform vec3 cameraPosition;
 
 uniform sampler2D postProcessMap;
 
-uniform sampler3D lutTexture;
-uniform float lutIntensity;
-
 #include "deferred.glsl"
-
-vec3 CalcTextureLUT (vec3 in_diffuse)
-{
-	vec3 color = texture (lutTexture, in_diffuse.rbg).xyz;
-
-	return mix (color, in_diffuse, 1.0 - lutIntensity);
-}
+#include "TextureLUT/textureLUT.glsl"
 
 void main ()
 {
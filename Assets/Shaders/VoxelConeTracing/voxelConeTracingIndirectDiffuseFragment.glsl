@@ -21,6 +21,7 @@ uniform float diffuseOriginBias;
 
 #include "deferred.glsl"
 #include "VoxelConeTracing/voxelConeTracing.glsl"
+#include "TemporalFiltering/amortization.glsl"
 
 /*
  * Calculate  a vector that is orthogonal to u.
@@ -67,8 +68,16 @@ vec3 CalcIndirectDiffuseLight(vec3 in_position, vec3 in_normal)
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+
+#ifdef AMORTIZED
+	if (IsAmortizedPixelSkipped ()) {
+		out_color = CalcAmortizedHistory (in_position, texCoord);
+		return;
+	}
+#endif
+
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
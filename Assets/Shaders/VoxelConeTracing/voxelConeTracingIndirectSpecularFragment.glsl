@@ -46,9 +46,9 @@ vec3 CalcIndirectSpecularLight (vec3 in_position, vec3 in_normal, float in_shini
 void main()
 {
 	vec2 texCoord = CalcTexCoord();
-	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
-	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
-	float in_shininess = textureLod (gSpecularMap, texCoord, 0).w;
+	vec3 in_position = GBufferPosition (gPositionMap, gDepthMap, texCoord, 0);
+	vec3 in_normal = GBufferNormal (gNormalMap, texCoord, 0);
+	float in_shininess = GBufferShininess (gNormalMap, gSpecularMap, texCoord, 0);
 
 	in_normal = normalize(in_normal);
 
@@ -18,3 +18,5 @@ vec2 CalcTexCoord()
 {
 	return gl_FragCoord.xy / screenSize;
 }
+
+#include "gBuffer.glsl"
@@ -1,10 +1,12 @@
 #version 330 core
 
-layout (location = 0) out vec4 out_position;
-layout (location = 1) out vec4 out_normal;
-layout (location = 2) out vec4 out_diffuse;
-layout (location = 3) out vec4 out_specular;
-layout (location = 4) out vec4 out_emissive;
+layout (location = 0) out vec4 out_normal;
+layout (location = 1) out vec4 out_diffuse;
+layout (location = 2) out vec4 out_specular;
+layout (location = 3) out vec4 out_emissive;
+layout (location = 4) out vec4 out_position;
+
+#include "gBuffer.glsl"
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -73,7 +75,7 @@ void main()
 
 	out_position = vec4 (geom_position, 1.0);
 	out_diffuse = vec4 (diffuseMap, MaterialTransparency);
-	out_normal = vec4 (norm, MaterialRefractiveIndex);
+	out_normal = GBufferEncodeNormal (norm, MaterialRefractiveIndex, MaterialShininess);
 	out_specular = vec4 (specularMap, MaterialShininess);
 	out_emissive = vec4 (emissiveMap, 1.0);
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #version 330 core
 
-layout (location = 0) out vec4 out_position;
-layout (location = 1) out vec4 out_normal;
-layout (location = 2) out vec4 out_diffuse;
-layout (location = 3) out vec4 out_specular;
-layout (location = 4) out vec4 out_lightmap;
+layout (location = 0) out vec4 out_normal;
+layout (location = 1) out vec4 out_diffuse;
+layout (location = 2) out vec4 out_specular;
+layout (location = 3) out vec4 out_lightmap;
+layout (location = 4) out vec4 out_position;
+
+#include "gBuffer.glsl"
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -63,7 +65,7 @@ void main()
 
 	out_position = vec4 (geom_position, 1.0);
 	out_diffuse = vec4 (diffuseMap, 1.0);
-	out_normal = vec4 (norm, 1.0);
+	out_normal = GBufferEncodeNormal (norm, 1.0, MaterialShininess);
 	out_specular = vec4 (specularMap, MaterialShininess);
 	out_lightmap = vec4 (lightMap, 1.0);
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #version 330 core
 
-layout (location = 0) out vec4 out_position;
-layout (location = 1) out vec4 out_normal;
-layout (location = 2) out vec4 out_diffuse;
-layout (location = 3) out vec4 out_specular;
-layout (location = 4) out vec4 out_emissive;
+layout (location = 0) out vec4 out_normal;
+layout (location = 1) out vec4 out_diffuse;
+layout (location = 2) out vec4 out_specular;
+layout (location = 3) out vec4 out_emissive;
+layout (location = 4) out vec4 out_position;
+
+#include "gBuffer.glsl"
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -36,7 +38,7 @@ const vec3 nullInAlphaMap = vec3 (0.0);
 in vec3 geom_position;
 in vec3 geom_normal;
 in vec2 geom_texcoord;
-in vec3 geom_tangent;
+in vec4 geom_tangent;
 
 void main()
 {
@@ -72,8 +74,8 @@ void main()
 
 	if (normalMap != vec3 (1.0)) {
 		
-		vec3 tangent = normalize (geom_tangent);
-		vec3 bitangent = normalize (cross (tangent, normal));
+		vec3 tangent = normalize (geom_tangent.xyz);
+		vec3 bitangent = normalize (cross (tangent, normal)) * geom_tangent.w;
 
 		normalMap = 2.0 * normalMap - 1.0;
 		mat3 tnbMat = mat3 (tangent, bitangent, normal);
@@ -87,7 +89,7 @@ void main()
 
 	out_position = vec4 (geom_position, 1.0);
 	out_diffuse = vec4 (diffuseMap, MaterialTransparency);
-	out_normal = vec4 (normal, MaterialRefractiveIndex);
+	out_normal = GBufferEncodeNormal (normal, MaterialRefractiveIndex, MaterialShininess);
 	out_specular = vec4 (specularMap, MaterialShininess);
 	out_emissive = vec4 (emissiveMap, 1.0);
 }
\ No newline at end of file
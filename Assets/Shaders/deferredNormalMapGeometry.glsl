@@ -8,12 +8,12 @@ layout (triangle_strip, max_vertices = 3) out;
 in vec3 vert_position[];
 in vec3 vert_normal[];
 in vec2 vert_texcoord[];
-in vec3 vert_tangent[];
+in vec4 vert_tangent[];
 
 out vec3 geom_position;
 out vec3 geom_normal;
 out vec2 geom_texcoord;
-out vec3 geom_tangent;
+out vec4 geom_tangent;
 
 void main ()
 {
@@ -3,7 +3,7 @@
 layout(location = 0) in vec3 in_position;
 layout(location = 1) in vec3 in_normal;
 layout(location = 2) in vec2 in_texcoord;
-layout(location = 3) in vec3 in_tangent;
+layout(location = 3) in vec4 in_tangent;
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
@@ -15,7 +15,7 @@ uniform mat3 normalWorldMatrix;
 out vec3 vert_position;
 out vec3 vert_normal;
 out vec2 vert_texcoord;
-out vec3 vert_tangent;
+out vec4 vert_tangent;
 
 void main()
 {
@@ -31,7 +31,7 @@ void main()
 
 	vert_position = vec3 (modelViewMatrix * vec4 (in_position, 1));
 	vert_normal = normalWorldMatrix * in_normal;
-	vert_tangent = normalWorldMatrix * in_tangent;
+	vert_tangent = vec4 (normalWorldMatrix * in_tangent.xyz, in_tangent.w);
 
 	vert_texcoord = in_texcoord;
 }
@@ -0,0 +1,112 @@
+#ifndef G_BUFFER_GLSL
+#define G_BUFFER_GLSL
+
+/*
+ * Packed layout keeps no position map. Normals are octahedron encoded,
+ * while refractive index and shininess share the normal map.
+*/
+
+uniform int gBufferPacked;
+
+uniform mat4 gInverseProjectionMatrix;
+
+vec2 GBufferEncodeOctahedron (vec3 normal)
+{
+	normal /= abs (normal.x) + abs (normal.y) + abs (normal.z);
+
+	if (normal.z < 0.0) {
+		vec2 signs = vec2 (normal.x >= 0.0 ? 1.0 : -1.0, normal.y >= 0.0 ? 1.0 : -1.0);
+		normal.xy = (1.0 - abs (normal.yx)) * signs;
+	}
+
+	return normal.xy;
+}
+
+vec3 GBufferDecodeOctahedron (vec2 encoded)
+{
+	vec3 normal = vec3 (encoded, 1.0 - abs (encoded.x) - abs (encoded.y));
+
+	float fold = clamp (-normal.z, 0.0, 1.0);
+	normal.xy += vec2 (normal.x >= 0.0 ? -fold : fold, normal.y >= 0.0 ? -fold : fold);
+
+	return normalize (normal);
+}
+
+vec4 GBufferEncodeNormal (vec3 normal, float refractiveIndex, float shininess)
+{
+	if (gBufferPacked == 0) {
+		return vec4 (normal, refractiveIndex);
+	}
+
+	return vec4 (GBufferEncodeOctahedron (normal), refractiveIndex, shininess);
+}
+
+vec3 GBufferViewPosition (float depth, vec2 texCoord)
+{
+	/*
+	 * Nothing was drawn, same as the cleared position map
+	*/
+
+	if (depth == 1.0) {
+		return vec3 (0.0);
+	}
+
+	vec4 viewPosition = gInverseProjectionMatrix * vec4 (vec3 (texCoord, depth) * 2.0 - 1.0, 1.0);
+
+	return viewPosition.xyz / viewPosition.w;
+}
+
+vec3 GBufferPosition (sampler2D positionMap, sampler2D depthMap, vec2 texCoord, float lod)
+{
+	if (gBufferPacked == 0) {
+		return textureLod (positionMap, texCoord, lod).xyz;
+	}
+
+	/*
+	 * Depth map has no mipmaps, coarser levels read the full resolution
+	*/
+
+	float depth = textureLod (depthMap, texCoord, 0).x;
+
+	return GBufferViewPosition (depth, texCoord);
+}
+
+vec3 GBufferFetchPosition (sampler2D positionMap, sampler2D depthMap, ivec2 pixel)
+{
+	if (gBufferPacked == 0) {
+		return texelFetch (positionMap, pixel, 0).xyz;
+	}
+
+	float depth = texelFetch (depthMap, pixel, 0).x;
+
+	return GBufferViewPosition (depth, (vec2 (pixel) + 0.5) / vec2 (textureSize (depthMap, 0)));
+}
+
+vec3 GBufferNormal (sampler2D normalMap, vec2 texCoord, float lod)
+{
+	vec4 normal = textureLod (normalMap, texCoord, lod);
+
+	if (gBufferPacked == 0) {
+		return normal.xyz;
+	}
+
+	return GBufferDecodeOctahedron (normal.xy);
+}
+
+float GBufferRefractiveIndex (sampler2D normalMap, vec2 texCoord, float lod)
+{
+	vec4 normal = textureLod (normalMap, texCoord, lod);
+
+	return gBufferPacked == 0 ? normal.w : normal.z;
+}
+
+float GBufferShininess (sampler2D normalMap, sampler2D specularMap, vec2 texCoord, float lod)
+{
+	if (gBufferPacked == 0) {
+		return textureLod (specularMap, texCoord, lod).w;
+	}
+
+	return textureLod (normalMap, texCoord, lod).w;
+}
+
+#endif
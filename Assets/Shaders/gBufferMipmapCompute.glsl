@@ -0,0 +1,93 @@
+#version 430
+layout (local_size_x = 8, local_size_y = 8) in;
+
+/*
+ * Downsample every required GBuffer mip level in a single dispatch.
+ * Each work group reduces a 16x16 tile of the base level, keeping the
+ * intermediate levels in shared memory.
+*/
+
+#define MAX_LEVELS 4
+#define TEXTURES_COUNT 2
+
+uniform sampler2D srcNormalMap;
+uniform sampler2D srcPositionMap;
+
+uniform int normalLevelsCount;
+uniform int positionLevelsCount;
+
+layout (binding = 0) uniform writeonly image2D dstImageMips [TEXTURES_COUNT * MAX_LEVELS];
+
+shared vec4 tile [64];
+
+vec4 FetchSource (int textureIndex, ivec2 pixel)
+{
+	if (textureIndex == 0) {
+		ivec2 size = textureSize (srcNormalMap, 0);
+		return texelFetch (srcNormalMap, min (pixel, size - 1), 0);
+	}
+
+	ivec2 size = textureSize (srcPositionMap, 0);
+	return texelFetch (srcPositionMap, min (pixel, size - 1), 0);
+}
+
+void main()
+{
+	ivec2 localPos = ivec2 (gl_LocalInvocationID.xy);
+	ivec2 dstPos = ivec2 (gl_GlobalInvocationID.xy);
+	int localIndex = localPos.y * 8 + localPos.x;
+
+	for (int textureIndex = 0; textureIndex < TEXTURES_COUNT; textureIndex++) {
+
+		int levelsCount = textureIndex == 0 ? normalLevelsCount : positionLevelsCount;
+
+		if (levelsCount == 0) {
+			continue;
+		}
+
+		/*
+		 * First level is reduced straight from the base level
+		*/
+
+		ivec2 srcPos = dstPos * 2;
+
+		vec4 value = (FetchSource (textureIndex, srcPos)
+			+ FetchSource (textureIndex, srcPos + ivec2 (1, 0))
+			+ FetchSource (textureIndex, srcPos + ivec2 (0, 1))
+			+ FetchSource (textureIndex, srcPos + ivec2 (1, 1))) * 0.25;
+
+		imageStore (dstImageMips [textureIndex * MAX_LEVELS], dstPos, value);
+
+		tile [localIndex] = value;
+
+		/*
+		 * Next levels are reduced from the tile, by a quarter of the
+		 * threads at each step
+		*/
+
+		for (int level = 2; level <= levelsCount; level++) {
+			memoryBarrierShared ();
+			barrier ();
+
+			int stride = 1 << (level - 2);
+
+			if (localPos.x % (stride * 2) == 0 && localPos.y % (stride * 2) == 0) {
+				value = (tile [localIndex]
+					+ tile [localIndex + stride]
+					+ tile [localIndex + stride * 8]
+					+ tile [localIndex + stride * 8 + stride]) * 0.25;
+
+				imageStore (dstImageMips [textureIndex * MAX_LEVELS + level - 1], dstPos >> (level - 1), value);
+
+				tile [localIndex] = value;
+			}
+		}
+
+		/*
+		 * Tile is reused by the next texture
+		*/
+
+		memoryBarrierShared ();
+		barrier ();
+	}
+}
@@ -36,3 +36,12 @@ void Editor::RenderScene ()
 {
 	EditorScene::Instance ()->Render ();
 }
+
+bool Editor::IsPipelinedRenderingSupported () const
+{
+	/*
+	 * Editor widgets and gizmos draw with ImGui from the scene update
+	*/
+
+	return false;
+}
@@ -10,6 +10,8 @@ public:
 	void UpdateFrame ();
 	void UpdateScene ();
 	void RenderScene ();
+
+	bool IsPipelinedRenderingSupported () const;
 };
 
 REGISTER_GAME_MODULE(Editor)
@@ -113,6 +113,7 @@ void EditorScene::Render ()
 	_renderSettings->viewport.y = 0;
 	_renderSettings->viewport.width = _size.x;
 	_renderSettings->viewport.height = _size.y;
+	_renderSettings->window = _renderSettings->viewport;
 
 	RenderProduct result = RenderManager::Instance ()->Render (_sceneCamera, *_renderSettings);
 
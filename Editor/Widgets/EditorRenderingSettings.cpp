@@ -14,6 +14,7 @@
 
 #include "Renderer/RenderSystem.h"
 #include "Renderer/RenderManager.h"
+#include "Renderer/DynamicResolution.h"
 
 #include "RenderPasses/FramebufferRenderVolume.h"
 
@@ -125,6 +126,82 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
     ImGui::Spacing();
 
+	if (ImGui::CollapsingHeader ("Dynamic Resolution")) {
+
+		ImGui::Checkbox ("Enabled", &_settings->dynamic_resolution_enabled);
+
+		ImGui::SliderFloat ("Target Frame Time (ms)", &_settings->dynamic_resolution_target, 4.0f, 66.0f);
+		ImGui::SliderFloat ("Min Scale", &_settings->dynamic_resolution_min_scale, 0.25f, 1.0f);
+
+		ImGui::Text ("Scale: %.2f GPU Time: %.2f ms", DynamicResolution::GetScale (), DynamicResolution::GetFrameTime ());
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("G-Buffer")) {
+
+		ImGui::Checkbox ("Packed", &_settings->gbuffer_packed);
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("Occlusion Culling")) {
+
+		ImGui::Checkbox ("Enabled", &_settings->occlusion_culling_enabled);
+
+		std::size_t limit1 = 16, limit2 = 1024;
+		ImGui::SliderScalar ("Width", ImGuiDataType_U32, &_settings->occlusion_culling_width, &limit1, &limit2);
+		ImGui::SliderScalar ("Height", ImGuiDataType_U32, &_settings->occlusion_culling_height, &limit1, &limit2);
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("Level Of Detail")) {
+
+		ImGui::Checkbox ("Enabled", &_settings->lod_enabled);
+
+		ImGui::SliderFloat ("LOD 1 Screen Size", &_settings->lod_threshold_1, 0.0f, 1.0f);
+		ImGui::SliderFloat ("LOD 2 Screen Size", &_settings->lod_threshold_2, 0.0f, 1.0f);
+		ImGui::SliderFloat ("LOD 3 Screen Size", &_settings->lod_threshold_3, 0.0f, 1.0f);
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("Clustered Lighting")) {
+
+		ImGui::Checkbox ("Enabled", &_settings->clustered_lighting_enabled);
+
+		std::size_t limit1 = 1, limit2 = 64;
+		ImGui::SliderScalar ("Tiles X", ImGuiDataType_U32, &_settings->clustered_lighting_width, &limit1, &limit2);
+		ImGui::SliderScalar ("Tiles Y", ImGuiDataType_U32, &_settings->clustered_lighting_height, &limit1, &limit2);
+		ImGui::SliderScalar ("Slices", ImGuiDataType_U32, &_settings->clustered_lighting_depth, &limit1, &limit2);
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("Shadow Cascades")) {
+
+		ImGui::Checkbox ("Amortized Update", &_settings->shadow_cascades_amortized_update);
+
+		std::size_t limit1 = 1, limit2 = 16;
+		ImGui::SliderScalar ("Update Interval", ImGuiDataType_U32, &_settings->shadow_cascades_update_interval, &limit1, &limit2);
+	}
+
+	ImGui::Spacing ();
+
+	if (ImGui::CollapsingHeader ("Spot Light Shadow Atlas")) {
+
+		ImGui::Checkbox ("Enabled", &_settings->spot_shadow_atlas_enabled);
+
+		std::size_t limit1 = 64, limit2 = 16384;
+		ImGui::SliderScalar ("Atlas Size", ImGuiDataType_U32, &_settings->spot_shadow_atlas_size, &limit1, &limit2);
+
+		std::size_t limit3 = 1, limit4 = 32;
+		ImGui::SliderScalar ("Update Budget", ImGuiDataType_U32, &_settings->spot_shadow_atlas_update_budget, &limit3, &limit4);
+	}
+
+	ImGui::Spacing ();
+
 	if (ImGui::CollapsingHeader ("Reflective Shadow Mapping")) {
 
 		float scale = _settings->rsm_scale;
@@ -164,6 +241,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::Separator();
 
+		ImGui::PushID ("RSMAmortization");
+		ImGui::InputScalar ("Amortization Interval", ImGuiDataType_U32, &_settings->rsm_amortization_interval);
+		ImGui::Checkbox ("Interleaved Amortization", &_settings->rsm_amortization_interleaved);
+		ImGui::PopID ();
+
+		ImGui::Separator();
+
 		ImGui::PushID ("RSMDebug");
 
 		if (ImGui::TreeNode ("Debug")) {
@@ -248,6 +332,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::Separator();
 
+		ImGui::PushID ("LPVCascades");
+		ImGui::InputScalar ("Cascades Count", ImGuiDataType_U32, &_settings->lpv_cascades_count);
+		ImGui::InputFloat ("Cascade Extent", &_settings->lpv_cascade_extent, 0.1);
+		ImGui::PopID ();
+
+		ImGui::Separator();
+
 		ImGui::PushID ("LPVIndirect Light Intensity");
 		ImGui::InputFloat ("Indirect Diffuse Light Intensity", &_settings->lpv_indirect_diffuse_intensity, 0.1);
 		ImGui::InputFloat ("Indirect Specular Light Intensity", &_settings->lpv_indirect_specular_intensity, 0.1);
@@ -309,6 +400,7 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::InputScalar ("Voxel Volume Size", ImGuiDataType_U32, &_settings->vct_voxels_size);
 		ImGui::Checkbox ("Continuous Voxelization", &_settings->vct_continuous_voxelization);
+		ImGui::Checkbox ("Incremental Voxelization", &_settings->vct_incremental_voxelization);
 		// ImGui::Checkbox ("Voxel Volume Bordering", &_settings->vct_bordering);
 
 		std::size_t speed = 1;
@@ -346,6 +438,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 		ImGui::SliderFloat ("Shadow Cone Ratio", &_settings->vct_shadow_cone_ratio, 0.0f, 1.0f, "%3f", 10.0f);
 		ImGui::SliderFloat ("Shadow Cone Distance", &_settings->vct_shadow_cone_distance, 0.0f, 1.0f);
 
+		ImGui::Separator();
+
+		ImGui::PushID ("VCTAmortization");
+		ImGui::InputScalar ("Amortization Interval", ImGuiDataType_U32, &_settings->vct_amortization_interval);
+		ImGui::Checkbox ("Interleaved Amortization", &_settings->vct_amortization_interleaved);
+		ImGui::PopID ();
+
   //       ImGui::Separator();
 
 		// ImGui::SliderFloat ("Origin Bias", &_settings->vct_origin_bias, 0.0f, 1.0f, "%5f", 10.0f);
@@ -426,6 +525,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::Separator();
 
+		ImGui::PushID ("TRSMAmortization");
+		ImGui::InputScalar ("Amortization Interval", ImGuiDataType_U32, &_settings->trsm_amortization_interval);
+		ImGui::Checkbox ("Interleaved Amortization", &_settings->trsm_amortization_interleaved);
+		ImGui::PopID ();
+
+		ImGui::Separator();
+
 		ImGui::PushID ("TRSMDebug");
 		if (ImGui::TreeNode ("Debug")) {
 
@@ -544,6 +650,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::Separator();
 
+		ImGui::PushID ("HGIAmortization");
+		ImGui::InputScalar ("Amortization Interval", ImGuiDataType_U32, &_settings->hgi_amortization_interval);
+		ImGui::Checkbox ("Interleaved Amortization", &_settings->hgi_amortization_interleaved);
+		ImGui::PopID ();
+
+		ImGui::Separator();
+
 		ImGui::PushID ("HGIDebug");
 		if (ImGui::TreeNode ("Debug")) {
 
@@ -726,6 +839,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 			ImGui::InputFloat ("Min Interpolation Distance", &_settings->ssdo_min_interpolation_distance, 0.1);
 			ImGui::InputFloat ("Min Interpolation Angle (deg)", &_settings->ssdo_min_interpolation_angle, 0.1);
 
+			ImGui::Separator();
+
+			ImGui::PushID ("SSDOAmortization");
+			ImGui::InputScalar ("Amortization Interval", ImGuiDataType_U32, &_settings->ssdo_amortization_interval);
+			ImGui::Checkbox ("Interleaved Amortization", &_settings->ssdo_amortization_interleaved);
+			ImGui::PopID ();
+
 			ImGui::Separator ();
 
 			ImGui::Checkbox ("Shadow 2D Ray Cast", &_settings->ssdo_ray_shadow);
@@ -886,6 +1006,27 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 			ImGui::TreePop();
 		}
 
+		if (ImGui::TreeNode ("Gaussian Blur")) {
+
+			ImGui::Checkbox ("Compute Backend", &_settings->blur_compute_enabled);
+			ImGui::InputScalar ("Radius", ImGuiDataType_U32, &_settings->blur_radius);
+
+			const char* formats[] = { "RGBA16", "RGBA32", "R11G11B10F" };
+
+			int format = 0;
+			for (int index = 0; index < 3; index ++) {
+				if (_settings->blur_format == formats [index]) {
+					format = index;
+				}
+			}
+
+			ImGui::Combo ("Format", &format, formats, 3);
+
+			_settings->blur_format = formats [format];
+
+			ImGui::TreePop();
+		}
+
 		if (ImGui::TreeNode ("Bloom")) {
 
 			ImGui::Checkbox ("Enabled", &_settings->bloom_enabled);
@@ -948,6 +1089,13 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 			ImGui::TreePop();
 		}
+
+		if (ImGui::TreeNode ("Compositor")) {
+
+			ImGui::Checkbox ("Enabled", &_settings->post_process_compositor_enabled);
+
+			ImGui::TreePop();
+		}
 	}
 
 	ImGui::End();
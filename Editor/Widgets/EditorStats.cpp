@@ -11,6 +11,10 @@
 
 #include "Debug/Statistics/StatisticsManager.h"
 #include "RenderPasses/RenderStatisticsObject.h"
+#include "RenderPasses/GBufferStatisticsObject.h"
+#include "Renderer/UploadStatisticsObject.h"
+#include "RenderPasses/Voxelization/VoxelizationStatisticsObject.h"
+#include "RenderPasses/ShadowMap/SpotLightShadowStatisticsObject.h"
 
 EditorStats::EditorStats () :
 	_timeElapsed (0.0f),
@@ -72,6 +76,7 @@ void EditorStats::ShowStatistics ()
 		std::size_t drawnVerticesCount = renderStatisticsObject->DrawnVerticesCount;
 		std::size_t drawnPolygonsCount = renderStatisticsObject->DrawnPolygonsCount;
 		std::size_t drawnObjectsCount = renderStatisticsObject->DrawnObjectsCount;
+		std::size_t occludedObjectsCount = renderStatisticsObject->OccludedObjectsCount;
 
 		std::string verticesCount = std::to_string (drawnVerticesCount % 1000);
 		while (drawnVerticesCount /= 1000) {
@@ -84,7 +89,28 @@ void EditorStats::ShowStatistics ()
 		}
 
 		ImGui::Text ("Vertices: %s Triangles: %s", verticesCount.c_str (), polygonsCount.c_str ());
-		ImGui::Text ("Objects: %lu", drawnObjectsCount);
+		ImGui::Text ("Objects: %lu Occluded: %lu", drawnObjectsCount, occludedObjectsCount);
+
+		auto gBufferStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <GBufferStatisticsObject> ();
+
+		ImGui::Text ("G-Buffer: %lu B/px %lu MB Unpacked: %lu B/px %lu MB", gBufferStatisticsObject->BytesPerPixel,
+			gBufferStatisticsObject->MemoryBytesCount / (1024 * 1024), gBufferStatisticsObject->UnpackedBytesPerPixel,
+			gBufferStatisticsObject->UnpackedMemoryBytesCount / (1024 * 1024));
+
+		auto uploadStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <UploadStatisticsObject> ();
+
+		ImGui::Text ("Uploads: %lu KB Stalls: %lu Overflows: %lu", uploadStatisticsObject->UploadedBytesCount / 1024,
+			uploadStatisticsObject->StallsCount, uploadStatisticsObject->OverflowsCount);
+
+		auto voxelizationStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <VoxelizationStatisticsObject> ();
+
+		ImGui::Text ("Revoxelized Objects: %lu Voxels: %lu", voxelizationStatisticsObject->RevoxelizedObjectsCount,
+			voxelizationStatisticsObject->RevoxelizedVoxelsCount);
+
+		auto spotLightShadowStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <SpotLightShadowStatisticsObject> ();
+
+		ImGui::Text ("Spot Shadow Tiles: %lu Reused: %lu", spotLightShadowStatisticsObject->RenderedTilesCount,
+			spotLightShadowStatisticsObject->ReusedTilesCount);
 
 		ImGui::Spacing ();
 
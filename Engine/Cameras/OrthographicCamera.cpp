@@ -67,3 +67,8 @@ glm::mat4 OrthographicCamera::GetProjectionMatrix () const
 
 	return projectionMatrix;
 }
+
+Camera* OrthographicCamera::Clone () const
+{
+	return new OrthographicCamera (*this);
+}
@@ -20,6 +20,8 @@ public:
 	virtual FrustumVolume GetFrustumVolume () const;
 
 	virtual glm::mat4 GetProjectionMatrix () const;
+
+	virtual Camera* Clone () const;
 };
 
 #endif
\ No newline at end of file
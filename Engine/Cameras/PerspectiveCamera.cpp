@@ -36,4 +36,9 @@ glm::mat4 PerspectiveCamera::GetProjectionMatrix () const
 	glm::mat4 projection = glm::perspective (_fieldOfViewAngle, _aspect, _zNear, _zFar);
 
 	return projection;
-}
\ No newline at end of file
+}
+
+Camera* PerspectiveCamera::Clone () const
+{
+	return new PerspectiveCamera (*this);
+}
@@ -18,6 +18,8 @@ public:
 	FrustumVolume GetFrustumVolume () const;
 
 	glm::mat4 GetProjectionMatrix () const;
+
+	Camera* Clone () const;
 };
 
 #endif
\ No newline at end of file
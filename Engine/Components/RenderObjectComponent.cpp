@@ -97,6 +97,10 @@ void RenderObjectComponent::SetModel (const Resource<Model>& model)
 
 	_renderObject->SetModelView (modelView);
 
+	if (_layer & SceneLayer::OCCLUDER) {
+		_renderObject->SetOccluderMesh (RenderSystem::LoadOccluderMesh (_model));
+	}
+
 	auto& boundingBox = _model->GetBoundingBox ();
 	AABBVolume volume (
 		glm::vec3 (boundingBox.xmin, boundingBox.ymin, boundingBox.zmin),
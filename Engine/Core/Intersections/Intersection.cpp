@@ -48,6 +48,13 @@ bool Intersection::CheckFrustumVsAABB (const FrustumVolume& frustum, const AABBV
 	return true;
 }
 
+bool Intersection::CheckAABBVsAABB (const AABBVolume& boundingBox1, const AABBVolume& boundingBox2)
+{
+	return boundingBox1.minVertex.x <= boundingBox2.maxVertex.x && boundingBox2.minVertex.x <= boundingBox1.maxVertex.x &&
+		boundingBox1.minVertex.y <= boundingBox2.maxVertex.y && boundingBox2.minVertex.y <= boundingBox1.maxVertex.y &&
+		boundingBox1.minVertex.z <= boundingBox2.maxVertex.z && boundingBox2.minVertex.z <= boundingBox1.maxVertex.z;
+}
+
 bool Intersection::CheckRayVsAABB (const RayPrimitive& rayData, const AABBVolume& aabbData, float& distance)
 {
 	float tMin, tMax;
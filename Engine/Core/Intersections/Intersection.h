@@ -18,6 +18,7 @@ class ENGINE_API Intersection : public Singleton<Intersection>
 
 public:
 	bool CheckFrustumVsAABB (const FrustumVolume&, const AABBVolume&);
+	bool CheckAABBVsAABB (const AABBVolume&, const AABBVolume&);
 	bool CheckRayVsAABB (const RayPrimitive& ray, const AABBVolume& aabb, float& distance);
 	bool CheckRayVsModel (const RayPrimitive& ray, const Resource<Model>& model, float& distance);
 	bool CheckRayVsPolygon (const RayPrimitive& ray, const Resource<Model>& model, Polygon* poly, float& distance);
@@ -4,16 +4,27 @@
 #include "Core/Interfaces/Object.h"
 
 #include <map>
+#include <mutex>
+#include <atomic>
+
+/*
+ * Reference counted handle. Handles are copied and released from both
+ * the render and the update thread in pipelined mode, so the counter is
+ * atomic and the registry of sources is guarded. A counter only drops
+ * to zero while the registry is locked, so a source being released
+ * cannot be found by path meanwhile.
+*/
 
 template <class T>
 class Resource : public Object
 {
 protected:
 	T* _source;
-	std::size_t* _counter;
+	std::atomic<std::size_t>* _counter;
 private:
-	static std::map<T*, std::pair<std::string, std::size_t*>> _sources;
+	static std::map<T*, std::pair<std::string, std::atomic<std::size_t>*>> _sources;
 	static std::map<std::string, T*> _paths;
+	static std::mutex _sourcesMutex;
 
 public:
 	Resource (T* = nullptr, const std::string& path = "");
@@ -31,16 +42,23 @@ public:
 	bool operator== (std::nullptr_t) const;
 	bool operator!= (std::nullptr_t) const;
 
-	const std::string& GetPath () const;
+	std::string GetPath () const;
 	static Resource<T> GetResource (const std::string& path);
+private:
+	Resource (T* source, std::atomic<std::size_t>* counter);
+
+	void Release ();
 };
 
 template <class T>
-std::map<T*, std::pair<std::string, std::size_t*>> Resource<T>::_sources;
+std::map<T*, std::pair<std::string, std::atomic<std::size_t>*>> Resource<T>::_sources;
 
 template <class T>
 std::map<std::string, T*> Resource<T>::_paths;
 
+template <class T>
+std::mutex Resource<T>::_sourcesMutex;
+
 template <class T>
 Resource<T>::Resource (T* source, const std::string& path) :
 	_source (source),
@@ -50,11 +68,13 @@ Resource<T>::Resource (T* source, const std::string& path) :
 		return;
 	}
 
+	std::lock_guard<std::mutex> lock (_sourcesMutex);
+
 	auto itSource = _sources.find (source);
 
 	if (itSource == _sources.end ()) {
-		_counter = new std::size_t (0);
-		_sources [_source] = std::pair<std::string, std::size_t*> (path, _counter);
+		_counter = new std::atomic<std::size_t> (0);
+		_sources [_source] = std::pair<std::string, std::atomic<std::size_t>*> (path, _counter);
 
 		//TODO: Fix this
 		_paths [path] = _source;
@@ -67,6 +87,16 @@ Resource<T>::Resource (T* source, const std::string& path) :
 	(*_counter) ++;
 }
 
+template <class T>
+Resource<T>::Resource (T* source, std::atomic<std::size_t>* counter) :
+	_source (source),
+	_counter (counter)
+{
+	/*
+	 * Adopt a reference already counted under the registry lock
+	*/
+}
+
 template <class T>
 Resource<T>::Resource (const Resource& other) :
 	_source (other._source),
@@ -82,25 +112,7 @@ Resource<T>::Resource (const Resource& other) :
 template <class T>
 Resource<T>::~Resource ()
 {
-	if (_source == nullptr) {
-		return;
-	}
-
-	(*_counter) --;
-
-	if (*_counter == 0) {
-		auto itSource = _sources.find (_source);
-
-		if (itSource == _sources.end ()) {
-			//TODO: Fix this
-		}
-
-		_paths.erase (itSource->second.first);
-		_sources.erase (_source);
-
-		delete _source;
-		delete _counter;
-	}
+	Release ();
 }
 
 template <class T>
@@ -134,31 +146,15 @@ Resource<T>& Resource<T>::operator= (const Resource<T>& other)
 		return *this;
 	}
 
-	if (_source != nullptr) {
-		(*_counter) --;
-
-		if (*_counter == 0) {
-			auto itSource = _sources.find (_source);
-
-			if (itSource == _sources.end ()) {
-				//TODO: Fix this
-			}
-
-			_paths.erase (itSource->second.first);
-			_sources.erase (_source);
-
-			delete _source;
-			delete _counter;
-		}
+	if (other._source != nullptr) {
+		(*other._counter) ++;
 	}
 
+	Release ();
+
 	_source = other._source;
 	_counter = other._counter;
 
-	if (_source != nullptr) {
-		(*_counter) ++;
-	}
-
 	return *this;
 }
 
@@ -195,18 +191,31 @@ bool Resource<T>::operator!= (std::nullptr_t check) const
 template <class T>
 Resource<T> Resource<T>::GetResource (const std::string& path)
 {
+	/*
+	 * Source is found and referenced under the same lock, so it cannot
+	 * be released in between
+	*/
+
+	std::lock_guard<std::mutex> lock (_sourcesMutex);
+
 	auto itPaths = _paths.find (path);
 
 	if (itPaths == _paths.end ()) {
 		return nullptr;
 	}
 
-	return Resource (itPaths->second);
+	std::atomic<std::size_t>* counter = _sources [itPaths->second].second;
+
+	(*counter) ++;
+
+	return Resource (itPaths->second, counter);
 }
 
 template <class T>
-const std::string& Resource<T>::GetPath () const
+std::string Resource<T>::GetPath () const
 {
+	std::lock_guard<std::mutex> lock (_sourcesMutex);
+
 	auto itResource = _sources.find (_source);
 
 	// if (itResource == _sources.end ()) {
@@ -216,4 +225,44 @@ const std::string& Resource<T>::GetPath () const
 	return itResource->second.first;
 }
 
+template <class T>
+void Resource<T>::Release ()
+{
+	if (_source == nullptr) {
+		return;
+	}
+
+	/*
+	 * Drop a reference that is not the last one without locking
+	*/
+
+	std::size_t count = _counter->load ();
+
+	while (count > 1) {
+		if (_counter->compare_exchange_weak (count, count - 1)) {
+			return;
+		}
+	}
+
+	std::unique_lock<std::mutex> lock (_sourcesMutex);
+
+	if ((*_counter) -- != 1) {
+		return;
+	}
+
+	auto itSource = _sources.find (_source);
+
+	if (itSource == _sources.end ()) {
+		//TODO: Fix this
+	}
+
+	_paths.erase (itSource->second.first);
+	_sources.erase (_source);
+
+	lock.unlock ();
+
+	delete _source;
+	delete _counter;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "Debug/Profiler/Profiler.h"
+
+#include "Arguments/ArgumentsAnalyzer.h"
+
+#include "Core/Console/Console.h"
+
+/*
+ * First frames load and compile, they are left out of the report
+*/
+
+#define BENCHMARK_WARMUP_FRAMES 10
+
+BenchmarkEntry::BenchmarkEntry () :
+	total (0.0f),
+	min (std::numeric_limits<float>::max ()),
+	max (0.0f),
+	framesCount (0)
+{
+
+}
+
+bool Benchmark::_isActive (false);
+std::size_t Benchmark::_framesCount (0);
+std::size_t Benchmark::_frameIndex (0);
+
+std::vector<BenchmarkKeyframe> Benchmark::_keyframes;
+std::string Benchmark::_outputPath;
+
+std::map<std::string, BenchmarkEntry> Benchmark::_cpuEntries;
+std::map<std::string, BenchmarkEntry> Benchmark::_gpuEntries;
+
+void Benchmark::Init ()
+{
+	Argument* arg = ArgumentsAnalyzer::Instance ()->GetArgument ("benchmark");
+
+	if (arg == nullptr) {
+		return;
+	}
+
+	_framesCount = (std::size_t) std::max (std::atoi (arg->GetArgs () [0].c_str ()), 1);
+	_frameIndex = 0;
+
+	arg = ArgumentsAnalyzer::Instance ()->GetArgument ("benchmarkpath");
+
+	if (arg != nullptr) {
+		LoadPath (arg->GetArgs () [0]);
+	}
+
+	arg = ArgumentsAnalyzer::Instance ()->GetArgument ("benchmarkoutput");
+
+	if (arg != nullptr) {
+		_outputPath = arg->GetArgs () [0];
+	}
+
+	/*
+	 * Loggers only record while the services are active
+	*/
+
+	Profiler::Instance ()->GetCPUProfilerService ()->SetActive (true);
+	Profiler::Instance ()->GetGPUProfilerService ()->SetActive (true);
+
+	_isActive = true;
+
+	Console::Log ("Benchmark: " + std::to_string (_framesCount) + " frames, " +
+		std::to_string (_keyframes.size ()) + " camera keyframes");
+}
+
+bool Benchmark::IsActive ()
+{
+	return _isActive;
+}
+
+bool Benchmark::IsFinished ()
+{
+	return _isActive == true && _frameIndex > _framesCount + BENCHMARK_WARMUP_FRAMES;
+}
+
+void Benchmark::StartFrame ()
+{
+	if (_isActive == false) {
+		return;
+	}
+
+	/*
+	 * Profiler services just moved the previous frame to their last
+	 * frame queues
+	*/
+
+	if (_frameIndex > BENCHMARK_WARMUP_FRAMES) {
+		GatherEvents (Profiler::Instance ()->GetCPUProfilerService ()->GetLastFrameEvents (), _cpuEntries);
+		GatherEvents (Profiler::Instance ()->GetGPUProfilerService ()->GetLastFrameEvents (), _gpuEntries);
+	}
+
+	_frameIndex ++;
+}
+
+void Benchmark::UpdateCamera (Camera* camera)
+{
+	if (_isActive == false || _keyframes.empty () || camera == nullptr) {
+		return;
+	}
+
+	/*
+	 * Keyframes are spread evenly over the measured frames
+	*/
+
+	std::size_t frameIndex = _frameIndex > BENCHMARK_WARMUP_FRAMES ? _frameIndex - BENCHMARK_WARMUP_FRAMES : 0;
+
+	float progress = std::min ((float) frameIndex / _framesCount, 1.0f) * (_keyframes.size () - 1);
+
+	std::size_t index = std::min ((std::size_t) progress, _keyframes.size () - 1);
+	std::size_t nextIndex = std::min (index + 1, _keyframes.size () - 1);
+	float factor = progress - index;
+
+	camera->SetPosition (glm::mix (_keyframes [index].position, _keyframes [nextIndex].position, factor));
+	camera->SetRotation (glm::slerp (_keyframes [index].rotation, _keyframes [nextIndex].rotation, factor));
+}
+
+void Benchmark::Report ()
+{
+	if (_isActive == false) {
+		return;
+	}
+
+	std::string report = "type,name,average,min,max\n";
+
+	report += ReportEntries ("cpu", _cpuEntries);
+	report += ReportEntries ("gpu", _gpuEntries);
+
+	Console::Log ("Benchmark results (ms per frame):\n" + report);
+
+	if (_outputPath != std::string ()) {
+		std::ofstream file (_outputPath);
+
+		if (!file.is_open ()) {
+			Console::LogError ("Benchmark output \"" + _outputPath + "\" could not be written");
+			return;
+		}
+
+		file << report;
+	}
+}
+
+void Benchmark::LoadPath (const std::string& path)
+{
+	std::ifstream file (path);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Benchmark camera path \"" + path + "\" could not be opened");
+		return;
+	}
+
+	std::string line;
+
+	while (std::getline (file, line)) {
+		if (line.empty () || line [0] == '#') {
+			continue;
+		}
+
+		std::istringstream stream (line);
+
+		glm::vec3 position, eulerAngles;
+
+		if (!(stream >> position.x >> position.y >> position.z >> eulerAngles.x >> eulerAngles.y >> eulerAngles.z)) {
+			continue;
+		}
+
+		BenchmarkKeyframe keyframe;
+
+		keyframe.position = position;
+		keyframe.rotation = glm::normalize (glm::quat (glm::radians (eulerAngles)));
+
+		_keyframes.push_back (keyframe);
+	}
+}
+
+void Benchmark::GatherEvents (const std::vector<ProfilerEntry*>& events, std::map<std::string, BenchmarkEntry>& entries)
+{
+	/*
+	 * Events with the same name in one frame add up
+	*/
+
+	std::map<std::string, float> frameDurations;
+
+	for (auto profilerEvent : events) {
+		frameDurations [profilerEvent->Name] += profilerEvent->Duration;
+	}
+
+	for (auto& it : frameDurations) {
+		BenchmarkEntry& entry = entries [it.first];
+
+		entry.total += it.second;
+		entry.min = std::min (entry.min, it.second);
+		entry.max = std::max (entry.max, it.second);
+		entry.framesCount ++;
+	}
+}
+
+std::string Benchmark::ReportEntries (const std::string& type, const std::map<std::string, BenchmarkEntry>& entries)
+{
+	std::string report;
+
+	for (auto& it : entries) {
+		const BenchmarkEntry& entry = it.second;
+
+		report += type + "," + it.first + "," +
+			std::to_string (entry.total / entry.framesCount) + "," +
+			std::to_string (entry.min) + "," +
+			std::to_string (entry.max) + "\n";
+	}
+
+	return report;
+}
@@ -0,0 +1,71 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <glm/vec3.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "Systems/Camera/Camera.h"
+#include "Debug/Profiler/ProfilerService.h"
+
+/*
+ * Benchmark run. Started with --benchmark <frames>, it moves the active
+ * camera along the keyframes given by --benchmarkpath (one line per
+ * keyframe, position and euler angles in degrees, spread evenly over
+ * the run), gathers the profiler CPU and GPU events of every frame and
+ * reports per event averages at the end, also written as CSV to
+ * --benchmarkoutput when given. Camera placement depends on the frame
+ * index only, so runs are reproducible.
+*/
+
+struct BenchmarkKeyframe
+{
+	glm::vec3 position;
+	glm::quat rotation;
+};
+
+struct BenchmarkEntry
+{
+	float total;
+	float min;
+	float max;
+	std::size_t framesCount;
+
+	BenchmarkEntry ();
+};
+
+class ENGINE_API Benchmark
+{
+private:
+	static bool _isActive;
+	static std::size_t _framesCount;
+	static std::size_t _frameIndex;
+
+	static std::vector<BenchmarkKeyframe> _keyframes;
+	static std::string _outputPath;
+
+	static std::map<std::string, BenchmarkEntry> _cpuEntries;
+	static std::map<std::string, BenchmarkEntry> _gpuEntries;
+
+public:
+	static void Init ();
+
+	static bool IsActive ();
+	static bool IsFinished ();
+
+	static void StartFrame ();
+	static void UpdateCamera (Camera* camera);
+
+	static void Report ();
+private:
+	static void LoadPath (const std::string& path);
+	static void GatherEvents (const std::vector<ProfilerEntry*>& events, std::map<std::string, BenchmarkEntry>& entries);
+	static std::string ReportEntries (const std::string& type, const std::map<std::string, BenchmarkEntry>& entries);
+};
+
+#endif
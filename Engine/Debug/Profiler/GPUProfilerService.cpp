@@ -21,16 +21,25 @@ void GPUProfilerEntry::Evaluate ()
 }
 
 GPUProfilerService::GPUProfilerService () :
-	_startFrameQuery (0)
+	_startFrameQuery (0),
+	_lastFrameTime (0.0f),
+	_lastEndFrameQuery (0),
+	_endFrameQuery (0),
+	_endFramesCount (0),
+	_lastFrameBusyTime (0.0f)
 {
 	GL::GenQueries (1, &_lastStartFrameQuery);
 	GL::GenQueries (1, &_startFrameQuery);
+	GL::GenQueries (1, &_lastEndFrameQuery);
+	GL::GenQueries (1, &_endFrameQuery);
 }
 
 GPUProfilerService::~GPUProfilerService ()
 {
 	GL::DeleteQueries (1, &_startFrameQuery);
 	GL::DeleteQueries (1, &_lastStartFrameQuery);
+	GL::DeleteQueries (1, &_endFrameQuery);
+	GL::DeleteQueries (1, &_lastEndFrameQuery);
 }
 
 void GPUProfilerService::StartFrame ()
@@ -64,6 +73,18 @@ void GPUProfilerService::StartFrame ()
 
 	_lastStartFrameTime = currentStartFrameTime;
 
+	/*
+	 * Busy time of the same frame, from its start to the end of its
+	 * commands, leaves out the wait for the swap
+	*/
+
+	if (_endFramesCount >= 2) {
+		GLuint64 endFrameTime;
+		GL::GetQueryObjectui64v(_lastEndFrameQuery, GL_QUERY_RESULT, &endFrameTime);
+
+		_lastFrameBusyTime = (endFrameTime - currentStartFrameTime) / 1000000.0f;
+	}
+
 	for (auto profilerEvent : _lastFrameQueue2) {
 		((GPUProfilerEntry*) profilerEvent)->Evaluate ();
 	}
@@ -72,6 +93,14 @@ void GPUProfilerService::StartFrame ()
 	GL::QueryCounter (_startFrameQuery, GL_TIMESTAMP);
 }
 
+void GPUProfilerService::EndFrame ()
+{
+	std::swap (_lastEndFrameQuery, _endFrameQuery);
+	GL::QueryCounter (_endFrameQuery, GL_TIMESTAMP);
+
+	_endFramesCount ++;
+}
+
 const std::vector<ProfilerEntry*>& GPUProfilerService::GetLastFrameEvents () const
 {
 	return _lastFrameQueue2;
@@ -86,3 +115,8 @@ float GPUProfilerService::GetLastFrameTime () const
 {
 	return _lastFrameTime;
 }
+
+float GPUProfilerService::GetLastFrameBusyTime () const
+{
+	return _lastFrameBusyTime;
+}
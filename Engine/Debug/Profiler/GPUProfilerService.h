@@ -26,16 +26,24 @@ protected:
 
 	float _lastFrameTime;
 
+	unsigned int _lastEndFrameQuery;
+	unsigned int _endFrameQuery;
+	std::size_t _endFramesCount;
+
+	float _lastFrameBusyTime;
+
 public:
 	GPUProfilerService ();
 	~GPUProfilerService ();
 
 	void StartFrame ();
+	void EndFrame ();
 
 	const std::vector<ProfilerEntry*>& GetLastFrameEvents () const;
 
 	uint64_t GetStartTime () const;
 	float GetLastFrameTime () const;
+	float GetLastFrameBusyTime () const;
 };
 
 #endif
\ No newline at end of file
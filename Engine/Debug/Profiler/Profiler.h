@@ -12,6 +12,9 @@
 Profiler::Instance ()->GetCPUProfilerService ()->StartFrame (); \
 Profiler::Instance ()->GetGPUProfilerService ()->StartFrame ();
 
+#define PROFILER_END_FRAME \
+Profiler::Instance ()->GetGPUProfilerService ()->EndFrame ();
+
 class ENGINE_API Profiler : public Singleton<Profiler>
 {
 	friend Singleton<Profiler>;
@@ -0,0 +1,121 @@
+#include "SelfCheck.h"
+
+#include <deque>
+
+#include "Renderer/DynamicResolution.h"
+
+/*
+ * GPU cost follows the pixel count, timings arrive two frames late like
+ * the ones of the profiler
+*/
+
+#define DYNAMIC_RESOLUTION_CHECK_TARGET 16.6f
+#define DYNAMIC_RESOLUTION_CHECK_LATENCY 2
+#define DYNAMIC_RESOLUTION_CHECK_SETTLE_FRAMES 1000
+#define DYNAMIC_RESOLUTION_CHECK_HOLD_FRAMES 500
+
+static float SimulateFrames (RenderSettings& settings, std::deque<float>& timings,
+	float fullResolutionTime, std::size_t framesCount)
+{
+	float frameTime = 0.0f;
+
+	for (std::size_t frameIndex = 0; frameIndex < framesCount; frameIndex ++) {
+		float pixelsRatio = (float) (settings.resolution.width * settings.resolution.height) /
+			(settings.window.width * settings.window.height);
+
+		frameTime = fullResolutionTime * pixelsRatio;
+
+		timings.push_back (frameTime);
+
+		float gpuFrameTime = 0.0f;
+
+		if (timings.size () > DYNAMIC_RESOLUTION_CHECK_LATENCY) {
+			gpuFrameTime = timings.front ();
+			timings.pop_front ();
+		}
+
+		DynamicResolution::Update (settings, gpuFrameTime);
+	}
+
+	return frameTime;
+}
+
+static void CheckConvergence (const std::string& name, RenderSettings& settings,
+	std::deque<float>& timings, float fullResolutionTime)
+{
+	SimulateFrames (settings, timings, fullResolutionTime, DYNAMIC_RESOLUTION_CHECK_SETTLE_FRAMES);
+
+	float scale = DynamicResolution::GetScale ();
+
+	/*
+	 * Once settled, frame time stays in the band and the scale holds
+	*/
+
+	for (std::size_t frameIndex = 0; frameIndex < DYNAMIC_RESOLUTION_CHECK_HOLD_FRAMES; frameIndex ++) {
+		float frameTime = SimulateFrames (settings, timings, fullResolutionTime, 1);
+
+		if (frameTime < DYNAMIC_RESOLUTION_CHECK_TARGET * 0.85f || frameTime > DYNAMIC_RESOLUTION_CHECK_TARGET) {
+			SelfCheck::Expect (false, name + ": frame time " + std::to_string (frameTime) +
+				" ms is out of the band at scale " + std::to_string (DynamicResolution::GetScale ()));
+			return;
+		}
+
+		if (DynamicResolution::GetScale () != scale) {
+			SelfCheck::Expect (false, name + ": scale keeps changing after it settled");
+			return;
+		}
+	}
+
+	SelfCheck::Expect (true, name);
+}
+
+void SelfCheck::CheckDynamicResolution ()
+{
+	RenderSettings settings = RenderSettings ();
+
+	settings.window.width = 1280;
+	settings.window.height = 720;
+
+	settings.dynamic_resolution_target = DYNAMIC_RESOLUTION_CHECK_TARGET;
+	settings.dynamic_resolution_min_scale = 0.5f;
+
+	std::deque<float> timings;
+
+	/*
+	 * Disabled controller resets to full resolution
+	*/
+
+	settings.dynamic_resolution_enabled = false;
+
+	DynamicResolution::Update (settings, 0.0f);
+
+	Expect (settings.resolution.width == 1280 && settings.resolution.height == 720,
+		"disabled dynamic resolution does not render at window resolution");
+
+	settings.dynamic_resolution_enabled = true;
+
+	/*
+	 * Starting over budget at full resolution
+	*/
+
+	CheckConvergence ("dynamic resolution from over budget", settings, timings, 30.0f);
+
+	/*
+	 * Starting under budget at the minimum scale, reached under a
+	 * heavier load first
+	*/
+
+	SimulateFrames (settings, timings, 120.0f, DYNAMIC_RESOLUTION_CHECK_SETTLE_FRAMES);
+
+	Expect (DynamicResolution::GetScale () == 0.5f, "dynamic resolution does not reach its minimum scale");
+
+	CheckConvergence ("dynamic resolution from under budget", settings, timings, 20.0f);
+
+	/*
+	 * Leave the controller as it was found
+	*/
+
+	settings.dynamic_resolution_enabled = false;
+
+	DynamicResolution::Update (settings, 0.0f);
+}
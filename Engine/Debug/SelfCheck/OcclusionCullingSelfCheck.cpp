@@ -0,0 +1,88 @@
+#include "SelfCheck.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Renderer/SoftwareOcclusionCulling.h"
+
+void SelfCheck::CheckOcclusionCulling ()
+{
+	SoftwareOcclusionCulling culling;
+
+	culling.SetResolution (256, 256);
+
+	/*
+	 * Camera on the positive z axis looking at the origin
+	*/
+
+	glm::mat4 projectionMatrix = glm::perspective (glm::radians (90.0f), 1.0f, 0.1f, 100.0f);
+	glm::mat4 viewMatrix = glm::lookAt (glm::vec3 (0.0f, 0.0f, 5.0f), glm::vec3 (0.0f), glm::vec3 (0.0f, 1.0f, 0.0f));
+
+	culling.Begin (projectionMatrix * viewMatrix);
+
+	/*
+	 * Occluder quad between the camera and the origin
+	*/
+
+	OccluderMesh quad;
+
+	quad.vertices = {
+		glm::vec3 (-1.0f, -1.0f, 0.0f), glm::vec3 (1.0f, -1.0f, 0.0f),
+		glm::vec3 (1.0f, 1.0f, 0.0f), glm::vec3 (-1.0f, 1.0f, 0.0f)
+	};
+
+	quad.indices = { 0, 1, 2, 0, 2, 3 };
+
+	culling.AttachOccluder (quad, glm::translate (glm::mat4 (1.0f), glm::vec3 (0.0f, 0.0f, 2.0f)));
+	culling.Rasterize ();
+
+	Expect (culling.GetTrianglesCount () == 2, "occluder quad is not rasterized as two triangles");
+
+	/*
+	 * Box behind the quad is hidden, boxes beside it or in front of it
+	 * are visible
+	*/
+
+	AABBVolume hiddenBox (glm::vec3 (-0.5f), glm::vec3 (0.5f));
+	AABBVolume besideBox (glm::vec3 (2.5f, -0.5f, -0.5f), glm::vec3 (3.5f, 0.5f, 0.5f));
+	AABBVolume frontBox (glm::vec3 (-0.25f, -0.25f, 3.25f), glm::vec3 (0.25f, 0.25f, 3.75f));
+
+	Expect (culling.IsVisible (hiddenBox) == false, "box behind the occluder quad is reported visible");
+	Expect (culling.IsVisible (besideBox) == true, "box beside the occluder quad is reported hidden");
+	Expect (culling.IsVisible (frontBox) == true, "box in front of the occluder quad is reported hidden");
+
+	/*
+	 * Ground plane going down the view and past the far plane. Its
+	 * depth must not be pulled nearer where it leaves the frustum.
+	*/
+
+	culling.Begin (projectionMatrix * viewMatrix);
+
+	OccluderMesh ground;
+
+	ground.vertices = {
+		glm::vec3 (-40.0f, -20.0f, -60.0f), glm::vec3 (40.0f, -20.0f, -60.0f),
+		glm::vec3 (40.0f, 20.0f, -300.0f), glm::vec3 (-40.0f, 20.0f, -300.0f)
+	};
+
+	ground.indices = { 0, 1, 2, 0, 2, 3 };
+
+	culling.AttachOccluder (ground, glm::mat4 (1.0f));
+	culling.Rasterize ();
+
+	/*
+	 * Boxes on the ray to a ground point 91 units away, at 80% and 105%
+	 * of its distance
+	*/
+
+	glm::vec3 cameraPosition = glm::vec3 (0.0f, 0.0f, 5.0f);
+	glm::vec3 groundPoint = glm::vec3 (0.0f, -14.0f, -96.0f);
+
+	glm::vec3 nearCenter = cameraPosition + (groundPoint - cameraPosition) * 0.8f;
+	glm::vec3 farCenter = cameraPosition + (groundPoint - cameraPosition) * 1.05f;
+
+	AABBVolume nearGroundBox (nearCenter - glm::vec3 (0.25f), nearCenter + glm::vec3 (0.25f));
+	AABBVolume behindGroundBox (farCenter - glm::vec3 (0.25f), farCenter + glm::vec3 (0.25f));
+
+	Expect (culling.IsVisible (nearGroundBox) == true, "box in front of an occluder crossing the far plane is reported hidden");
+	Expect (culling.IsVisible (behindGroundBox) == false, "box behind an occluder crossing the far plane is reported visible");
+}
@@ -0,0 +1,33 @@
+#include "SelfCheck.h"
+
+#include "Core/Console/Console.h"
+
+std::size_t SelfCheck::_expectationsCount (0);
+std::size_t SelfCheck::_failuresCount (0);
+
+bool SelfCheck::Run ()
+{
+	_expectationsCount = 0;
+	_failuresCount = 0;
+
+	CheckOcclusionCulling ();
+	CheckDynamicResolution ();
+
+	Console::Log ("Self check: " + std::to_string (_expectationsCount - _failuresCount) +
+		" of " + std::to_string (_expectationsCount) + " expectations passed");
+
+	return _failuresCount == 0;
+}
+
+void SelfCheck::Expect (bool condition, const std::string& message)
+{
+	_expectationsCount ++;
+
+	if (condition == true) {
+		return;
+	}
+
+	_failuresCount ++;
+
+	Console::LogError ("Self check failed: " + message);
+}
@@ -0,0 +1,28 @@
+#ifndef SELFCHECK_H
+#define SELFCHECK_H
+
+#include <string>
+
+/*
+ * Headless checks of the CPU only parts of the engine. Started with
+ * --selfcheck, they run before any system is initialized, so they need
+ * neither a window nor a GL context. Every failed expectation is logged
+ * and the engine exits with a non zero status if any of them failed.
+*/
+
+class ENGINE_API SelfCheck
+{
+private:
+	static std::size_t _expectationsCount;
+	static std::size_t _failuresCount;
+
+public:
+	static bool Run ();
+
+	static void Expect (bool condition, const std::string& message);
+private:
+	static void CheckOcclusionCulling ();
+	static void CheckDynamicResolution ();
+};
+
+#endif
@@ -21,6 +21,10 @@ BitmapFont::~BitmapFont ()
 
 FontChar* BitmapFont::GetChar (unsigned char ch) const
 {
+	if (_glyphs.empty () == false) {
+		return _glyphs [ch];
+	}
+
 	std::map<std::size_t, BitmapFontPage*>::const_iterator it;
 
 	for (it = _pages.begin ();it != _pages.end (); it++) {
@@ -104,4 +108,24 @@ void BitmapFont::AddPage (BitmapFontPage* page)
 	}
 
 	_pages [id] = page;
+
+	_glyphs.clear ();
+}
+
+void BitmapFont::BuildGlyphs ()
+{
+	/*
+	 * Flat table indexed by character, so text layout doesn't search
+	 * the charset of every page for each glyph
+	*/
+
+	_glyphs.clear ();
+
+	std::vector<FontChar*> glyphs (256, nullptr);
+
+	for (std::size_t ch = 0; ch < glyphs.size (); ch ++) {
+		glyphs [ch] = GetChar ((unsigned char) ch);
+	}
+
+	_glyphs = glyphs;
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "BitmapFontInfo.h"
 #include "BitmapFontCommon.h"
@@ -25,6 +26,7 @@ protected:
 	BitmapFontInfo* _info;
 	BitmapFontCommon* _commonInfo;
 	std::map<std::size_t, BitmapFontPage*> _pages;
+	std::vector<FontChar*> _glyphs;
 
 public:
 	BitmapFont ();
@@ -43,6 +45,8 @@ public:
 	void SetInfo (BitmapFontInfo* info);
 	void SetCommon (BitmapFontCommon* common);
 	void AddPage (BitmapFontPage* page);
+
+	void BuildGlyphs ();
 };
 
 #endif
\ No newline at end of file
@@ -9,10 +9,15 @@
 #include "Systems/Settings/SettingsManager.h"
 
 #include "Debug/Profiler/Profiler.h"
+#include "Debug/Benchmark/Benchmark.h"
 
 #include "Arguments/ArgumentsAnalyzer.h"
 
 #include "Renderer/RenderManager.h"
+#include "Renderer/PersistentRingBuffer.h"
+#include "Renderer/DynamicResolution.h"
+
+#include "UpdateThread.h"
 
 #include "Managers/SceneManager.h"
 #include "Managers/CameraManager.h"
@@ -47,12 +52,41 @@ void Game::Start ()
 
 	bool running = true;
 
+	/*
+	 * Pipelined rendering draws a snapshot of the scene while the update
+	 * thread runs the simulation step of the next frame
+	*/
+
+	bool pipelined = SettingsManager::Instance ()->GetValue<bool> ("pipelined_rendering", false);
+
+	if (pipelined == true && _gameModule->IsPipelinedRenderingSupported () == false) {
+		Console::LogWarning ("Pipelined rendering is not supported by the game module, serial mode is used");
+
+		pipelined = false;
+	}
+
+	if (pipelined == true) {
+		UpdateThread::Start ([this] () { SimulateScene (); });
+	}
+
 	Time::Init ();
 
+	Benchmark::Init ();
+
 	while(running)
 	{
 		PROFILER_FRAME
 
+		Benchmark::StartFrame ();
+
+		PersistentRingBuffer::BeginFrame ();
+
+		if (pipelined == true) {
+			PROFILER_LOGGER("Wait Update")
+
+			UpdateThread::Wait ();
+		}
+
 		Time::UpdateFrame();
 		Input::UpdateState ();
 		GUI::Update ();
@@ -63,7 +97,7 @@ void Game::Start ()
 		 * Remove Exit on Escape Free from here
 		*/
 
-		if (Input::GetQuit ()) {
+		if (Input::GetQuit () || Benchmark::IsFinished ()) {
 			running = false;
 			continue;
 		}
@@ -72,15 +106,29 @@ void Game::Start ()
 			Window::Resize (Input::GetResizeEvent ());
 		}
 
-		UpdateScene ();
-		DisplayScene ();
+		if (pipelined == false) {
+			UpdateScene ();
+			DisplayScene ();
+		}
+
+		if (pipelined == true) {
+			PipelineScene ();
+		}
 
 		// if(TICKS_PER_FRAME > Time::GetElapsedTimeMS () - Time::GetTimeMS ()) {
 		// 	SDL_Delay(TICKS_PER_FRAME - (Time::GetElapsedTimeMS () - Time::GetTimeMS ()));
 		// }
 
+		PersistentRingBuffer::EndFrame ();
+
+		PROFILER_END_FRAME
+
 		Window::SwapBuffers ();
 	}
+
+	UpdateThread::Stop ();
+
+	Benchmark::Report ();
 }
 
 void Game::LoadGameModule ()
@@ -117,15 +165,73 @@ void Game::DisplayScene()
 	_gameModule->RenderScene ();
 
 	Camera* camera = CameraManager::Instance ()->GetActive ();
+	RenderSettings* settings = GetRenderSettings ();
 
+	Benchmark::UpdateCamera (camera);
+
+	RenderManager::Instance ()->Render (camera, *settings);
+}
+
+void Game::SimulateScene ()
+{
+	/*
+	 * Runs on the update thread, profiler is not thread safe
+	*/
+
+	SceneManager::Instance ()->Current ()->Update ();
+
+	ComponentManager::Instance ()->Update ();
+	PhysicsManager::Instance ()->Update ();
+}
+
+void Game::PipelineScene ()
+{
+	/*
+	 * Scene loading, game module and settings stay on the thread that
+	 * owns the GL context and the GUI
+	*/
+
+	{
+		PROFILER_LOGGER("Update")
+
+		SceneManager::Instance ()->Update ();
+
+		_gameModule->UpdateScene ();
+
+		SettingsManager::Instance ()->Update ();
+	}
+
+	_gameModule->RenderScene ();
+
+	Camera* camera = CameraManager::Instance ()->GetActive ();
+	RenderSettings* settings = GetRenderSettings ();
+
+	Benchmark::UpdateCamera (camera);
+
+	RenderManager::Instance ()->UpdateSnapshot (camera, *settings);
+
+	UpdateThread::Kick ();
+
+	RenderManager::Instance ()->RenderSnapshot ();
+}
+
+RenderSettings* Game::GetRenderSettings ()
+{
 	//TODO: Change this
 	RenderSettings* settings = RenderSettingsManager::Instance ()->GetActive ();
-	settings->resolution.width = Window::GetWidth ();
-	settings->resolution.height = Window::GetHeight ();
-	settings->viewport.x = 0;
-	settings->viewport.y = 0;
-	settings->viewport.width = Window::GetWidth ();
-	settings->viewport.height = Window::GetHeight ();
+	settings->window.x = 0;
+	settings->window.y = 0;
+	settings->window.width = Window::GetWidth ();
+	settings->window.height = Window::GetHeight ();
 
-	RenderManager::Instance ()->Render (camera, *settings);
+	/*
+	 * Render resolution follows the window, scaled down when the GPU
+	 * misses the target frame time
+	*/
+
+	float gpuFrameTime = Profiler::Instance ()->GetGPUProfilerService ()->GetLastFrameBusyTime ();
+
+	DynamicResolution::Update (*settings, gpuFrameTime);
+
+	return settings;
 }
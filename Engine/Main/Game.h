@@ -5,6 +5,8 @@
 
 #include "GameModule.h"
 
+#include "Renderer/RenderSettings.h"
+
 class Game : public Singleton<Game>
 {
 	friend Singleton<Game>;
@@ -23,6 +25,11 @@ private:
 	void UpdateScene ();
 	void DisplayScene ();
 
+	void SimulateScene ();
+	void PipelineScene ();
+
+	RenderSettings* GetRenderSettings ();
+
 	void LoadGameModule ();
 };
 
@@ -25,6 +25,11 @@
 #include "Modules/OpenALModule.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/PersistentRingBuffer.h"
+#include "Renderer/RenderWorkers.h"
+#include "Renderer/RenderThread.h"
+#include "Renderer/ShaderCompiler.h"
+#include "Renderer/TextGUIBatcher.h"
 
 #define ENGINE_SETTINGS_PATH "Assets/LiteEngine.ini"
 
@@ -36,6 +41,8 @@ void GameEngine::Init ()
 {
 	InitSettings ();
 
+	RenderThread::Init ();
+
 	Console::Init ();
 
 	SDLModule::Init ();
@@ -59,6 +66,14 @@ void GameEngine::Init ()
 
 	Pipeline::Init ();
 
+	PersistentRingBuffer::Init ();
+
+	ShaderCompiler::Init ();
+
+	TextGUIBatcher::Init ();
+
+	RenderWorkers::Init ();
+
 	InitScene ();
 }
 
@@ -68,6 +83,12 @@ void GameEngine::Clear ()
 	RenderManager::Instance()->Clear();
 	RenderModuleManager::Instance ()->Clear ();
 
+	RenderWorkers::Clear ();
+
+	TextGUIBatcher::Clear ();
+
+	PersistentRingBuffer::Clear ();
+
 	Pipeline::Clear ();
 
 	GUI::Clear ();
@@ -32,6 +32,13 @@ public:
 	virtual void UpdateFrame () = 0;
 	virtual void UpdateScene () = 0;
 	virtual void RenderScene () = 0;
+
+	/*
+	 * Pipelined rendering runs the scene update on the update thread.
+	 * Modules calling GL or ImGui from their updates keep the serial mode.
+	*/
+
+	virtual bool IsPipelinedRenderingSupported () const { return true; }
 };
 
 #endif
\ No newline at end of file
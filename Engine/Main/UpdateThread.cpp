@@ -0,0 +1,82 @@
+#include "UpdateThread.h"
+
+#include "Renderer/RenderThread.h"
+
+std::thread UpdateThread::_thread;
+
+std::mutex UpdateThread::_mutex;
+std::condition_variable UpdateThread::_condition;
+
+std::function<void ()> UpdateThread::_update;
+bool UpdateThread::_kicked (false);
+bool UpdateThread::_stop (false);
+std::atomic<bool> UpdateThread::_busy (false);
+
+void UpdateThread::Start (const std::function<void ()>& update)
+{
+	_update = update;
+	_kicked = false;
+	_stop = false;
+	_busy = false;
+
+	_thread = std::thread (ThreadLoop);
+}
+
+void UpdateThread::Stop ()
+{
+	if (_thread.joinable () == false) {
+		return;
+	}
+
+	Wait ();
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		_stop = true;
+	}
+
+	_condition.notify_all ();
+
+	_thread.join ();
+}
+
+void UpdateThread::Kick ()
+{
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		_busy = true;
+		_kicked = true;
+	}
+
+	_condition.notify_all ();
+}
+
+void UpdateThread::Wait ()
+{
+	RenderThread::Wait ([] { return _busy == false; });
+}
+
+void UpdateThread::ThreadLoop ()
+{
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock (_mutex);
+
+			_condition.wait (lock, [] { return _stop || _kicked; });
+
+			if (_stop == true) {
+				return;
+			}
+
+			_kicked = false;
+		}
+
+		_update ();
+
+		_busy = false;
+
+		RenderThread::Notify ();
+	}
+}
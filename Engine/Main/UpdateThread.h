@@ -0,0 +1,40 @@
+#ifndef UPDATETHREAD_H
+#define UPDATETHREAD_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/*
+ * Runs the simulation step of a frame while the render thread draws the
+ * previous one. Waiting for the step serves the GL work it hands over.
+*/
+
+class ENGINE_API UpdateThread
+{
+private:
+	static std::thread _thread;
+
+	static std::mutex _mutex;
+	static std::condition_variable _condition;
+
+	static std::function<void ()> _update;
+	static bool _kicked;
+	static bool _stop;
+	static std::atomic<bool> _busy;
+
+public:
+	static void Start (const std::function<void ()>& update);
+	static void Stop ();
+
+	static void Kick ();
+	static void Wait ();
+private:
+	static void ThreadLoop ();
+};
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "Core/Console/Console.h"
 
+#include "Arguments/ArgumentsAnalyzer.h"
+
 /*
  * TODO: Take this from a configure file.
 */
@@ -18,6 +20,16 @@
 
 void SDLModule::Init ()
 {
+	/*
+	 * Headless runs use the offscreen video driver, it creates the GL
+	 * context through EGL without a display. An explicit driver from
+	 * the environment is kept.
+	*/
+
+	if (ArgumentsAnalyzer::Instance ()->GetArgument ("headless") != nullptr) {
+		SDL_setenv ("SDL_VIDEODRIVER", "offscreen", 0);
+	}
+
 	if (SDL_Init(SDL_INIT_FLAGS) < 0) {
 		std::string errorMessage = SDL_GetError ();
 
@@ -25,11 +25,16 @@
 #include "RenderPasses/DeferredDirectionalLightRenderPass.h"
 #include "RenderPasses/DirectionalLightContainerRenderVolumeCollection.h"
 
+#include "RenderPasses/ClusteredShading/LightClustersGenerationRenderPass.h"
+#include "RenderPasses/ClusteredShading/DeferredClusteredLightRenderPass.h"
+
 #include "RenderPasses/DeferredPointLightRenderPass.h"
 #include "RenderPasses/PointLightContainerRenderVolumeCollection.h"
 
 #include "RenderPasses/DeferredSpotLightRenderPass.h"
 #include "RenderPasses/ShadowMap/DeferredSpotLightShadowMapRenderPass.h"
+#include "RenderPasses/ShadowMap/SpotLightShadowCastersCullingRenderPass.h"
+#include "RenderPasses/ShadowMap/SpotLightShadowAtlasRenderPass.h"
 #include "RenderPasses/SpotLightContainerRenderVolumeCollection.h"
 
 #include "RenderPasses/IdleRenderPass.h"
@@ -49,6 +54,7 @@
 #include "RenderPasses/HighDynamicRange/HDRRenderPass.h"
 #include "RenderPasses/TextureLUT/TextureLUTRenderPass.h"
 #include "RenderPasses/GammaCorrection/GammaCorrectionRenderPass.h"
+#include "RenderPasses/PostProcess/PostProcessCompositorRenderPass.h"
 
 void DirectLightingRenderModule::Init ()
 {
@@ -69,10 +75,17 @@ void DirectLightingRenderModule::Init ()
 		// .Attach (new ExponentialShadowMapBlurRenderPass ())
 		.Attach (new DeferredDirectionalLightRenderPass ())
 		.Build ());
+	_renderPasses.push_back (ContainerRenderPass::Builder ()
+		.Volume (new IterateOverRenderVolumeCollection (1))
+		.Attach (new LightClustersGenerationRenderPass ())
+		.Attach (new DeferredClusteredLightRenderPass ())
+		.Build ());
 	_renderPasses.push_back (ContainerRenderPass::Builder ()
 		.Volume (new PointLightContainerRenderVolumeCollection ())
 		.Attach (new DeferredPointLightRenderPass ())
 		.Build ());
+	_renderPasses.push_back (new SpotLightShadowCastersCullingRenderPass ());
+	_renderPasses.push_back (new SpotLightShadowAtlasRenderPass ());
 	_renderPasses.push_back (ContainerRenderPass::Builder ()
 		.Volume (new SpotLightContainerRenderVolumeCollection ())
 		.Attach (new DeferredSpotLightShadowMapRenderPass ())
@@ -110,6 +123,7 @@ void DirectLightingRenderModule::Init ()
 		.Attach (new HDRRenderPass ())
 		.Attach (new TextureLUTRenderPass ())
 		.Attach (new GammaCorrectionRenderPass ())
+		.Attach (new PostProcessCompositorRenderPass ())
 		.Attach (new DeferredBlitRenderPass())
 		.Build ());
 	_renderPasses.push_back (new ForwardRenderPass ());
@@ -59,6 +59,7 @@
 #include "RenderPasses/HighDynamicRange/HDRRenderPass.h"
 #include "RenderPasses/TextureLUT/TextureLUTRenderPass.h"
 #include "RenderPasses/GammaCorrection/GammaCorrectionRenderPass.h"
+#include "RenderPasses/PostProcess/PostProcessCompositorRenderPass.h"
 
 void HybridGlobalIlluminationRenderModule::Init ()
 {
@@ -126,6 +127,7 @@ void HybridGlobalIlluminationRenderModule::Init ()
 		.Attach (new HDRRenderPass ())
 		.Attach (new TextureLUTRenderPass ())
 		.Attach (new GammaCorrectionRenderPass ())
+		.Attach (new PostProcessCompositorRenderPass ())
 		.Attach (new DeferredBlitRenderPass ())
 		.Build ());
 	_renderPasses.push_back (new ForwardRenderPass ());
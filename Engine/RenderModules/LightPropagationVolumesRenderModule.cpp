@@ -20,6 +20,7 @@
 #include "RenderPasses/AmbientLight/AmbientLightRenderPass.h"
 
 #include "RenderPasses/ReflectiveShadowMapping/RSMDirectionalLightAccumulationRenderPass.h"
+#include "RenderPasses/LightPropagationVolumes/LPVCascadesRenderPass.h"
 #include "RenderPasses/LightPropagationVolumes/LPVRadianceInjectionRenderPass.h"
 #include "RenderPasses/LightPropagationVolumes/LPVEmissiveRadianceInjectionRenderPass.h"
 #include "RenderPasses/LightPropagationVolumes/LPVGeometryInjectionRenderPass.h"
@@ -49,6 +50,7 @@
 #include "RenderPasses/HighDynamicRange/HDRRenderPass.h"
 #include "RenderPasses/TextureLUT/TextureLUTRenderPass.h"
 #include "RenderPasses/GammaCorrection/GammaCorrectionRenderPass.h"
+#include "RenderPasses/PostProcess/PostProcessCompositorRenderPass.h"
 
 void LightPropagationVolumesRenderModule::Init ()
 {
@@ -70,11 +72,13 @@ void LightPropagationVolumesRenderModule::Init ()
 	_renderPasses.push_back (ContainerRenderPass::Builder ()
 		.Volume (new DirectionalLightContainerRenderVolumeCollection ())
 		.Attach (new RSMDirectionalLightAccumulationRenderPass ())
-		.Attach (new LPVRadianceInjectionRenderPass ())
-		.Attach (new LPVEmissiveRadianceInjectionRenderPass ())
-		.Attach (new LPVGeometryInjectionRenderPass ())
-		.Attach (new LPVBlitRenderPass ())
-		.Attach (new LPVPropagationRenderPass ())
+		.Attach (new LPVCascadesRenderPass ({
+			new LPVRadianceInjectionRenderPass (),
+			new LPVEmissiveRadianceInjectionRenderPass (),
+			new LPVGeometryInjectionRenderPass (),
+			new LPVBlitRenderPass (),
+			new LPVPropagationRenderPass ()
+		}))
 		.Attach (new LPVAmbientOcclusionRenderPass ())
 		.Attach (new LPVIndirectDiffuseLightRenderPass ())
 		.Attach (new LPVIndirectSpecularLightRenderPass ())
@@ -111,6 +115,7 @@ void LightPropagationVolumesRenderModule::Init ()
 		.Attach (new HDRRenderPass ())
 		.Attach (new TextureLUTRenderPass ())
 		.Attach (new GammaCorrectionRenderPass ())
+		.Attach (new PostProcessCompositorRenderPass ())
 		.Attach (new DeferredBlitRenderPass ())
 		.Build ());
 	_renderPasses.push_back (new ForwardRenderPass ());
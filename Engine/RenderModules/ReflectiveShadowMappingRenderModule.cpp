@@ -30,9 +30,13 @@
 #include "RenderPasses/ReflectiveShadowMapping/RSMRenderPass.h"
 #include "RenderPasses/DirectionalLightContainerRenderVolumeCollection.h"
 
+#include "RenderPasses/ClusteredShading/LightClustersGenerationRenderPass.h"
+#include "RenderPasses/ClusteredShading/DeferredClusteredLightRenderPass.h"
+
 #include "RenderPasses/ReflectiveShadowMapping/RSMSpotLightAccumulationRenderPass.h"
 #include "RenderPasses/DeferredSpotLightRenderPass.h"
 #include "RenderPasses/ShadowMap/DeferredSpotLightShadowMapRenderPass.h"
+#include "RenderPasses/ShadowMap/SpotLightShadowCastersCullingRenderPass.h"
 #include "RenderPasses/SpotLightContainerRenderVolumeCollection.h"
 
 #include "RenderPasses/IdleRenderPass.h"
@@ -46,6 +50,7 @@
 #include "RenderPasses/HighDynamicRange/HDRRenderPass.h"
 #include "RenderPasses/TextureLUT/TextureLUTRenderPass.h"
 #include "RenderPasses/GammaCorrection/GammaCorrectionRenderPass.h"
+#include "RenderPasses/PostProcess/PostProcessCompositorRenderPass.h"
 
 void ReflectiveShadowMappingRenderModule::Init ()
 {
@@ -81,6 +86,12 @@ void ReflectiveShadowMappingRenderModule::Init ()
 			.Build ())
 		.Attach (new RSMDirectionalLightRenderPass ())
 		.Build ());
+	_renderPasses.push_back (ContainerRenderPass::Builder ()
+		.Volume (new IterateOverRenderVolumeCollection (1))
+		.Attach (new LightClustersGenerationRenderPass ())
+		.Attach (new DeferredClusteredLightRenderPass ())
+		.Build ());
+	_renderPasses.push_back (new SpotLightShadowCastersCullingRenderPass ());
 	_renderPasses.push_back (ContainerRenderPass::Builder ()
 		.Volume (new SpotLightContainerRenderVolumeCollection ())
 		.Attach (new RSMSpotLightAccumulationRenderPass ())
@@ -113,6 +124,7 @@ void ReflectiveShadowMappingRenderModule::Init ()
 		.Attach (new HDRRenderPass ())
 		.Attach (new TextureLUTRenderPass ())
 		.Attach (new GammaCorrectionRenderPass ())
+		.Attach (new PostProcessCompositorRenderPass ())
 		.Attach (new DeferredBlitRenderPass ())
 		.Build ());
 	_renderPasses.push_back (new ForwardRenderPass ());
@@ -47,6 +47,7 @@
 #include "RenderPasses/HighDynamicRange/HDRRenderPass.h"
 #include "RenderPasses/TextureLUT/TextureLUTRenderPass.h"
 #include "RenderPasses/GammaCorrection/GammaCorrectionRenderPass.h"
+#include "RenderPasses/PostProcess/PostProcessCompositorRenderPass.h"
 
 void ScreenSpaceDirectionalOcclusionRenderModule::Init ()
 {
@@ -101,6 +102,7 @@ void ScreenSpaceDirectionalOcclusionRenderModule::Init ()
 		.Attach (new HDRRenderPass ())
 		.Attach (new TextureLUTRenderPass ())
 		.Attach (new GammaCorrectionRenderPass ())
+		.Attach (new PostProcessCompositorRenderPass ())
 		.Attach (new DeferredBlitRenderPass ())
 		.Build ());
 	_renderPasses.push_back (new ForwardRenderPass ());
@@ -4,10 +4,10 @@ bool BloomAccumulationRenderPass::IsAvailable (const RenderScene* renderScene, c
 	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
 {
 	/*
-	 * Check if bloom is enabled
+	 * Check if bloom is enabled and not fused in post process compositor
 	*/
 
-	return settings.bloom_enabled;
+	return settings.bloom_enabled && !settings.post_process_compositor_enabled;
 }
 
 std::string BloomAccumulationRenderPass::GetPostProcessFragmentShaderPath () const
@@ -0,0 +1,346 @@
+#include "GaussianBlurRenderPass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+
+#include "Renderer/Pipeline.h"
+
+#include "Resources/Resources.h"
+#include "Renderer/RenderSystem.h"
+
+#include "Debug/Profiler/Profiler.h"
+
+#include "Wrappers/OpenGL/GL.h"
+
+/*
+ * Formats the compute backend may write, with their image load store
+ * qualifier
+*/
+
+struct GaussianBlurFormat
+{
+	const char* name;
+	TEXTURE_SIZED_INTERNAL_FORMAT format;
+	GLenum imageFormat;
+	const char* imageQualifier;
+};
+
+static const GaussianBlurFormat gaussianBlurFormats [] = {
+	{ "RGBA16", FORMAT_RGBA16, GL_RGBA16F, "rgba16f" },
+	{ "RGBA32", FORMAT_RGBA32, GL_RGBA32F, "rgba32f" },
+	{ "R11G11B10F", FORMAT_R11G11B10F, GL_R11F_G11F_B10F, "r11f_g11f_b10f" }
+};
+
+static const GaussianBlurFormat& GetGaussianBlurFormat (const std::string& name)
+{
+	for (const GaussianBlurFormat& blurFormat : gaussianBlurFormats) {
+		if (name == blurFormat.name) {
+			return blurFormat;
+		}
+	}
+
+	return gaussianBlurFormats [0];
+}
+
+/*
+ * Binomial kernel truncated to the radius and normalized, as a list of
+ * the center and one side weights. Its row is chosen so the standard
+ * deviation is sqrt (3) / 4 of the radius, which gives the kernel the
+ * fragment backend always used for a radius of four.
+*/
+
+static std::string GetGaussianBlurWeights (std::size_t radius)
+{
+	std::size_t half = std::max (radius, (std::size_t) std::round (3.0 * radius * radius / 8.0));
+
+	std::vector<double> weights (radius + 1, 1.0);
+	double weightsSum = 1.0;
+
+	for (std::size_t index = 1; index <= radius; index ++) {
+		weights [index] = weights [index - 1] * (half - index + 1) / (half + index);
+		weightsSum += 2.0 * weights [index];
+	}
+
+	std::ostringstream stream;
+
+	stream << std::fixed << std::setprecision (8);
+
+	for (std::size_t index = 0; index <= radius; index ++) {
+		stream << (index > 0 ? ", " : "") << weights [index] / weightsSum;
+	}
+
+	return stream.str ();
+}
+
+GaussianBlurRenderPass::GaussianBlurRenderPass () :
+	_computeShaderView (nullptr),
+	_computeEnabled (false)
+{
+
+}
+
+void GaussianBlurRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Initialize post process render pass
+	*/
+
+	PostProcessRenderPass::Init (settings);
+
+	/*
+	 * Initialize compute shader if it is the selected backend
+	*/
+
+	_computeEnabled = settings.blur_compute_enabled;
+
+	if (_computeEnabled == true) {
+		UpdateComputeShader (settings);
+	}
+}
+
+void GaussianBlurRenderPass::StartPostProcessPass ()
+{
+	/*
+	 * Compute backend writes every pixel of the target
+	*/
+
+	if (_computeEnabled == true) {
+		return;
+	}
+
+	PostProcessRenderPass::StartPostProcessPass ();
+}
+
+void GaussianBlurRenderPass::PostProcessPass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Backends are timed on their own, so they can be compared in the
+	 * profiler under the same pass
+	*/
+
+	if (_computeEnabled == false) {
+		PROFILER_GPU_LOGGER("Fragment Gaussian Blur")
+
+		PostProcessRenderPass::PostProcessPass (renderScene, camera, settings, rvc);
+
+		return;
+	}
+
+	PROFILER_GPU_LOGGER("Compute Gaussian Blur")
+
+	ComputeBlurPass (camera, settings, rvc);
+}
+
+void GaussianBlurRenderPass::UpdatePostProcessSettings (const RenderSettings& settings)
+{
+	_computeEnabled = settings.blur_compute_enabled;
+
+	/*
+	 * Image load store needs the target in the format of the compute
+	 * backend
+	*/
+
+	auto texture = _postProcessMapVolume->GetFramebuffer ()->GetTexture (0);
+
+	if (texture->GetSizedInternalFormat () != GetBlurMapFormat (settings)) {
+
+		/*
+		 * Clear current post process volume
+		*/
+
+		delete _postProcessMapVolume;
+
+		/*
+		 * Initialize post process volume
+		*/
+
+		_postProcessMapVolume = CreatePostProcessVolume (settings);
+	}
+
+	/*
+	 * Update post process volume resolution
+	*/
+
+	PostProcessRenderPass::UpdatePostProcessSettings (settings);
+
+	/*
+	 * Update compute shader variant
+	*/
+
+	if (_computeEnabled == true) {
+		UpdateComputeShader (settings);
+	}
+}
+
+std::string GaussianBlurRenderPass::GetPostProcessVolumeName () const
+{
+	return "BlurMapVolume";
+}
+
+FramebufferRenderVolume* GaussianBlurRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+{
+	Resource<Texture> texture = Resource<Texture> (new Texture ("blurMap"));
+
+	glm::ivec2 size = GetPostProcessVolumeResolution (settings);
+
+	texture->SetSize (Size (size.x, size.y));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (GetBlurMapFormat (settings));
+	texture->SetInternalFormat (settings.blur_compute_enabled ? TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA : TEXTURE_INTERNAL_FORMAT::FORMAT_RGB);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetAnisotropicFiltering (false);
+
+	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
+
+	return new FramebufferRenderVolume (framebuffer);
+}
+
+std::vector<PipelineAttribute> GaussianBlurRenderPass::GetCustomAttributes (const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Attach post process volume attributes to pipeline
+	*/
+
+	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+
+	/*
+	 * Attach gaussian blur attributes to pipeline
+	*/
+
+	PipelineAttribute blurMapResolution;
+	PipelineAttribute blurDirection;
+
+	blurMapResolution.type = PipelineAttribute::AttrType::ATTR_2F;
+	blurDirection.type = PipelineAttribute::AttrType::ATTR_2I;
+
+	blurMapResolution.name = "blurMapResolution";
+	blurDirection.name = "blurDirection";
+
+	blurMapResolution.value = glm::vec3 (GetPostProcessVolumeResolution (settings), 0.0f);
+	blurDirection.value = glm::vec3 (GetBlurDirection (), 0.0f);
+
+	attributes.push_back (blurMapResolution);
+	attributes.push_back (blurDirection);
+
+	return attributes;
+}
+
+void GaussianBlurRenderPass::ComputeBlurPass (const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Bind compute shader and its source
+	*/
+
+	Pipeline::SetShader (_computeShaderView);
+
+	Pipeline::SendCustomAttributes (_computeShaderView, GetCustomAttributes (camera, settings, rvc));
+
+	/*
+	 * Bind post process volume for writing
+	*/
+
+	const GaussianBlurFormat& blurFormat = GetGaussianBlurFormat (settings.blur_format);
+
+	Pipeline::BindImageTexture (0, _postProcessMapVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex (),
+		0, false, 0, GL_WRITE_ONLY, blurFormat.imageFormat);
+
+	/*
+	 * Every work group blurs a 128 pixels segment of a line
+	*/
+
+	glm::ivec2 volumeResolution = GetPostProcessVolumeResolution (settings);
+	glm::ivec2 blurDirection = GetBlurDirection ();
+
+	std::size_t lineLength = blurDirection.x == 1 ? volumeResolution.x : volumeResolution.y;
+	std::size_t linesCount = blurDirection.x == 1 ? volumeResolution.y : volumeResolution.x;
+
+	GL::DispatchCompute ((lineLength + 127) / 128, linesCount, 1);
+
+	/*
+	 * Make sure writing to image has finished before read
+	*/
+
+	GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+void GaussianBlurRenderPass::UpdateComputeShader (const RenderSettings& settings)
+{
+	/*
+	 * Defines are rebuilt only when the settings feeding them change
+	*/
+
+	PostProcessDefinesKey computeDefinesKey = GetComputeDefinesKey (settings);
+
+	if (_computeShaderView != nullptr && computeDefinesKey == _computeDefinesKey) {
+		return;
+	}
+
+	_computeDefinesKey = computeDefinesKey;
+
+	/*
+	 * Radius, weights and format are compiled in the compute shader
+	*/
+
+	_computeDefines = GetComputeDefines (settings);
+
+	Resource<Shader> computeShader = Resources::LoadComputeShader (
+		"Assets/Shaders/Blur/gaussianBlurCompute.glsl", _computeDefines);
+
+	_computeShaderView = RenderSystem::LoadComputeShader (computeShader);
+}
+
+std::vector<std::string> GaussianBlurRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Kernel is compiled in the shader, the same for both backends
+	*/
+
+	std::size_t radius = GetBlurRadius (settings);
+
+	return {
+		"BLUR_RADIUS " + std::to_string (radius),
+		"BLUR_WEIGHTS " + GetGaussianBlurWeights (radius)
+	};
+}
+
+PostProcessDefinesKey GaussianBlurRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { GetBlurRadius (settings) };
+}
+
+std::vector<std::string> GaussianBlurRenderPass::GetComputeDefines (const RenderSettings& settings) const
+{
+	std::vector<std::string> defines = GetPostProcessDefines (settings);
+
+	defines.push_back ("BLUR_FORMAT " + std::string (GetGaussianBlurFormat (settings.blur_format).imageQualifier));
+
+	return defines;
+}
+
+PostProcessDefinesKey GaussianBlurRenderPass::GetComputeDefinesKey (const RenderSettings& settings) const
+{
+	const GaussianBlurFormat& blurFormat = GetGaussianBlurFormat (settings.blur_format);
+
+	return { GetBlurRadius (settings), (std::size_t) (&blurFormat - gaussianBlurFormats) };
+}
+
+std::size_t GaussianBlurRenderPass::GetBlurRadius (const RenderSettings& settings) const
+{
+	return std::min (settings.blur_radius, (std::size_t) GAUSSIAN_BLUR_MAX_RADIUS);
+}
+
+TEXTURE_SIZED_INTERNAL_FORMAT GaussianBlurRenderPass::GetBlurMapFormat (const RenderSettings& settings) const
+{
+	if (settings.blur_compute_enabled == false) {
+		return TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGB16;
+	}
+
+	return GetGaussianBlurFormat (settings.blur_format).format;
+}
@@ -0,0 +1,60 @@
+#ifndef GAUSSIANBLURRENDERPASS_H
+#define GAUSSIANBLURRENDERPASS_H
+
+#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+
+/*
+ * Widest kernel of the compute backend, its apron is kept in shared
+ * memory next to the work group segment
+*/
+
+#define GAUSSIAN_BLUR_MAX_RADIUS 64
+
+/*
+ * Separable gaussian blur along one direction. The fragment backend
+ * samples the source once per tap, while the compute backend loads a
+ * segment of every line in shared memory once and applies the kernel
+ * from there, writing a target of the configured format. Both backends
+ * apply the same kernel of the configured radius.
+*/
+
+class ENGINE_API GaussianBlurRenderPass : public PostProcessRenderPass
+{
+protected:
+	Resource<ShaderView> _computeShaderView;
+	std::vector<std::string> _computeDefines;
+	PostProcessDefinesKey _computeDefinesKey;
+	bool _computeEnabled;
+
+public:
+	GaussianBlurRenderPass ();
+
+	void Init (const RenderSettings& settings);
+protected:
+	void StartPostProcessPass ();
+	void PostProcessPass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	void UpdatePostProcessSettings (const RenderSettings& settings);
+
+	std::string GetPostProcessVolumeName () const;
+	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+
+	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	virtual glm::ivec2 GetBlurDirection () const = 0;
+
+	void ComputeBlurPass (const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc);
+	void UpdateComputeShader (const RenderSettings& settings);
+
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
+
+	std::vector<std::string> GetComputeDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetComputeDefinesKey (const RenderSettings& settings) const;
+	std::size_t GetBlurRadius (const RenderSettings& settings) const;
+	TEXTURE_SIZED_INTERNAL_FORMAT GetBlurMapFormat (const RenderSettings& settings) const;
+};
+
+#endif
\ No newline at end of file
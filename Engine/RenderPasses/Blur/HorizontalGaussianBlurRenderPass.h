@@ -1,17 +1,14 @@
 #ifndef HORIZONTALGAUSSIANBLURRENDERPASS_H
 #define HORIZONTALGAUSSIANBLURRENDERPASS_H
 
-#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+#include "GaussianBlurRenderPass.h"
 
-class ENGINE_API HorizontalGaussianBlurRenderPass : public PostProcessRenderPass
+class ENGINE_API HorizontalGaussianBlurRenderPass : public GaussianBlurRenderPass
 {
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
-	std::string GetPostProcessVolumeName () const;	
-	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
 
-	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
-		const RenderSettings& settings, RenderVolumeCollection* rvc);
+	glm::ivec2 GetBlurDirection () const;
 };
 
 #endif
\ No newline at end of file
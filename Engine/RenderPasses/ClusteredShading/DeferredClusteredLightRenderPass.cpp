@@ -0,0 +1,163 @@
+#include "DeferredClusteredLightRenderPass.h"
+
+#include "RenderPasses/GBuffer.h"
+#include "RenderPasses/FramebufferRenderVolume.h"
+
+#include "Renderer/Pipeline.h"
+
+#include "Resources/Resources.h"
+#include "Renderer/RenderSystem.h"
+
+void DeferredClusteredLightRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Shader for every light without shadow casting
+	*/
+
+	Resource<Shader> shader = Resources::LoadShader ({
+		"Assets/Shaders/PostProcess/postProcessVertex.glsl",
+		"Assets/Shaders/ClusteredShading/deferredClusteredLightFragment.glsl"
+	});
+
+	_shaderView = RenderSystem::LoadShader (shader);
+}
+
+RenderVolumeCollection* DeferredClusteredLightRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Bind light accumulation volume
+	*/
+
+	StartClusteredLightPass (rvc);
+
+	/*
+	 * Draw all clustered lights
+	*/
+
+	ClusteredLightPass (renderScene, camera, settings, rvc);
+
+	/*
+	 * End clustered light pass
+	*/
+
+	EndClusteredLightPass ();
+
+	return rvc;
+}
+
+bool DeferredClusteredLightRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Check if clustered lighting is enabled
+	*/
+
+	return settings.clustered_lighting_enabled;
+}
+
+void DeferredClusteredLightRenderPass::Clear ()
+{
+	/*
+	 * Nothing
+	*/
+}
+
+void DeferredClusteredLightRenderPass::StartClusteredLightPass (RenderVolumeCollection* rvc)
+{
+	/*
+	 * Bind light accumulation framebuffer for writing
+	*/
+
+	auto resultVolume = (FramebufferRenderVolume*) rvc->GetRenderVolume ("ResultFramebufferRenderVolume");
+
+	resultVolume->GetFramebufferView ()->Activate ();
+}
+
+void DeferredClusteredLightRenderPass::ClusteredLightPass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Lock clustered light shader
+	*/
+
+	Pipeline::LockShader (_shaderView);
+
+	/*
+	 * Set viewport
+	*/
+
+	GL::Viewport (settings.viewport.x, settings.viewport.y,
+		settings.viewport.width, settings.viewport.height);
+
+	/*
+	 * Shade only fragments where something is drawn in GBuffer
+	*/
+
+	GL::Enable (GL_STENCIL_TEST);
+	GL::StencilFunc (GL_EQUAL, 1, 0xFF);
+	GL::StencilOp (GL_KEEP, GL_KEEP, GL_KEEP);
+
+	GL::Disable (GL_DEPTH_TEST);
+	GL::DepthMask (GL_FALSE);
+
+	/*
+	 * Add lights on top of the already accumulated light
+	*/
+
+	GL::Enable (GL_BLEND);
+	GL::BlendEquation (GL_FUNC_ADD);
+	GL::BlendFunc (GL_ONE, GL_ONE);
+
+	GL::Disable (GL_CULL_FACE);
+
+	/*
+	 * Send camera to pipeline
+	*/
+
+	Pipeline::CreateProjection (((GBuffer*) rvc->GetRenderVolume ("GBuffer"))->GetProjectionMatrix ());
+	Pipeline::SendCamera (camera);
+	Pipeline::SetObjectTransform (Transform::Default ());
+
+	Pipeline::UpdateMatrices (nullptr);
+
+	/*
+	 * Send custom attributes
+	*/
+
+	Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (rvc));
+
+	/*
+	 * Draw a screen covering triangle
+	*/
+
+	GL::DrawArrays (GL_TRIANGLES, 0, 3);
+}
+
+void DeferredClusteredLightRenderPass::EndClusteredLightPass ()
+{
+	/*
+	 * Unlock current locked shader for further rendering
+	*/
+
+	Pipeline::UnlockShader ();
+
+	GL::Disable (GL_STENCIL_TEST);
+}
+
+std::vector<PipelineAttribute> DeferredClusteredLightRenderPass::GetCustomAttributes (RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Attach all volume attributes to pipeline
+	*/
+
+	std::vector<PipelineAttribute> attributes;
+
+	for (RenderVolumeI* renderVolume : *rvc) {
+		auto& volumeAttributes = renderVolume->GetCustomAttributes ();
+
+		attributes.insert (attributes.end (), volumeAttributes.begin (), volumeAttributes.end ());
+	}
+
+	return attributes;
+}
@@ -0,0 +1,36 @@
+#ifndef DEFERREDCLUSTEREDLIGHTRENDERPASS_H
+#define DEFERREDCLUSTEREDLIGHTRENDERPASS_H
+
+#include "RenderPasses/Container/ContainerRenderSubPassI.h"
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/RenderViews/ShaderView.h"
+
+#include "Renderer/PipelineAttribute.h"
+
+class ENGINE_API DeferredClusteredLightRenderPass : public ContainerRenderSubPassI
+{
+	DECLARE_RENDER_PASS(DeferredClusteredLightRenderPass)
+
+protected:
+	Resource<ShaderView> _shaderView;
+
+public:
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void Clear ();
+protected:
+	void StartClusteredLightPass (RenderVolumeCollection* rvc);
+	void ClusteredLightPass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+	void EndClusteredLightPass ();
+
+	std::vector<PipelineAttribute> GetCustomAttributes (RenderVolumeCollection* rvc) const;
+};
+
+#endif
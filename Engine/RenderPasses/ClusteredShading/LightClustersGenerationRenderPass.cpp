@@ -0,0 +1,338 @@
+#include "LightClustersGenerationRenderPass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "Core/Intersections/FrustumVolume.h"
+
+#include "RenderPasses/GBuffer.h"
+
+#include "Utils/Extensions/MathExtend.h"
+
+static bool IsSphereInFrustum (const FrustumVolume& frustum, const glm::vec3& center, float radius)
+{
+	for (std::size_t i = 0; i < FrustumVolume::PLANESCOUNT; i++) {
+		glm::vec3 normal = glm::vec3 (frustum.plane [i]);
+
+		float distance = (glm::dot (normal, center) + frustum.plane [i].w) / glm::length (normal);
+
+		if (distance < -radius) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool IsSphereIntersectingAABB (const glm::vec3& center, float radius, const AABBVolume& aabb)
+{
+	glm::vec3 closestPoint = glm::clamp (center, aabb.minVertex, aabb.maxVertex);
+	glm::vec3 delta = closestPoint - center;
+
+	return glm::dot (delta, delta) <= radius * radius;
+}
+
+LightClustersGenerationRenderPass::LightClustersGenerationRenderPass () :
+	_lightClustersVolume (nullptr)
+{
+
+}
+
+void LightClustersGenerationRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Initialize light clusters volume
+	*/
+
+	_lightClustersVolume = new LightClustersVolume ();
+}
+
+RenderVolumeCollection* LightClustersGenerationRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	glm::ivec3 gridSize (settings.clustered_lighting_width,
+		settings.clustered_lighting_height, settings.clustered_lighting_depth);
+
+	/*
+	 * Use the same projection as the geometry pass, so clusters
+	 * match the shaded pixels
+	*/
+
+	glm::mat4 projectionMatrix = ((GBuffer*) rvc->GetRenderVolume ("GBuffer"))->GetProjectionMatrix ();
+
+	/*
+	 * Update froxel grid
+	*/
+
+	UpdateClusterVolumes (gridSize, projectionMatrix, camera);
+
+	/*
+	 * Cull lights outside camera frustum
+	*/
+
+	CollectLights (renderScene, camera, projectionMatrix);
+
+	/*
+	 * Assign lights to clusters and upload them
+	*/
+
+	BinLights (gridSize, projectionMatrix, camera);
+
+	_lightClustersVolume->Update (gridSize, _lights, _clusters, _lightIndices);
+
+	return rvc->Insert ("LightClustersVolume", _lightClustersVolume);
+}
+
+bool LightClustersGenerationRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Check if clustered lighting is enabled
+	*/
+
+	return settings.clustered_lighting_enabled;
+}
+
+void LightClustersGenerationRenderPass::Clear ()
+{
+	/*
+	 * Clear light clusters volume
+	*/
+
+	delete _lightClustersVolume;
+}
+
+void LightClustersGenerationRenderPass::UpdateClusterVolumes (const glm::ivec3& gridSize,
+	const glm::mat4& projectionMatrix, const Camera* camera)
+{
+	_clusterVolumes.resize (gridSize.x * gridSize.y * gridSize.z);
+
+	/*
+	 * Bounding box of the view space froxel of every cluster
+	*/
+
+	for (int slice = 0; slice < gridSize.z; slice ++) {
+		float sliceDepth [2] = {
+			GetSliceDepth (slice, gridSize.z, camera),
+			GetSliceDepth (slice + 1, gridSize.z, camera)
+		};
+
+		for (int y = 0; y < gridSize.y; y ++) {
+			float tileY [2] = {
+				-1.0f + 2.0f * y / gridSize.y,
+				-1.0f + 2.0f * (y + 1) / gridSize.y
+			};
+
+			for (int x = 0; x < gridSize.x; x ++) {
+				float tileX [2] = {
+					-1.0f + 2.0f * x / gridSize.x,
+					-1.0f + 2.0f * (x + 1) / gridSize.x
+				};
+
+				AABBVolume clusterVolume;
+
+				for (float depth : sliceDepth) {
+					for (float ndcY : tileY) {
+						for (float ndcX : tileX) {
+							glm::vec3 point (
+								(ndcX + projectionMatrix [2][0]) * depth / projectionMatrix [0][0],
+								(ndcY + projectionMatrix [2][1]) * depth / projectionMatrix [1][1],
+								-depth
+							);
+
+							clusterVolume.minVertex = glm::min (clusterVolume.minVertex, point);
+							clusterVolume.maxVertex = glm::max (clusterVolume.maxVertex, point);
+						}
+					}
+				}
+
+				_clusterVolumes [x + gridSize.x * (y + gridSize.y * slice)] = clusterVolume;
+			}
+		}
+	}
+}
+
+void LightClustersGenerationRenderPass::CollectLights (const RenderScene* renderScene,
+	const Camera* camera, const glm::mat4& projectionMatrix)
+{
+	_lights.clear ();
+
+	glm::mat4 viewMatrix = glm::mat4_cast (camera->GetRotation ());
+	viewMatrix = glm::translate (viewMatrix, camera->GetPosition () * -1.0f);
+
+	FrustumVolume frustum (projectionMatrix);
+
+	/*
+	 * Lights casting shadows are still drawn one by one
+	*/
+
+	for_each_type (RenderPointLightObject*, renderPointLightObject, *renderScene) {
+		if (renderPointLightObject->IsActive () == false || renderPointLightObject->IsCastingShadows () == true) {
+			continue;
+		}
+
+		glm::vec3 lightPosition = glm::vec3 (viewMatrix * glm::vec4 (renderPointLightObject->GetTransform ()->GetPosition (), 1.0f));
+		float lightRange = renderPointLightObject->GetLightRange ();
+
+		if (IsSphereInFrustum (frustum, lightPosition, lightRange) == false) {
+			continue;
+		}
+
+		ClusteredLight light;
+
+		light.positionRange = glm::vec4 (lightPosition, lightRange);
+		light.colorIntensity = glm::vec4 (renderPointLightObject->GetLightColor ().ToVector3 (), renderPointLightObject->GetLightIntensity ());
+		light.directionType = glm::vec4 (0.0f, 0.0f, -1.0f, CLUSTERED_LIGHT_POINT);
+		light.spotCutoffs = glm::vec4 (0.0f);
+
+		_lights.push_back (light);
+	}
+
+	for_each_type (RenderSpotLightObject*, renderSpotLightObject, *renderScene) {
+		if (renderSpotLightObject->IsActive () == false || renderSpotLightObject->IsCastingShadows () == true) {
+			continue;
+		}
+
+		glm::vec3 lightPosition = glm::vec3 (viewMatrix * glm::vec4 (renderSpotLightObject->GetTransform ()->GetPosition (), 1.0f));
+		float lightRange = renderSpotLightObject->GetLightRange ();
+
+		if (IsSphereInFrustum (frustum, lightPosition, lightRange) == false) {
+			continue;
+		}
+
+		glm::vec3 lightDirection = renderSpotLightObject->GetTransform ()->GetRotation () * glm::vec3 (0, 0, -1);
+		lightDirection = glm::normalize (glm::vec3 (viewMatrix * glm::vec4 (lightDirection, 0.0f)));
+
+		ClusteredLight light;
+
+		light.positionRange = glm::vec4 (lightPosition, lightRange);
+		light.colorIntensity = glm::vec4 (renderSpotLightObject->GetLightColor ().ToVector3 (), renderSpotLightObject->GetLightIntensity ());
+		light.directionType = glm::vec4 (lightDirection, CLUSTERED_LIGHT_SPOT);
+		light.spotCutoffs = glm::vec4 (
+			std::cos (DEG2RAD * renderSpotLightObject->GetLightSpotCutoff ()),
+			std::cos (DEG2RAD * renderSpotLightObject->GetLightSpotOuterCutoff ()),
+			0.0f, 0.0f);
+
+		_lights.push_back (light);
+	}
+}
+
+void LightClustersGenerationRenderPass::BinLights (const glm::ivec3& gridSize,
+	const glm::mat4& projectionMatrix, const Camera* camera)
+{
+	_clusterLights.clear ();
+
+	float zNear = camera->GetZNear ();
+	float zFar = camera->GetZFar ();
+
+	for (std::size_t lightIndex = 0; lightIndex < _lights.size (); lightIndex ++) {
+		glm::vec3 center = glm::vec3 (_lights [lightIndex].positionRange);
+		float radius = _lights [lightIndex].positionRange.w;
+
+		/*
+		 * Slices range from the light depth range
+		*/
+
+		float minDepth = -center.z - radius;
+		float maxDepth = -center.z + radius;
+
+		int minSlice = GetSlice (std::max (minDepth, zNear), gridSize.z, camera);
+		int maxSlice = GetSlice (std::min (maxDepth, zFar), gridSize.z, camera);
+
+		/*
+		 * Tiles range from the projected light bounding box. When the
+		 * box crosses the near plane, every tile is a candidate.
+		*/
+
+		glm::ivec2 minTile (0);
+		glm::ivec2 maxTile (gridSize.x - 1, gridSize.y - 1);
+
+		if (minDepth > zNear) {
+			glm::vec2 minNDC (1.0f);
+			glm::vec2 maxNDC (-1.0f);
+
+			for (std::size_t corner = 0; corner < 8; corner ++) {
+				glm::vec3 point = center + radius * glm::vec3 (
+					corner & 1 ? 1.0f : -1.0f,
+					corner & 2 ? 1.0f : -1.0f,
+					corner & 4 ? 1.0f : -1.0f
+				);
+
+				glm::vec4 clipPoint = projectionMatrix * glm::vec4 (point, 1.0f);
+				glm::vec2 ndcPoint = glm::vec2 (clipPoint) / clipPoint.w;
+
+				minNDC = glm::min (minNDC, ndcPoint);
+				maxNDC = glm::max (maxNDC, ndcPoint);
+			}
+
+			glm::vec2 tilesCount = glm::vec2 (gridSize.x, gridSize.y);
+
+			minTile = glm::clamp (glm::ivec2 (glm::floor ((minNDC * 0.5f + 0.5f) * tilesCount)), glm::ivec2 (0), maxTile);
+			maxTile = glm::clamp (glm::ivec2 (glm::floor ((maxNDC * 0.5f + 0.5f) * tilesCount)), glm::ivec2 (0), maxTile);
+		}
+
+		for (int slice = minSlice; slice <= maxSlice; slice ++) {
+			for (int y = minTile.y; y <= maxTile.y; y ++) {
+				for (int x = minTile.x; x <= maxTile.x; x ++) {
+					unsigned int clusterIndex = x + gridSize.x * (y + gridSize.y * slice);
+
+					if (IsSphereIntersectingAABB (center, radius, _clusterVolumes [clusterIndex])) {
+						_clusterLights.push_back (std::make_pair (clusterIndex, (unsigned int) lightIndex));
+					}
+				}
+			}
+		}
+	}
+
+	/*
+	 * Counting sort of light indices by cluster. Every cluster
+	 * stores its offset and lights count.
+	*/
+
+	std::size_t clustersCount = gridSize.x * gridSize.y * gridSize.z;
+
+	_clusters.assign (clustersCount * 2, 0);
+
+	for (const auto& clusterLight : _clusterLights) {
+		_clusters [clusterLight.first * 2 + 1] ++;
+	}
+
+	unsigned int offset = 0;
+
+	for (std::size_t clusterIndex = 0; clusterIndex < clustersCount; clusterIndex ++) {
+		_clusters [clusterIndex * 2] = offset;
+		offset += _clusters [clusterIndex * 2 + 1];
+		_clusters [clusterIndex * 2 + 1] = 0;
+	}
+
+	_lightIndices.resize (_clusterLights.size ());
+
+	for (const auto& clusterLight : _clusterLights) {
+		unsigned int& lightsCount = _clusters [clusterLight.first * 2 + 1];
+
+		_lightIndices [_clusters [clusterLight.first * 2] + lightsCount] = clusterLight.second;
+
+		lightsCount ++;
+	}
+}
+
+float LightClustersGenerationRenderPass::GetSliceDepth (int slice, int slicesCount, const Camera* camera) const
+{
+	float zNear = camera->GetZNear ();
+	float zFar = camera->GetZFar ();
+
+	return zNear * std::pow (zFar / zNear, (float) slice / slicesCount);
+}
+
+int LightClustersGenerationRenderPass::GetSlice (float depth, int slicesCount, const Camera* camera) const
+{
+	float zNear = camera->GetZNear ();
+	float zFar = camera->GetZFar ();
+
+	int slice = (int) std::floor (std::log (depth / zNear) / std::log (zFar / zNear) * slicesCount);
+
+	return std::min (std::max (slice, 0), slicesCount - 1);
+}
@@ -0,0 +1,52 @@
+#ifndef LIGHTCLUSTERSGENERATIONRENDERPASS_H
+#define LIGHTCLUSTERSGENERATIONRENDERPASS_H
+
+#include "RenderPasses/Container/ContainerRenderSubPassI.h"
+
+#include <vector>
+#include <glm/mat4x4.hpp>
+
+#include "Core/Intersections/AABBVolume.h"
+
+#include "LightClustersVolume.h"
+
+/*
+ * Bin lights without shadows into a view space froxel grid. Tiles
+ * divide the screen uniformly, slices divide the depth exponentially
+ * between camera near and far planes.
+*/
+
+class ENGINE_API LightClustersGenerationRenderPass : public ContainerRenderSubPassI
+{
+	DECLARE_RENDER_PASS(LightClustersGenerationRenderPass)
+
+protected:
+	LightClustersVolume* _lightClustersVolume;
+
+	std::vector<AABBVolume> _clusterVolumes;
+	std::vector<ClusteredLight> _lights;
+	std::vector<unsigned int> _clusters;
+	std::vector<unsigned int> _lightIndices;
+	std::vector<std::pair<unsigned int, unsigned int>> _clusterLights;
+
+public:
+	LightClustersGenerationRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void Clear ();
+protected:
+	void UpdateClusterVolumes (const glm::ivec3& gridSize, const glm::mat4& projectionMatrix, const Camera* camera);
+	void CollectLights (const RenderScene* renderScene, const Camera* camera, const glm::mat4& projectionMatrix);
+	void BinLights (const glm::ivec3& gridSize, const glm::mat4& projectionMatrix, const Camera* camera);
+
+	float GetSliceDepth (int slice, int slicesCount, const Camera* camera) const;
+	int GetSlice (float depth, int slicesCount, const Camera* camera) const;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include "LightClustersVolume.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Renderer/PersistentRingBuffer.h"
+
+#include "Wrappers/OpenGL/GL.h"
+
+LightClustersVolume::LightClustersVolume () :
+	_lightsSSBO (0),
+	_clustersSSBO (0),
+	_lightIndicesSSBO (0),
+	_gridSize (0)
+{
+	GL::GenBuffers (1, &_lightsSSBO);
+	GL::GenBuffers (1, &_clustersSSBO);
+	GL::GenBuffers (1, &_lightIndicesSSBO);
+}
+
+LightClustersVolume::~LightClustersVolume ()
+{
+	GL::DeleteBuffers (1, &_lightsSSBO);
+	GL::DeleteBuffers (1, &_clustersSSBO);
+	GL::DeleteBuffers (1, &_lightIndicesSSBO);
+}
+
+void LightClustersVolume::Update (const glm::ivec3& gridSize, const std::vector<ClusteredLight>& lights,
+	const std::vector<unsigned int>& clusters, const std::vector<unsigned int>& lightIndices)
+{
+	_gridSize = gridSize;
+
+	/*
+	 * Update attributes
+	*/
+
+	_attributes.clear ();
+
+	PipelineAttribute clusterGridSize;
+
+	clusterGridSize.type = PipelineAttribute::AttrType::ATTR_3I;
+	clusterGridSize.name = "clusterGridSize";
+	clusterGridSize.value = glm::vec3 (_gridSize);
+
+	_attributes.push_back (UploadStorageBlock ("clusteredLights", _lightsSSBO, 0,
+		lights.data (), sizeof (ClusteredLight) * lights.size ()));
+	_attributes.push_back (UploadStorageBlock ("lightClusters", _clustersSSBO, 1,
+		clusters.data (), sizeof (unsigned int) * clusters.size ()));
+	_attributes.push_back (UploadStorageBlock ("clusteredLightIndices", _lightIndicesSSBO, 2,
+		lightIndices.data (), sizeof (unsigned int) * lightIndices.size ()));
+	_attributes.push_back (clusterGridSize);
+}
+
+const std::vector<PipelineAttribute>& LightClustersVolume::GetCustomAttributes () const
+{
+	return _attributes;
+}
+
+PipelineAttribute LightClustersVolume::UploadStorageBlock (const std::string& name, unsigned int ssbo,
+	std::size_t binding, const void* data, std::size_t size)
+{
+	PipelineAttribute attribute;
+
+	attribute.type = PipelineAttribute::AttrType::ATTR_STORAGE_BLOCK;
+	attribute.name = name;
+
+	/*
+	 * Keep blocks at least one element long, empty storage blocks
+	 * are not valid
+	*/
+
+	std::size_t blockSize = std::max<std::size_t> (size, sizeof (glm::vec4));
+
+	/*
+	 * Data changes every frame, write it in the ring buffer and bind
+	 * only the range of this frame
+	*/
+
+	RingBufferAllocation allocation;
+
+	if (PersistentRingBuffer::Allocate (GL_SHADER_STORAGE_BUFFER, blockSize, allocation) == true) {
+		if (size > 0) {
+			std::memcpy (allocation.data, data, size);
+		}
+
+		attribute.value = glm::vec3 (allocation.buffer, binding, 0);
+		attribute.offset = allocation.offset;
+		attribute.size = allocation.size;
+
+		return attribute;
+	}
+
+	/*
+	 * Otherwise respecify the buffer of the volume
+	*/
+
+	GL::BindBuffer (GL_SHADER_STORAGE_BUFFER, ssbo);
+	GL::BufferData (GL_SHADER_STORAGE_BUFFER, blockSize, nullptr, GL_STREAM_DRAW);
+	GL::BufferSubData (GL_SHADER_STORAGE_BUFFER, 0, size, data);
+	GL::BindBuffer (GL_SHADER_STORAGE_BUFFER, 0);
+
+	attribute.value = glm::vec3 (ssbo, binding, 0);
+
+	return attribute;
+}
@@ -0,0 +1,49 @@
+#ifndef LIGHTCLUSTERSVOLUME_H
+#define LIGHTCLUSTERSVOLUME_H
+
+#include "Renderer/RenderVolumeI.h"
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+/*
+ * Light as it is read by clustered lighting shader (std430 layout).
+ * Position and direction are in view space.
+*/
+
+struct ClusteredLight
+{
+	glm::vec4 positionRange;
+	glm::vec4 colorIntensity;
+	glm::vec4 directionType;
+	glm::vec4 spotCutoffs;
+};
+
+#define CLUSTERED_LIGHT_POINT 0
+#define CLUSTERED_LIGHT_SPOT 1
+
+class ENGINE_API LightClustersVolume : public RenderVolumeI
+{
+protected:
+	unsigned int _lightsSSBO;
+	unsigned int _clustersSSBO;
+	unsigned int _lightIndicesSSBO;
+
+	glm::ivec3 _gridSize;
+
+	std::vector<PipelineAttribute> _attributes;
+
+public:
+	LightClustersVolume ();
+	~LightClustersVolume ();
+
+	void Update (const glm::ivec3& gridSize, const std::vector<ClusteredLight>& lights,
+		const std::vector<unsigned int>& clusters, const std::vector<unsigned int>& lightIndices);
+
+	const std::vector<PipelineAttribute>& GetCustomAttributes () const;
+protected:
+	PipelineAttribute UploadStorageBlock (const std::string& name, unsigned int ssbo,
+		std::size_t binding, const void* data, std::size_t size);
+};
+
+#endif
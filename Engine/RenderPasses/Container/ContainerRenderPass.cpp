@@ -1,5 +1,7 @@
 #include "ContainerRenderPass.h"
 
+#include "Renderer/FrameGraph.h"
+
 #include "Debug/Profiler/Profiler.h"
 
 ContainerRenderPass::ContainerRenderPass (
@@ -78,6 +80,17 @@ bool ContainerRenderPass::IsAvailable (const RenderScene* renderScene, const Cam
 	return true;
 }
 
+void ContainerRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Collect the mip levels of every sub pass
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		renderSubPass->DeclareGBufferMips (settings, requirements);
+	}
+}
+
 void ContainerRenderPass::Clear ()
 {
 	/*
@@ -105,12 +118,16 @@ RenderVolumeCollection* ContainerRenderPass::IterateOverSubPasses (
 	 * In this way it could be obtained at pass execution
 	*/
 
-	rvc->Insert ("SubpassVolume", volume, false);
+	static RenderVolumeHandle subpassVolumeHandle = RenderVolumeCollection::GetHandle ("SubpassVolume");
+
+	rvc->Insert (subpassVolumeHandle, volume, false);
 
 	/*
 	 * Iterate all sub passes
 	*/
 
+	FrameGraph* frameGraph = rvc->GetFrameGraph ();
+
 	for (auto renderSubPass : _renderSubPasses) {
 
 		PROFILER_LOGGER(renderSubPass->GetName ())
@@ -124,11 +141,23 @@ RenderVolumeCollection* ContainerRenderPass::IterateOverSubPasses (
 			continue;
 		}
 
+		/*
+		 * Skip sub pass if culled by the frame graph
+		*/
+
+		if (frameGraph != nullptr && frameGraph->BeginPass (renderSubPass) == false) {
+			continue;
+		}
+
 		/*
 		 * Execute render sub pass
 		*/
 
 		rvc = renderSubPass->Execute (renderScene, camera, settings, rvc);
+
+		if (frameGraph != nullptr) {
+			frameGraph->EndPass ();
+		}
 	}
 
 	return rvc;
@@ -31,6 +31,8 @@ public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
 
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
+
 	void Clear ();
 
 	static ContainerRenderPassBuilder Builder ();
@@ -10,17 +10,22 @@
 #include "Core/Intersections/Intersection.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/LevelOfDetailSelection.h"
+#include "Renderer/RenderWorkers.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
 #include "Debug/Profiler/Profiler.h"
 #include "Debug/Statistics/StatisticsManager.h"
 #include "RenderStatisticsObject.h"
+#include "GBufferStatisticsObject.h"
 
 #include "Core/Console/Console.h"
 
 #include "SceneNodes/SceneLayer.h"
 
+#define DEFERRED_GEOMETRY_OBJECTS_PER_TASK 64
+
 DeferredGeometryRenderPass::DeferredGeometryRenderPass () :
 	_framebuffer (nullptr),
 	_translucencyFramebuffer (nullptr),
@@ -84,6 +89,16 @@ void DeferredGeometryRenderPass::Init (const RenderSettings& settings)
 
 	_animationShaderView = RenderSystem::LoadShader (animationShader);
 
+	/*
+	 * Shader for GBuffer mipmaps
+	*/
+
+	Resource<Shader> mipmapShader = Resources::LoadComputeShader (
+		"Assets/Shaders/gBufferMipmapCompute.glsl"
+	);
+
+	_mipmapShaderView = RenderSystem::LoadComputeShader (mipmapShader);
+
 	/*
 	 * Initialize GBuffer volume
 	*/
@@ -112,6 +127,14 @@ RenderVolumeCollection* DeferredGeometryRenderPass::Execute (const RenderScene*
 
 	PrepareDrawing ();
 
+	/*
+	 * Rasterize occluders on CPU
+	*/
+
+	if (settings.occlusion_culling_enabled == true) {
+		OcclusionPass (renderScene, camera, settings);
+	}
+
 	/*
 	* Deferred Rendering: Geometry Pass
 	*/
@@ -125,10 +148,10 @@ RenderVolumeCollection* DeferredGeometryRenderPass::Execute (const RenderScene*
 	EndDrawing ();
 
 	/*
-	 * Generate mipmaps
+	 * Generate the mipmaps sampled by further passes
 	*/
 
-	GenerateMipmaps ();
+	GenerateMipmaps (rvc);
 
 	return rvc->Insert ("GBuffer", _framebuffer)
 				->Insert ("TranslucencyGBuffer", _translucencyFramebuffer);
@@ -175,6 +198,58 @@ void DeferredGeometryRenderPass::PrepareDrawing ()
 	GL::Clear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 }
 
+void DeferredGeometryRenderPass::OcclusionPass (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings)
+{
+	/*
+	 * Update depth buffer resolution
+	*/
+
+	if (_occlusionCulling.GetWidth () != settings.occlusion_culling_width ||
+		_occlusionCulling.GetHeight () != settings.occlusion_culling_height) {
+		_occlusionCulling.SetResolution (settings.occlusion_culling_width, settings.occlusion_culling_height);
+	}
+
+	/*
+	 * Use the same view projection as the frustum volume
+	*/
+
+	glm::mat4 viewMatrix = glm::mat4_cast (camera->GetRotation ());
+	viewMatrix = glm::translate (viewMatrix, camera->GetPosition () * -1.0f);
+
+	_occlusionCulling.Begin (camera->GetProjectionMatrix () * viewMatrix);
+
+	/*
+	 * Attach visible occluders
+	*/
+
+	auto frustum = camera->GetFrustumVolume ();
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		if (renderObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+			continue;
+		}
+
+		if (renderObject->GetOccluderMesh () == nullptr) {
+			continue;
+		}
+
+		auto& boundingBox = renderObject->GetBoundingBox ();
+		if (!Intersection::Instance ()->CheckFrustumVsAABB (frustum, boundingBox)) {
+			continue;
+		}
+
+		_occlusionCulling.AttachOccluder (*renderObject->GetOccluderMesh (),
+			renderObject->GetTransform ()->GetModelMatrix ());
+	}
+
+	_occlusionCulling.Rasterize ();
+}
+
 void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings)
 {
 	/*
@@ -214,16 +289,11 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 	GL::Disable (GL_BLEND);
 
 	/*
-	* Render scene entities to framebuffer at Deferred Rendering Stage
+	 * Collect candidates. Scene containers are walked on this thread,
+	 * only the per object work is split between render workers.
 	*/
 
-	// std::vector<Renderer*> renderers;
-
-	auto frustum = camera->GetFrustumVolume ();
-
-	std::size_t drawnVerticesCount = 0;
-	std::size_t drawnPolygonsCount = 0;
-	std::size_t drawnObjectsCount = 0;
+	_renderObjects.clear ();
 
 	for_each_type (RenderObject*, renderObject, *renderScene) {
 
@@ -239,36 +309,88 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 			continue;
 		}
 
-		/*
-		* Culling Check
-		*/
+		_renderObjects.push_back (renderObject);
+	}
 
-		auto& boundingBox = renderObject->GetBoundingBox ();
-		if (!Intersection::Instance ()->CheckFrustumVsAABB (frustum, boundingBox)) {
-			continue;
-		}
+	/*
+	 * Record draw commands in parallel
+	*/
 
-		drawnVerticesCount += renderObject->GetModelView ()->GetVerticesCount ();
-		drawnPolygonsCount += renderObject->GetModelView ()->GetPolygonsCount ();
-		drawnObjectsCount++;
+	std::size_t tasksCount = RenderWorkers::GetTasksCount (_renderObjects.size (), DEFERRED_GEOMETRY_OBJECTS_PER_TASK);
 
-		/*
-		* Deferred Rendering: Prepare for rendering
-		*/
+	if (_recordingTasks.size () < tasksCount) {
+		_recordingTasks.resize (tasksCount);
+	}
 
-		BindFrameBuffer (renderObject->GetSceneLayers ());
+	auto frustum = camera->GetFrustumVolume ();
 
-		/*
-		 * Lock shader according to object layers
-		*/
+	Intersection* intersection = Intersection::Instance ();
 
-		LockShader (renderObject->GetSceneLayers ());
+	RenderWorkers::Execute (tasksCount, [&] (std::size_t taskIndex) {
+		std::size_t begin = _renderObjects.size () * taskIndex / tasksCount;
+		std::size_t end = _renderObjects.size () * (taskIndex + 1) / tasksCount;
 
-		/*
-		 * Draw object on geometry buffer
-		*/
+		RecordGeometryCommands (intersection, frustum, camera, settings,
+			begin, end, _recordingTasks [taskIndex]);
+	});
+
+	/*
+	 * Replay recorded commands in order
+	*/
 
-		renderObject->Draw ();
+	std::size_t drawnVerticesCount = 0;
+	std::size_t drawnPolygonsCount = 0;
+	std::size_t drawnObjectsCount = 0;
+	std::size_t occludedObjectsCount = 0;
+
+	bool hasState = false;
+	int currentState = 0;
+
+	for (std::size_t taskIndex = 0; taskIndex < tasksCount; taskIndex ++) {
+		const GeometryRecordingTask& task = _recordingTasks [taskIndex];
+
+		drawnVerticesCount += task.drawnVerticesCount;
+		drawnPolygonsCount += task.drawnPolygonsCount;
+		drawnObjectsCount += task.drawnObjectsCount;
+		occludedObjectsCount += task.occludedObjectsCount;
+
+		for (const RenderCommand& command : task.commandList) {
+
+			if (command.type == RENDER_COMMAND_STATE) {
+
+				/*
+				 * Lists start with their own state, skip it when it
+				 * matches the end of the previous list
+				*/
+
+				if (hasState == true && currentState == command.state) {
+					continue;
+				}
+
+				/*
+				 * Deferred Rendering: Prepare for rendering
+				*/
+
+				BindFrameBuffer (command.state);
+
+				/*
+				 * Lock shader according to object layers
+				*/
+
+				LockShader (command.state);
+
+				currentState = command.state;
+				hasState = true;
+
+				continue;
+			}
+
+			/*
+			 * Draw object on geometry buffer
+			*/
+
+			command.renderObject->Draw (command.levelOfDetail);
+		}
 	}
 
 	auto renderStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RenderStatisticsObject> ();
@@ -276,6 +398,7 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 	renderStatisticsObject->DrawnVerticesCount = drawnVerticesCount;
 	renderStatisticsObject->DrawnPolygonsCount = drawnPolygonsCount;
 	renderStatisticsObject->DrawnObjectsCount = drawnObjectsCount;
+	renderStatisticsObject->OccludedObjectsCount = occludedObjectsCount;
 
 	/*
 	* Disable Stecil Test for further rendering
@@ -284,6 +407,62 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 	GL::Disable (GL_STENCIL_TEST);
 }
 
+void DeferredGeometryRenderPass::RecordGeometryCommands (Intersection* intersection, const FrustumVolume& frustum,
+	const Camera* camera, const RenderSettings& settings, std::size_t begin, std::size_t end, GeometryRecordingTask& task) const
+{
+	/*
+	 * Runs on render workers, no GL calls allowed
+	*/
+
+	task.commandList.Reset ();
+
+	task.drawnVerticesCount = 0;
+	task.drawnPolygonsCount = 0;
+	task.drawnObjectsCount = 0;
+	task.occludedObjectsCount = 0;
+
+	for (std::size_t index = begin; index < end; index ++) {
+		RenderObject* renderObject = _renderObjects [index];
+
+		/*
+		* Culling Check
+		*/
+
+		auto& boundingBox = renderObject->GetBoundingBox ();
+		if (!intersection->CheckFrustumVsAABB (frustum, boundingBox)) {
+			continue;
+		}
+
+		/*
+		 * Occlusion Check. Occluders are always drawn.
+		*/
+
+		if (settings.occlusion_culling_enabled == true && renderObject->GetOccluderMesh () == nullptr) {
+			if (!_occlusionCulling.IsVisible (boundingBox)) {
+				task.occludedObjectsCount++;
+				continue;
+			}
+		}
+
+		/*
+		 * Select level of detail by screen size
+		*/
+
+		std::size_t levelOfDetail = LevelOfDetailSelection::Select (renderObject, camera, settings);
+
+		task.drawnVerticesCount += renderObject->GetModelView ()->GetVerticesCount ();
+		task.drawnPolygonsCount += renderObject->GetModelView ()->GetPolygonsCount (levelOfDetail);
+		task.drawnObjectsCount++;
+
+		/*
+		 * Framebuffer and shader depend only on object layers
+		*/
+
+		task.commandList.SetState (renderObject->GetSceneLayers ());
+		task.commandList.Draw (renderObject, levelOfDetail);
+	}
+}
+
 void DeferredGeometryRenderPass::EndDrawing ()
 {
 	/*
@@ -293,17 +472,101 @@ void DeferredGeometryRenderPass::EndDrawing ()
 	Pipeline::UnlockShader ();
 }
 
-void DeferredGeometryRenderPass::GenerateMipmaps ()
+void DeferredGeometryRenderPass::GenerateMipmaps (RenderVolumeCollection* rvc)
 {
+	static RenderVolumeHandle gBufferMipRequirementsHandle = RenderVolumeCollection::GetHandle ("GBufferMipRequirements");
+
+	auto requirements = (GBufferMipRequirements*) rvc->GetRenderVolume (gBufferMipRequirementsHandle);
+
 	/*
-	 * Generate GBuffer mipmap
+	 * Only normal and, if the layout has one, position maps have mipmaps
 	*/
 
-	for (std::size_t index = 0 ; index < 4 ; index++) {
-		_framebuffer->GetFramebufferView ()->GetTextureView (index)->Activate (0);
+	std::size_t normalLevels = requirements != nullptr ? requirements->GetLevels (GBUFFER_MIP_NORMAL) : 0;
+	std::size_t positionLevels = requirements != nullptr ? requirements->GetLevels (GBUFFER_MIP_POSITION) : 0;
 
-		GL::GenerateMipmap (GL_TEXTURE_2D);
+	if (_framebuffer->IsPacked () == true) {
+		positionLevels = 0;
 	}
+
+	auto normalMapView = _framebuffer->GetFramebufferView ()->GetTextureView (0);
+	auto positionMapView = _framebuffer->GetFramebufferView ()->GetTextureView (_framebuffer->IsPacked () ? 0 : 4);
+
+	/*
+	 * Levels that are not generated this frame are out of reach of the
+	 * samplers, so implicit level of detail never reads stale data
+	*/
+
+	normalMapView->Activate (0);
+	GL::TexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, normalLevels);
+
+	if (_framebuffer->IsPacked () == false) {
+		positionMapView->Activate (0);
+		GL::TexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, positionLevels);
+	}
+
+	if (normalLevels == 0 && positionLevels == 0) {
+		return;
+	}
+
+	/*
+	 * Downsample every required level of both maps in a single dispatch
+	*/
+
+	Pipeline::SetShader (_mipmapShaderView);
+
+	std::vector<PipelineAttribute> attributes;
+
+	PipelineAttribute srcNormalMap;
+	PipelineAttribute srcPositionMap;
+	PipelineAttribute normalLevelsCount;
+	PipelineAttribute positionLevelsCount;
+
+	srcNormalMap.type = PipelineAttribute::AttrType::ATTR_TEXTURE_2D;
+	srcPositionMap.type = PipelineAttribute::AttrType::ATTR_TEXTURE_2D;
+	normalLevelsCount.type = PipelineAttribute::AttrType::ATTR_1I;
+	positionLevelsCount.type = PipelineAttribute::AttrType::ATTR_1I;
+
+	srcNormalMap.name = "srcNormalMap";
+	srcPositionMap.name = "srcPositionMap";
+	normalLevelsCount.name = "normalLevelsCount";
+	positionLevelsCount.name = "positionLevelsCount";
+
+	srcNormalMap.value.x = normalMapView->GetGPUIndex ();
+	srcPositionMap.value.x = positionMapView->GetGPUIndex ();
+	normalLevelsCount.value.x = normalLevels;
+	positionLevelsCount.value.x = positionLevels;
+
+	attributes.push_back (srcNormalMap);
+	attributes.push_back (srcPositionMap);
+	attributes.push_back (normalLevelsCount);
+	attributes.push_back (positionLevelsCount);
+
+	Pipeline::SendCustomAttributes (_mipmapShaderView, attributes);
+
+	GLenum normalFormat = _framebuffer->IsPacked () ? GL_RGBA16F : GL_RGBA32F;
+
+	for (std::size_t level = 1; level <= normalLevels; level ++) {
+		Pipeline::BindImageTexture (level - 1, normalMapView->GetGPUIndex (), level, false, 0, GL_WRITE_ONLY, normalFormat);
+	}
+
+	for (std::size_t level = 1; level <= positionLevels; level ++) {
+		Pipeline::BindImageTexture (GBUFFER_MIP_MAX_LEVELS + level - 1, positionMapView->GetGPUIndex (), level, false, 0, GL_WRITE_ONLY, GL_RGBA32F);
+	}
+
+	/*
+	 * Every work group reduces a 16x16 tile of the base level
+	*/
+
+	auto size = _framebuffer->GetFramebuffer ()->GetTexture (0)->GetSize ();
+
+	GL::DispatchCompute ((size.width + 15) / 16, (size.height + 15) / 16, 1);
+
+	/*
+	 * Make sure writing to image has finished before read
+	*/
+
+	GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
 }
 
 void DeferredGeometryRenderPass::BindFrameBuffer (int sceneLayers)
@@ -364,6 +627,18 @@ void DeferredGeometryRenderPass::LockShader (int sceneLayers)
 	if ((sceneLayers & (SceneLayer::STATIC | SceneLayer::DYNAMIC)) && !(sceneLayers & SceneLayer::NORMAL_MAP)) {
 		Pipeline::LockShader (_shaderView);
 	}
+
+	/*
+	 * Let the shader know the GBuffer layout it writes
+	*/
+
+	PipelineAttribute gBufferPacked;
+
+	gBufferPacked.type = PipelineAttribute::AttrType::ATTR_1I;
+	gBufferPacked.name = "gBufferPacked";
+	gBufferPacked.value.x = _framebuffer->IsPacked ();
+
+	Pipeline::SendCustomAttributes (nullptr, std::vector<PipelineAttribute> { gBufferPacked });
 }
 
 /*
@@ -394,6 +669,12 @@ void DeferredGeometryRenderPass::UpdateCamera (const Camera* camera, const Rende
 		_framebuffer->SetProjectionMatrix (camera->GetProjectionMatrix ());
 	}
 
+	/*
+	 * Translucency GBuffer is drawn with the same projection
+	*/
+
+	_translucencyFramebuffer->SetProjectionMatrix (_framebuffer->GetProjectionMatrix ());
+
 	// Create projection matrix
 	Pipeline::CreateProjection (_framebuffer->GetProjectionMatrix ());
 
@@ -408,7 +689,8 @@ void DeferredGeometryRenderPass::UpdateVolumes (const RenderSettings& settings,
 	auto framebufferSize = _framebuffer->GetFramebuffer ()->GetTexture (0)->GetSize ();
 
 	if (framebufferSize.width != resolution.width ||
-		framebufferSize.height != resolution.height) {
+		framebufferSize.height != resolution.height ||
+		_framebuffer->IsPacked () != settings.gbuffer_packed) {
 
 		/*
 		 * Clear framebuffer
@@ -457,17 +739,18 @@ void DeferredGeometryRenderPass::InitGBufferVolume (const RenderSettings& settin
 	std::vector<Resource<Texture>> textures;
 	Resource<Texture> depthTexture;
 
-	std::vector<std::string> volumeNames = { "gPositionMap", "gNormalMap", "gDiffuseMap", "gSpecularMap", "gEmissiveMap" };
+	std::vector<GBufferTarget> targets = GetGBufferTargets (settings.gbuffer_packed);
 
-	for (auto volumeName : volumeNames) {
-		Resource<Texture> texture = Resource<Texture> (new Texture (volumeName));
+	for (auto& target : targets) {
+		Resource<Texture> texture = Resource<Texture> (new Texture (target.name));
 
 		texture->SetSize (Size (settings.resolution.width, settings.resolution.height));
-		texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA32);
-		texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
-		texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+		texture->SetSizedInternalFormat (target.sizedInternalFormat);
+		texture->SetInternalFormat (target.internalFormat);
+		texture->SetChannelType (target.channelType);
+		texture->SetMipmapGeneration (target.mipmaps);
 		texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER);
-		texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST_MIPMAP_NEAREST);
+		texture->SetMinFilter (target.mipmaps ? TEXTURE_FILTER_MODE::FILTER_NEAREST_MIPMAP_NEAREST : TEXTURE_FILTER_MODE::FILTER_NEAREST);
 		texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
 		texture->SetAnisotropicFiltering (false);
 		texture->SetBorderColor (Color (glm::vec4 (1.0)));
@@ -490,16 +773,14 @@ void DeferredGeometryRenderPass::InitGBufferVolume (const RenderSettings& settin
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (textures, depthTexture));
 
-	_framebuffer = new GBuffer (framebuffer);
+	_framebuffer = new GBuffer (framebuffer, settings.gbuffer_packed);
 
 	/*
 	 * Initialize translucency gbuffer
 	*/
 
-	volumeNames = { "gTrPositionMap", "gTrNormalMap", "gTrDiffuseMap", "gTrSpecularMap", "gTrEmissiveMap" };
-
 	for (std::size_t index = 0; index < textures.size (); index ++) {
-		textures [index]->SetName (volumeNames [index]);
+		textures [index]->SetName ("gTr" + targets [index].name.substr (1));
 		textures [index]->SetMipmapGeneration (false);
 		textures [index]->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
 	}
@@ -508,5 +789,71 @@ void DeferredGeometryRenderPass::InitGBufferVolume (const RenderSettings& settin
 
 	framebuffer = Resource<Framebuffer> (new Framebuffer (textures, depthTexture));
 
-	_translucencyFramebuffer = new GBuffer (framebuffer);
+	_translucencyFramebuffer = new GBuffer (framebuffer, settings.gbuffer_packed);
+
+	/*
+	 * Update statistics
+	*/
+
+	UpdateStatistics (settings);
+}
+
+std::vector<DeferredGeometryRenderPass::GBufferTarget> DeferredGeometryRenderPass::GetGBufferTargets (bool packed) const
+{
+	/*
+	 * Targets are in the order geometry shaders write them. Position map
+	 * comes last, so the packed layout can leave it out. Only normal and
+	 * position maps are ever sampled at a lower level of detail.
+	*/
+
+	if (packed == false) {
+		return {
+			{ "gNormalMap", FORMAT_RGBA32, FORMAT_RGBA, CHANNEL_FLOAT, 16, true },
+			{ "gDiffuseMap", FORMAT_RGBA32, FORMAT_RGBA, CHANNEL_FLOAT, 16, false },
+			{ "gSpecularMap", FORMAT_RGBA32, FORMAT_RGBA, CHANNEL_FLOAT, 16, false },
+			{ "gEmissiveMap", FORMAT_RGBA32, FORMAT_RGBA, CHANNEL_FLOAT, 16, false },
+			{ "gPositionMap", FORMAT_RGBA32, FORMAT_RGBA, CHANNEL_FLOAT, 16, true }
+		};
+	}
+
+	/*
+	 * Position is reconstructed from depth. Normal map keeps the octahedron
+	 * encoded normal, refractive index and shininess.
+	*/
+
+	return {
+		{ "gNormalMap", FORMAT_RGBA16, FORMAT_RGBA, CHANNEL_FLOAT, 8, true },
+		{ "gDiffuseMap", FORMAT_RGBA8, FORMAT_RGBA, CHANNEL_UNSIGNED_BYTE, 4, false },
+		{ "gSpecularMap", FORMAT_RGBA8, FORMAT_RGBA, CHANNEL_UNSIGNED_BYTE, 4, false },
+		{ "gEmissiveMap", FORMAT_R11G11B10F, FORMAT_RGB, CHANNEL_FLOAT, 4, false }
+	};
+}
+
+void DeferredGeometryRenderPass::UpdateStatistics (const RenderSettings& settings)
+{
+	/*
+	 * Both GBuffers share the layout, with a 4 bytes depth stencil map each
+	*/
+
+	const std::size_t depthPixelSize = 4;
+
+	std::size_t bytesPerPixel = depthPixelSize;
+	std::size_t unpackedBytesPerPixel = depthPixelSize;
+
+	for (auto& target : GetGBufferTargets (settings.gbuffer_packed)) {
+		bytesPerPixel += target.pixelSize;
+	}
+
+	for (auto& target : GetGBufferTargets (false)) {
+		unpackedBytesPerPixel += target.pixelSize;
+	}
+
+	std::size_t pixelsCount = settings.resolution.width * settings.resolution.height;
+
+	auto gBufferStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <GBufferStatisticsObject> ();
+
+	gBufferStatisticsObject->BytesPerPixel = bytesPerPixel;
+	gBufferStatisticsObject->MemoryBytesCount = 2 * bytesPerPixel * pixelsCount;
+	gBufferStatisticsObject->UnpackedBytesPerPixel = unpackedBytesPerPixel;
+	gBufferStatisticsObject->UnpackedMemoryBytesCount = 2 * unpackedBytesPerPixel * pixelsCount;
 }
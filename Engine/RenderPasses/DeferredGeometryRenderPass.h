@@ -8,6 +8,11 @@
 
 #include "GBuffer.h"
 
+#include "Renderer/SoftwareOcclusionCulling.h"
+#include "Renderer/RenderCommandList.h"
+
+#include "Core/Intersections/Intersection.h"
+
 #include "Utils/Sequences/HaltonGenerator.h"
 
 class ENGINE_API DeferredGeometryRenderPass : public ContainerRenderSubPassI
@@ -15,13 +20,38 @@ class ENGINE_API DeferredGeometryRenderPass : public ContainerRenderSubPassI
 	DECLARE_RENDER_PASS(DeferredGeometryRenderPass)
 
 protected:
+	struct GeometryRecordingTask
+	{
+		RenderCommandList commandList;
+
+		std::size_t drawnVerticesCount;
+		std::size_t drawnPolygonsCount;
+		std::size_t drawnObjectsCount;
+		std::size_t occludedObjectsCount;
+	};
+
+	struct GBufferTarget
+	{
+		std::string name;
+		TEXTURE_SIZED_INTERNAL_FORMAT sizedInternalFormat;
+		TEXTURE_INTERNAL_FORMAT internalFormat;
+		TEXTURE_CHANNEL_TYPE channelType;
+		std::size_t pixelSize;
+		bool mipmaps;
+	};
+
 	Resource<ShaderView> _shaderView;
 	Resource<ShaderView> _normalMapShaderView;
 	Resource<ShaderView> _lightMapShaderView;
 	Resource<ShaderView> _animationShaderView;
+	Resource<ShaderView> _mipmapShaderView;
 	GBuffer* _framebuffer;
 	GBuffer* _translucencyFramebuffer;
 	HaltonGenerator _haltonGenerator;
+	SoftwareOcclusionCulling _occlusionCulling;
+
+	std::vector<RenderObject*> _renderObjects;
+	std::vector<GeometryRecordingTask> _recordingTasks;
 
 public:
 	DeferredGeometryRenderPass ();
@@ -38,10 +68,13 @@ protected:
 	void UpdateCamera (const Camera* camera, const RenderSettings& settings);
 
 	void PrepareDrawing ();
+	void OcclusionPass (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings);
 	void GeometryPass (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings);
+	void RecordGeometryCommands (Intersection* intersection, const FrustumVolume& frustum, const Camera* camera,
+		const RenderSettings& settings, std::size_t begin, std::size_t end, GeometryRecordingTask& task) const;
 	void EndDrawing ();
 
-	void GenerateMipmaps ();
+	void GenerateMipmaps (RenderVolumeCollection* rvc);
 
 	void BindFrameBuffer (int sceneLayers);
 	void LockShader (int sceneLayers);
@@ -49,6 +82,9 @@ protected:
 	void UpdateVolumes (const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	void InitGBufferVolume (const RenderSettings& settings);
+
+	std::vector<GBufferTarget> GetGBufferTargets (bool packed) const;
+	void UpdateStatistics (const RenderSettings& settings);
 };
 
 #endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #include "RenderPasses/FramebufferRenderVolume.h"
 
+#include "Renderer/RenderTextGUIObject.h"
+#include "Renderer/TextGUIBatcher.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 void ForwardRenderPass::Init (const RenderSettings& settings)
@@ -92,6 +95,20 @@ void ForwardRenderPass::ForwardPass (const RenderScene* renderScene)
 
 	for (RenderObject* renderObject : renderObjects) {
 
+		/*
+		 * Consecutive text objects are drawn together
+		*/
+
+		RenderTextGUIObject* renderTextGUIObject = dynamic_cast<RenderTextGUIObject*> (renderObject);
+
+		if (renderTextGUIObject != nullptr) {
+			TextGUIBatcher::Add (renderTextGUIObject);
+
+			continue;
+		}
+
+		TextGUIBatcher::Flush ();
+
 		/*
 		 * Enable depth test
 		*/
@@ -101,4 +118,6 @@ void ForwardRenderPass::ForwardPass (const RenderScene* renderScene)
 
 		renderObject->Draw ();
 	}
+
+	TextGUIBatcher::Flush ();
 }
\ No newline at end of file
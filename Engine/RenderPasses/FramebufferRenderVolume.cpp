@@ -3,7 +3,8 @@
 #include "Renderer/RenderSystem.h"
 
 FramebufferRenderVolume::FramebufferRenderVolume (const Resource<Framebuffer>& framebuffer) :
-	_framebuffer (framebuffer)
+	_framebuffer (framebuffer),
+	_depthAttributeIndex (0)
 {
 	/*
 	 * Load framebuffer in GPU
@@ -46,6 +47,8 @@ FramebufferRenderVolume::FramebufferRenderVolume (const Resource<Framebuffer>& f
 
 		textureAttribute.value.x = _framebufferView->GetDepthTextureView ()->GetGPUIndex ();
 
+		_depthAttributeIndex = _attributes.size ();
+
 		_attributes.push_back (textureAttribute);
 	}
 }
@@ -64,3 +67,21 @@ Resource<FramebufferView>& FramebufferRenderVolume::GetFramebufferView ()
 {
 	return _framebufferView;
 }
+
+void FramebufferRenderVolume::SetFramebufferView (const Resource<FramebufferView>& framebufferView)
+{
+	_framebufferView = framebufferView;
+
+	/*
+	 * Point texture attributes to the new views. Attribute names
+	 * come from the framebuffer and stay the same.
+	*/
+
+	for (std::size_t index = 0; index < _framebufferView->GetTextureViewCount (); index ++) {
+		_attributes [index].value.x = _framebufferView->GetTextureView (index)->GetGPUIndex ();
+	}
+
+	if (_framebuffer->GetDepthTexture () != nullptr && _framebufferView->GetDepthTextureView () != nullptr) {
+		_attributes [_depthAttributeIndex].value.x = _framebufferView->GetDepthTextureView ()->GetGPUIndex ();
+	}
+}
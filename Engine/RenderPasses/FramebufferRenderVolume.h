@@ -14,6 +14,7 @@ protected:
 	Resource<FramebufferView> _framebufferView;
 
 	std::vector<PipelineAttribute> _attributes;
+	std::size_t _depthAttributeIndex;
 
 public:
 	FramebufferRenderVolume (const Resource<Framebuffer>& framebuffer);
@@ -22,6 +23,8 @@ public:
 
 	Resource<Framebuffer>& GetFramebuffer ();
 	Resource<FramebufferView>& GetFramebufferView ();
+
+	virtual void SetFramebufferView (const Resource<FramebufferView>& framebufferView);
 };
 
 #endif
\ No newline at end of file
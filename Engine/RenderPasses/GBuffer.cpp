@@ -1,30 +1,80 @@
 #include "GBuffer.h"
 
-GBuffer::GBuffer (const Resource<Framebuffer>& framebuffer) :
+GBuffer::GBuffer (const Resource<Framebuffer>& framebuffer, bool packed) :
 	FramebufferRenderVolume (framebuffer),
 	_projectionMatrix (1.0f),
-	_frustumJitter (0.0f)
+	_frustumJitter (0.0f),
+	_packed (packed),
+	_positionAttributeIndex (0),
+	_inverseProjectionAttributeIndex (0)
 {
+	/*
+	 * Packed layout has no position map, its sampler reads depth instead,
+	 * so it never shares a texture unit with samplers of other types
+	*/
+
+	if (_packed == true && _framebuffer->GetDepthTexture () != nullptr) {
+		PipelineAttribute positionMap = _attributes [_depthAttributeIndex];
+
+		positionMap.name = "gPositionMap";
+
+		_positionAttributeIndex = _attributes.size ();
+
+		_attributes.push_back (positionMap);
+	}
+
 	/*
 	 * Create attributes
 	*/
 
 	PipelineAttribute screenSize;
+	PipelineAttribute gBufferPacked;
+	PipelineAttribute inverseProjectionMatrix;
 
 	screenSize.type = PipelineAttribute::AttrType::ATTR_2F;
+	gBufferPacked.type = PipelineAttribute::AttrType::ATTR_1I;
+	inverseProjectionMatrix.type = PipelineAttribute::AttrType::ATTR_MATRIX_4X4F;
 
 	screenSize.name = "screenSize";
+	gBufferPacked.name = "gBufferPacked";
+	inverseProjectionMatrix.name = "gInverseProjectionMatrix";
 
 	auto resolution = _framebuffer->GetTexture (0)->GetSize ();
 
 	screenSize.value = glm::vec3 (resolution.width, resolution.height, 0.0f);
+	gBufferPacked.value.x = _packed;
+	inverseProjectionMatrix.matrix = glm::mat4 (1.0f);
 
 	_attributes.push_back (screenSize);
+	_attributes.push_back (gBufferPacked);
+
+	_inverseProjectionAttributeIndex = _attributes.size ();
+
+	_attributes.push_back (inverseProjectionMatrix);
 }
 
 void GBuffer::SetProjectionMatrix (const glm::mat4& projectionMatrix)
 {
 	_projectionMatrix = projectionMatrix;
+
+	/*
+	 * Update attributes
+	*/
+
+	_attributes [_inverseProjectionAttributeIndex].matrix = glm::inverse (_projectionMatrix);
+}
+
+void GBuffer::SetFramebufferView (const Resource<FramebufferView>& framebufferView)
+{
+	FramebufferRenderVolume::SetFramebufferView (framebufferView);
+
+	/*
+	 * Packed position sampler reads the depth texture
+	*/
+
+	if (_packed == true && _framebuffer->GetDepthTexture () != nullptr) {
+		_attributes [_positionAttributeIndex].value.x = _attributes [_depthAttributeIndex].value.x;
+	}
 }
 
 void GBuffer::SetFrustumJitter (const glm::vec2& frustumJitter)
@@ -41,3 +91,8 @@ const glm::vec2& GBuffer::GetFrustumJitter () const
 {
 	return _frustumJitter;
 }
+
+bool GBuffer::IsPacked () const
+{
+	return _packed;
+}
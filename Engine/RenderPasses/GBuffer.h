@@ -8,15 +8,21 @@ class GBuffer : public FramebufferRenderVolume
 protected:
     glm::mat4 _projectionMatrix;
     glm::vec2 _frustumJitter;
+    bool _packed;
+    std::size_t _positionAttributeIndex;
+    std::size_t _inverseProjectionAttributeIndex;
 
 public:
-    GBuffer (const Resource<Framebuffer>& framebuffer);
+    GBuffer (const Resource<Framebuffer>& framebuffer, bool packed = false);
 
     void SetProjectionMatrix (const glm::mat4& projectionMatrix);
     void SetFrustumJitter (const glm::vec2& frustumJitter);
 
+    void SetFramebufferView (const Resource<FramebufferView>& framebufferView);
+
     const glm::mat4& GetProjectionMatrix () const;
     const glm::vec2& GetFrustumJitter () const;
+    bool IsPacked () const;
 }; 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef GBUFFERSTATISTICSOBJECT_H
+#define GBUFFERSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API GBufferStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(GBufferStatisticsObject)
+
+	std::size_t BytesPerPixel;
+	std::size_t MemoryBytesCount;
+	std::size_t UnpackedBytesPerPixel;
+	std::size_t UnpackedMemoryBytesCount;
+};
+
+#endif
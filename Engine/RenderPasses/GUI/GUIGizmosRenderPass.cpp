@@ -169,8 +169,8 @@ void GUIGizmosRenderPass::DrawData (const std::vector<float>& renderData, const
 	 * Set viewport
 	*/
 
-	GL::Viewport (settings.viewport.x, settings.viewport.y,
-		settings.viewport.width, settings.viewport.height);
+	GL::Viewport (settings.window.x, settings.window.y,
+		settings.window.width, settings.window.height);
 
 	Pipeline::LockShader (_shaderView);
 
@@ -8,6 +8,7 @@
 #include "Renderer/RenderSystem.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/PersistentRingBuffer.h"
 
 void GUIRenderPass::Init (const RenderSettings& settings)
 {
@@ -32,14 +33,11 @@ void GUIRenderPass::Init (const RenderSettings& settings)
 	GL::GenBuffers (1, &_VBO_ID);
 	GL::GenBuffers (1, &_IBO_ID);
 
-	GL::BindBuffer (GL_ARRAY_BUFFER, _VBO_ID);
-
 	GL::EnableVertexAttribArray (0);
 	GL::EnableVertexAttribArray (1);
 	GL::EnableVertexAttribArray (2);
-	GL::VertexAttribPointer (0, 2, GL_FLOAT, GL_FALSE, sizeof (ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
-	GL::VertexAttribPointer (1, 2, GL_FLOAT, GL_FALSE, sizeof (ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
-	GL::VertexAttribPointer (2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof (ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+
+	BindVertexBuffer (_VBO_ID, 0);
 }
 
 RenderVolumeCollection* GUIRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -110,8 +108,8 @@ void GUIRenderPass::EditorPass (const RenderSettings& settings)
 	 * Set viewport size
 	*/
 
-	GL::Viewport (settings.viewport.x, settings.viewport.y,
-		settings.viewport.width, settings.viewport.height);
+	GL::Viewport (settings.window.x, settings.window.y,
+		settings.window.width, settings.window.height);
 
 	//GL::Clear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
@@ -143,11 +141,32 @@ void GUIRenderPass::EditorPass (const RenderSettings& settings)
 
 		GL::BindVertexArray (_VAO_ID);
 
-		GL::BindBuffer (GL_ARRAY_BUFFER, _VBO_ID);
-		GL::BufferData (GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+		std::size_t vtxSize = (std::size_t) cmd_list->VtxBuffer.Size * sizeof(ImDrawVert);
+		std::size_t idxSize = (std::size_t) cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+
+		/*
+		 * Stream draw lists through the ring buffer, fall back to
+		 * respecifying own buffers when it is not available
+		*/
+
+		RingBufferAllocation vtxAllocation, idxAllocation;
+
+		if (PersistentRingBuffer::Upload (GL_ARRAY_BUFFER, cmd_list->VtxBuffer.Data, vtxSize, vtxAllocation) == true &&
+			PersistentRingBuffer::Upload (GL_ELEMENT_ARRAY_BUFFER, cmd_list->IdxBuffer.Data, idxSize, idxAllocation) == true) {
+
+			BindVertexBuffer (vtxAllocation.buffer, vtxAllocation.offset);
+
+			GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, idxAllocation.buffer);
 
-		GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, _IBO_ID);
-		GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+			idx_buffer_offset = (const ImDrawIdx*) idxAllocation.offset;
+		} else {
+			BindVertexBuffer (_VBO_ID, 0);
+
+			GL::BufferData (GL_ARRAY_BUFFER, (GLsizeiptr)vtxSize, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+
+			GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, _IBO_ID);
+			GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)idxSize, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+		}
 
 		for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++) {
 
@@ -160,10 +179,10 @@ void GUIRenderPass::EditorPass (const RenderSettings& settings)
 			if (!pcmd->UserCallback) {
 				ImVec4 clip_rect = ImVec4 (pcmd->ClipRect.x - pos.x, pcmd->ClipRect.y - pos.y, pcmd->ClipRect.z - pos.x, pcmd->ClipRect.w - pos.y);
 
-				if (clip_rect.x < settings.resolution.width && clip_rect.y < settings.resolution.height && clip_rect.z >= 0.0f && clip_rect.w >= 0.0f) {
+				if (clip_rect.x < settings.window.width && clip_rect.y < settings.window.height && clip_rect.z >= 0.0f && clip_rect.w >= 0.0f) {
 
                     // Apply scissor/clipping rectangle
-					GL::Scissor((int)clip_rect.x, (int)(settings.resolution.height - clip_rect.w), (int)(clip_rect.z - clip_rect.x), (int)(clip_rect.w - clip_rect.y));
+					GL::Scissor((int)clip_rect.x, (int)(settings.window.height - clip_rect.w), (int)(clip_rect.z - clip_rect.x), (int)(clip_rect.w - clip_rect.y));
 
 					/*
 					 * Draw
@@ -189,6 +208,15 @@ void GUIRenderPass::EndEditorPass ()
 	Pipeline::UnlockShader ();
 }
 
+void GUIRenderPass::BindVertexBuffer (unsigned int buffer, std::size_t offset)
+{
+	GL::BindBuffer (GL_ARRAY_BUFFER, buffer);
+
+	GL::VertexAttribPointer (0, 2, GL_FLOAT, GL_FALSE, sizeof (ImDrawVert), (GLvoid*)(offset + IM_OFFSETOF(ImDrawVert, pos)));
+	GL::VertexAttribPointer (1, 2, GL_FLOAT, GL_FALSE, sizeof (ImDrawVert), (GLvoid*)(offset + IM_OFFSETOF(ImDrawVert, uv)));
+	GL::VertexAttribPointer (2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof (ImDrawVert), (GLvoid*)(offset + IM_OFFSETOF(ImDrawVert, col)));
+}
+
 std::vector<PipelineAttribute> GUIRenderPass::GetCustomAttributes ()
 {
 	std::vector<PipelineAttribute> attributes;
@@ -27,6 +27,8 @@ protected:
 	void EditorPass (const RenderSettings& settings);
 	void EndEditorPass ();
 
+	void BindVertexBuffer (unsigned int buffer, std::size_t offset);
+
 	std::vector<PipelineAttribute> GetCustomAttributes ();
 
 	void LockShader ();
@@ -4,10 +4,10 @@ bool GammaCorrectionRenderPass::IsAvailable (const RenderScene* renderScene, con
 	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
 {
 	/*
-	 * Check if gamma correction is enabled
+	 * Check if gamma correction is enabled and not fused in post process compositor
 	*/
 
-	return settings.gamma_enabled;
+	return settings.gamma_enabled && !settings.post_process_compositor_enabled;
 }
 
 std::string GammaCorrectionRenderPass::GetPostProcessFragmentShaderPath () const
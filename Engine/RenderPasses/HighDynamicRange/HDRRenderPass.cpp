@@ -4,10 +4,10 @@ bool HDRRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* c
 	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
 {
 	/*
-	 * Check if high dynamic range is enabled
+	 * Check if high dynamic range is enabled and not fused in post process compositor
 	*/
 
-	return settings.hdr_enabled;
+	return settings.hdr_enabled && !settings.post_process_compositor_enabled;
 }
 
 std::string HDRRenderPass::GetPostProcessFragmentShaderPath () const
@@ -1,5 +1,7 @@
 #include "HybridRSMIndirectDiffuseLightRenderPass.h"
 
+#include "RenderPasses/VolumetricLightVolume.h"
+
 #include "Debug/Statistics/StatisticsManager.h"
 #include "HGIStatisticsObject.h"
 
@@ -15,6 +17,16 @@ bool HybridRSMIndirectDiffuseLightRenderPass::IsAvailable (const RenderScene* re
 	return true;
 }
 
+void HybridRSMIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.hgi_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.hgi_interpolation_scale);
+}
+
 std::string HybridRSMIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/HybridGlobalIllumination/hybridRSMIndirectDiffuseFragment.glsl";
@@ -72,7 +84,7 @@ std::vector<PipelineAttribute> HybridRSMIndirectDiffuseLightRenderPass::GetCusto
 	 * Attach post process volume attributes to pipeline
 	*/
 
-	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	std::vector<PipelineAttribute> attributes = AmortizedRenderPass::GetCustomAttributes (camera, settings, rvc);
 
 	/*
 	 * Attach screen space ambient occlusion attributes to pipeline
@@ -120,3 +132,24 @@ std::vector<PipelineAttribute> HybridRSMIndirectDiffuseLightRenderPass::GetCusto
 
 	return attributes;
 }
+
+std::size_t HybridRSMIndirectDiffuseLightRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.hgi_amortization_interval;
+}
+
+bool HybridRSMIndirectDiffuseLightRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.hgi_amortization_interleaved;
+}
+
+const RenderLightObject* HybridRSMIndirectDiffuseLightRenderPass::GetAmortizedRenderLightObject (const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Indirect light is computed for the light of the container
+	*/
+
+	auto volume = (VolumetricLightVolume*) rvc->GetRenderVolume ("SubpassVolume");
+
+	return volume != nullptr ? volume->GetRenderLightObject () : nullptr;
+}
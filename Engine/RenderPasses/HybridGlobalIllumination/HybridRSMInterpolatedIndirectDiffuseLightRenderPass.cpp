@@ -13,6 +13,16 @@ bool HybridRSMInterpolatedIndirectDiffuseLightRenderPass::IsAvailable (const Ren
 	return true;
 }
 
+void HybridRSMInterpolatedIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.hgi_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.hgi_interpolation_scale);
+}
+
 std::string HybridRSMInterpolatedIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/HybridGlobalIllumination/hybridRSMInterpolatedIndirectDiffuseFragment.glsl";
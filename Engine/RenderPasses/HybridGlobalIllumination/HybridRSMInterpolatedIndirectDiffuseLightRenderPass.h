@@ -10,6 +10,8 @@ class ENGINE_API HybridRSMInterpolatedIndirectDiffuseLightRenderPass : public Po
 public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;
@@ -15,6 +15,16 @@ bool HybridSSDOIndirectDiffuseLightRenderPass::IsAvailable (const RenderScene* r
 	return true;
 }
 
+void HybridSSDOIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.hgi_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.hgi_interpolation_scale);
+}
+
 std::string HybridSSDOIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/HybridGlobalIllumination/hybridSSDOIndirectDiffuseFragment.glsl";
@@ -72,7 +82,7 @@ std::vector<PipelineAttribute> HybridSSDOIndirectDiffuseLightRenderPass::GetCust
 	 * Attach post process volume attributes to pipeline
 	*/
 
-	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	std::vector<PipelineAttribute> attributes = AmortizedRenderPass::GetCustomAttributes (camera, settings, rvc);
 
 	/*
 	 * Attach screen space ambient occlusion attributes to pipeline
@@ -115,3 +125,13 @@ std::vector<PipelineAttribute> HybridSSDOIndirectDiffuseLightRenderPass::GetCust
 
 	return attributes;
 }
+
+std::size_t HybridSSDOIndirectDiffuseLightRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.hgi_amortization_interval;
+}
+
+bool HybridSSDOIndirectDiffuseLightRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.hgi_amortization_interleaved;
+}
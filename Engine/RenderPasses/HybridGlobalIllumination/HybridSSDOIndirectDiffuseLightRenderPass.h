@@ -1,15 +1,17 @@
 #ifndef HYBRIDSSDOINDIRECTDIFFUSELIGHTRENDERPASS_H
 #define HYBRIDSSDOINDIRECTDIFFUSELIGHTRENDERPASS_H
 
-#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+#include "RenderPasses/TemporalFiltering/AmortizedRenderPass.h"
 
-class ENGINE_API HybridSSDOIndirectDiffuseLightRenderPass : public PostProcessRenderPass
+class ENGINE_API HybridSSDOIndirectDiffuseLightRenderPass : public AmortizedRenderPass
 {
 	DECLARE_RENDER_PASS(HybridSSDOIndirectDiffuseLightRenderPass)
 
 public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;
@@ -18,6 +20,9 @@ protected:
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::size_t GetAmortizationInterval (const RenderSettings& settings) const;
+	bool IsAmortizationInterleaved (const RenderSettings& settings) const;
 };
 
 #endif
\ No newline at end of file
@@ -13,6 +13,16 @@ bool HybridSSDOInterpolatedIndirectDiffuseLightRenderPass::IsAvailable (const Re
 	return true;
 }
 
+void HybridSSDOInterpolatedIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.hgi_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.hgi_interpolation_scale);
+}
+
 std::string HybridSSDOInterpolatedIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/HybridGlobalIllumination/hybridSSDOInterpolatedIndirectDiffuseFragment.glsl";
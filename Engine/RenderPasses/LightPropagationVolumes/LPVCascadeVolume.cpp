@@ -0,0 +1,73 @@
+#include "LPVCascadeVolume.h"
+
+#include <algorithm>
+
+LPVCascadeVolume::LPVCascadeVolume () :
+	_cascadeIndex (0),
+	_iterations (0),
+	_minVertex (0.0f),
+	_maxVertex (0.0f)
+{
+
+}
+
+void LPVCascadeVolume::SetCascade (std::size_t cascadeIndex, const glm::vec3& minVertex,
+	const glm::vec3& maxVertex, std::size_t iterations)
+{
+	_cascadeIndex = cascadeIndex;
+	_iterations = iterations;
+
+	_minVertex = minVertex;
+	_maxVertex = maxVertex;
+}
+
+std::size_t LPVCascadeVolume::GetCascadeIndex () const
+{
+	return _cascadeIndex;
+}
+
+std::size_t LPVCascadeVolume::GetIterations () const
+{
+	return _iterations;
+}
+
+glm::vec3 LPVCascadeVolume::GetMinVertex () const
+{
+	return _minVertex;
+}
+
+glm::vec3 LPVCascadeVolume::GetMaxVertex () const
+{
+	return _maxVertex;
+}
+
+const std::vector<PipelineAttribute>& LPVCascadeVolume::GetCustomAttributes () const
+{
+	return _attributes;
+}
+
+std::size_t LPVCascadeVolume::GetCascadesCount (const RenderSettings& settings)
+{
+	/*
+	 * Without a cascade extent a single volume fits the whole scene
+	*/
+
+	if (settings.lpv_cascade_extent <= 0.0f) {
+		return 1;
+	}
+
+	return std::max ((std::size_t) 1, std::min (settings.lpv_cascades_count, (std::size_t) LPV_MAX_CASCADES));
+}
+
+std::string LPVCascadeVolume::GetCascadeName (const std::string& name, std::size_t cascadeIndex)
+{
+	/*
+	 * First cascade keeps the name of the single volume
+	*/
+
+	if (cascadeIndex == 0) {
+		return name;
+	}
+
+	return name + std::to_string (cascadeIndex);
+}
@@ -0,0 +1,45 @@
+#ifndef LPVCASCADEVOLUME_H
+#define LPVCASCADEVOLUME_H
+
+#include "Renderer/RenderVolumeI.h"
+
+#include <glm/glm.hpp>
+
+#include "Renderer/RenderSettings.h"
+
+/*
+ * Cascades sampled together by the indirect light shaders, limited by
+ * the texture units left next to the GBuffer
+*/
+
+#define LPV_MAX_CASCADES 3
+
+class LPVCascadeVolume : public RenderVolumeI
+{
+protected:
+	std::size_t _cascadeIndex;
+	std::size_t _iterations;
+
+	glm::vec3 _minVertex;
+	glm::vec3 _maxVertex;
+
+	std::vector<PipelineAttribute> _attributes;
+
+public:
+	LPVCascadeVolume ();
+
+	void SetCascade (std::size_t cascadeIndex, const glm::vec3& minVertex,
+		const glm::vec3& maxVertex, std::size_t iterations);
+
+	std::size_t GetCascadeIndex () const;
+	std::size_t GetIterations () const;
+	glm::vec3 GetMinVertex () const;
+	glm::vec3 GetMaxVertex () const;
+
+	const std::vector<PipelineAttribute>& GetCustomAttributes () const;
+
+	static std::size_t GetCascadesCount (const RenderSettings& settings);
+	static std::string GetCascadeName (const std::string& name, std::size_t cascadeIndex);
+};
+
+#endif
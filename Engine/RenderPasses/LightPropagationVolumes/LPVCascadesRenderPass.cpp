@@ -0,0 +1,282 @@
+#include "LPVCascadesRenderPass.h"
+
+#include <functional>
+
+#include "SceneNodes/SceneLayer.h"
+
+#include "Utils/Extensions/HashExtend.h"
+
+#include "Debug/Profiler/Profiler.h"
+
+LPVCascadesRenderPass::LPVCascadesRenderPass (const std::vector<ContainerRenderSubPassI*>& renderSubPasses) :
+	_renderSubPasses (renderSubPasses),
+	_lpvCascadeVolume (new LPVCascadeVolume ()),
+	_cascades ()
+{
+
+}
+
+LPVCascadesRenderPass::~LPVCascadesRenderPass ()
+{
+	delete _lpvCascadeVolume;
+
+	/*
+	 * Free memory of all sub passes
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		delete renderSubPass;
+	}
+}
+
+void LPVCascadesRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Iterate over every sub pass and initialize it
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		renderSubPass->Init (settings);
+	}
+}
+
+RenderVolumeCollection* LPVCascadesRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Get volumetric light from render volume collection
+	*/
+
+	RenderLightObject* renderLightObject = GetRenderLightObject (rvc);
+
+	std::size_t cascadesCount = LPVCascadeVolume::GetCascadesCount (settings);
+
+	if (_cascades.size () != cascadesCount) {
+		_cascades.assign (cascadesCount, CascadeState {0, nullptr, nullptr});
+	}
+
+	/*
+	 * Animated objects change the injected light every frame
+	*/
+
+	bool animated = false;
+	std::size_t sceneSignature = GetSceneSignature (renderScene, animated);
+
+	rvc->StartScope ();
+
+	for (std::size_t index = 0; index < cascadesCount; index ++) {
+
+		UpdateCascadeVolume (index, renderScene, camera, settings);
+
+		/*
+		 * Keep the cascade of the last update while nothing it depends
+		 * on changed
+		*/
+
+		std::size_t signature = GetCascadeSignature (sceneSignature, settings, renderLightObject);
+
+		CascadeState& cascade = _cascades [index];
+
+		if (animated == false && cascade.lpvVolume != nullptr && cascade.signature == signature) {
+			continue;
+		}
+
+		IterateOverSubPasses (renderScene, camera, settings, rvc);
+
+		cascade.signature = signature;
+		cascade.lpvVolume = rvc->GetRenderVolume ("LightPropagationVolume");
+		cascade.lpvGeometryVolume = rvc->GetRenderVolume ("LPVGeometryVolume");
+	}
+
+	rvc->ReleaseScope ();
+
+	/*
+	 * Outer cascades are attached with their index appended to the
+	 * name, the first one is attached last
+	*/
+
+	rvc->Insert ("LPVGeometryVolume", _cascades [0].lpvGeometryVolume);
+
+	for (std::size_t index = cascadesCount; index > 0; index --) {
+		rvc->Insert (LPVCascadeVolume::GetCascadeName ("LightPropagationVolume", index - 1),
+			_cascades [index - 1].lpvVolume);
+	}
+
+	return rvc;
+}
+
+void LPVCascadesRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Collect the mip levels of every sub pass
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		renderSubPass->DeclareGBufferMips (settings, requirements);
+	}
+}
+
+void LPVCascadesRenderPass::Clear ()
+{
+	/*
+	 * Clear every subpass
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		renderSubPass->Clear ();
+	}
+
+	_cascades.clear ();
+}
+
+bool LPVCascadesRenderPass::IsAvailable (const RenderLightObject*) const
+{
+	/*
+	 * Always execute light propagation volumes cascades render pass
+	*/
+
+	return true;
+}
+
+void LPVCascadesRenderPass::UpdateCascadeVolume (std::size_t cascadeIndex, const RenderScene* renderScene,
+	const Camera* camera, const RenderSettings& settings)
+{
+	/*
+	 * Single volume fits the scene bounding box
+	*/
+
+	if (settings.lpv_cascade_extent <= 0.0f) {
+		auto& volume = renderScene->GetBoundingBox ();
+
+		_lpvCascadeVolume->SetCascade (cascadeIndex, volume.minVertex, volume.maxVertex, settings.lpv_iterations);
+
+		return;
+	}
+
+	/*
+	 * Every cascade doubles the extent of the previous one. It is centered
+	 * on the camera and moved in whole cells, so the cells keep their
+	 * world position while the camera moves inside one.
+	*/
+
+	float extent = settings.lpv_cascade_extent * (float) (1 << cascadeIndex);
+	float cellSize = extent / settings.lpv_volume_size;
+
+	glm::vec3 minVertex = glm::floor (camera->GetPosition () / cellSize) * cellSize - glm::vec3 (extent / 2.0f);
+	glm::vec3 maxVertex = minVertex + glm::vec3 (extent);
+
+	/*
+	 * Light crosses an outer cell in the iterations needed for the two
+	 * cells of the cascade below it
+	*/
+
+	std::size_t iterations = std::max ((std::size_t) 1, settings.lpv_iterations >> cascadeIndex);
+
+	_lpvCascadeVolume->SetCascade (cascadeIndex, minVertex, maxVertex, iterations);
+}
+
+void LPVCascadesRenderPass::IterateOverSubPasses (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Insert cascade in render volume collection
+	 * In this way it could be obtained at pass execution
+	*/
+
+	static RenderVolumeHandle cascadeVolumeHandle = RenderVolumeCollection::GetHandle ("LPVCascadeVolume");
+
+	rvc->Insert (cascadeVolumeHandle, _lpvCascadeVolume, false);
+
+	/*
+	 * Sub passes are drawn as part of this pass, the frame graph plan
+	 * stays the same while cascades are skipped
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+
+		PROFILER_LOGGER(renderSubPass->GetName ())
+		PROFILER_GPU_LOGGER(renderSubPass->GetName ())
+
+		if (!renderSubPass->IsAvailable (renderScene, camera, settings, rvc)) {
+			continue;
+		}
+
+		rvc = renderSubPass->Execute (renderScene, camera, settings, rvc);
+	}
+}
+
+std::size_t LPVCascadesRenderPass::GetSceneSignature (const RenderScene* renderScene, bool& animated) const
+{
+	std::size_t signature = 0;
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		if (renderObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+			continue;
+		}
+
+		if (renderObject->GetSceneLayers () & SceneLayer::ANIMATION) {
+			animated = true;
+		}
+
+		/*
+		 * Model matrix changes when an object rotates in place as well,
+		 * unlike its bounding box
+		*/
+
+		Extensions::HashExtend::Combine (signature, renderObject);
+		Extensions::HashExtend::Combine (signature, renderObject->GetTransform ()->GetModelMatrix ());
+	}
+
+	return signature;
+}
+
+std::size_t LPVCascadesRenderPass::GetCascadeSignature (std::size_t sceneSignature, const RenderSettings& settings,
+	const RenderLightObject* renderLightObject) const
+{
+	std::size_t signature = sceneSignature;
+
+	/*
+	 * Cascade placement
+	*/
+
+	glm::vec3 minVertex = _lpvCascadeVolume->GetMinVertex ();
+	glm::vec3 maxVertex = _lpvCascadeVolume->GetMaxVertex ();
+
+	for (std::size_t axis = 0; axis < 3; axis ++) {
+		Extensions::HashExtend::Combine (signature, minVertex [axis]);
+		Extensions::HashExtend::Combine (signature, maxVertex [axis]);
+	}
+
+	/*
+	 * Light direction, color and shadow resolution
+	*/
+
+	glm::quat lightRotation = renderLightObject->GetTransform ()->GetRotation ();
+	Color lightColor = renderLightObject->GetLightColor ();
+	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
+
+	for (std::size_t component = 0; component < 4; component ++) {
+		Extensions::HashExtend::Combine (signature, lightRotation [component]);
+	}
+
+	Extensions::HashExtend::Combine (signature, ((std::size_t) lightColor.r << 16) | ((std::size_t) lightColor.g << 8) | lightColor.b);
+	Extensions::HashExtend::Combine (signature, renderLightObject->GetLightIntensity ());
+	Extensions::HashExtend::Combine (signature, shadow.resolution.x);
+	Extensions::HashExtend::Combine (signature, shadow.resolution.y);
+
+	/*
+	 * Settings used by injection and propagation
+	*/
+
+	Extensions::HashExtend::Combine (signature, settings.lpv_volume_size);
+	Extensions::HashExtend::Combine (signature, _lpvCascadeVolume->GetIterations ());
+	Extensions::HashExtend::Combine (signature, settings.lpv_injection_bias);
+	Extensions::HashExtend::Combine (signature, settings.lpv_geometry_occlusion);
+
+	return signature;
+}
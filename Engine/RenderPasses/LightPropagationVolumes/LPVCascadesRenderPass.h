@@ -0,0 +1,57 @@
+#ifndef LPVCASCADESRENDERPASS_H
+#define LPVCASCADESRENDERPASS_H
+
+#include "RenderPasses/VolumetricLightRenderPassI.h"
+
+#include <vector>
+
+#include "LPVCascadeVolume.h"
+
+/*
+ * Runs the light propagation volume sub passes once for every camera
+ * following cascade. A cascade is injected and propagated again only
+ * when the light, the scene or its own origin changed, otherwise the
+ * volumes of the last update are kept.
+*/
+
+class ENGINE_API LPVCascadesRenderPass : public VolumetricLightRenderPassI
+{
+	DECLARE_RENDER_PASS(LPVCascadesRenderPass)
+
+protected:
+	struct CascadeState
+	{
+		std::size_t signature;
+		RenderVolumeI* lpvVolume;
+		RenderVolumeI* lpvGeometryVolume;
+	};
+
+	std::vector<ContainerRenderSubPassI*> _renderSubPasses;
+	LPVCascadeVolume* _lpvCascadeVolume;
+	std::vector<CascadeState> _cascades;
+
+public:
+	LPVCascadesRenderPass (const std::vector<ContainerRenderSubPassI*>& renderSubPasses);
+	~LPVCascadesRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
+
+	void Clear ();
+protected:
+	bool IsAvailable (const RenderLightObject*) const;
+
+	void UpdateCascadeVolume (std::size_t cascadeIndex, const RenderScene* renderScene,
+		const Camera* camera, const RenderSettings& settings);
+	void IterateOverSubPasses (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::size_t GetSceneSignature (const RenderScene* renderScene, bool& animated) const;
+	std::size_t GetCascadeSignature (std::size_t sceneSignature, const RenderSettings& settings,
+		const RenderLightObject* renderLightObject) const;
+};
+
+#endif
@@ -136,7 +136,7 @@ void LPVEmissiveRadianceInjectionRenderPass::GeometryVoxelizationPass (const Ren
 		 * Check if the object is emissive
 		*/
 
-		auto modelView = renderObject->GetModelView ();
+		auto& modelView = renderObject->GetModelView ();
 
 		bool isEmissive = false; 
 
@@ -1,5 +1,7 @@
 #include "LPVIndirectDiffuseLightRenderPass.h"
 
+#include "LPVCascadeVolume.h"
+
 #include "Debug/Statistics/StatisticsManager.h"
 #include "LPVStatisticsObject.h"
 
@@ -13,6 +15,20 @@ bool LPVIndirectDiffuseLightRenderPass::IsAvailable (const RenderScene* renderSc
 	return true;
 }
 
+std::vector<std::string> LPVIndirectDiffuseLightRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Cascades above the first one are sampled only when they exist
+	*/
+
+	return { "LPV_CASCADES " + std::to_string (LPVCascadeVolume::GetCascadesCount (settings)) };
+}
+
+PostProcessDefinesKey LPVIndirectDiffuseLightRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { LPVCascadeVolume::GetCascadesCount (settings) };
+}
+
 std::string LPVIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesIndirectDiffuseFragment.glsl";
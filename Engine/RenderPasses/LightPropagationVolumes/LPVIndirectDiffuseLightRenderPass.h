@@ -11,6 +11,9 @@ public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
 protected:
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
+
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;
 	glm::ivec2 GetPostProcessVolumeResolution (const RenderSettings& settings) const;
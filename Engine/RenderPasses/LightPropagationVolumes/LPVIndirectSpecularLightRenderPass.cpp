@@ -1,5 +1,7 @@
 #include "LPVIndirectSpecularLightRenderPass.h"
 
+#include "LPVCascadeVolume.h"
+
 #include "Debug/Statistics/StatisticsManager.h"
 #include "LPVStatisticsObject.h"
 
@@ -13,6 +15,20 @@ bool LPVIndirectSpecularLightRenderPass::IsAvailable (const RenderScene* renderS
 	return true;
 }
 
+std::vector<std::string> LPVIndirectSpecularLightRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Cascades above the first one are sampled only when they exist
+	*/
+
+	return { "LPV_CASCADES " + std::to_string (LPVCascadeVolume::GetCascadesCount (settings)) };
+}
+
+PostProcessDefinesKey LPVIndirectSpecularLightRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { LPVCascadeVolume::GetCascadesCount (settings) };
+}
+
 std::string LPVIndirectSpecularLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesIndirectSpecularFragment.glsl";
@@ -1,5 +1,7 @@
 #include "LPVPropagationRenderPass.h"
 
+#include <algorithm>
+
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
@@ -11,14 +13,17 @@
 
 LPVPropagationRenderPass::LPVPropagationRenderPass () :
 	_lpvPropagationVolume (new LPVPropagationVolume ()),
-	_lpvAccumulationVolume (new LPVPropagationVolume ())
+	_lpvAccumulationVolumes ()
 {
 
 }
 
 LPVPropagationRenderPass::~LPVPropagationRenderPass ()
 {
-	delete _lpvAccumulationVolume;
+	for (LPVPropagationVolume* lpvAccumulationVolume : _lpvAccumulationVolumes) {
+		delete lpvAccumulationVolume;
+	}
+
 	delete _lpvPropagationVolume;
 }
 
@@ -47,7 +52,10 @@ void LPVPropagationRenderPass::Clear ()
 	 * Clear post processing volume
 	*/
 
-	_lpvAccumulationVolume->Clear ();
+	for (LPVPropagationVolume* lpvAccumulationVolume : _lpvAccumulationVolumes) {
+		lpvAccumulationVolume->Clear ();
+	}
+
 	_lpvPropagationVolume->Clear ();
 }
 
@@ -60,17 +68,25 @@ RenderVolumeCollection* LPVPropagationRenderPass::Execute (const RenderScene* re
 
 	UpdateLPVVolume (settings);
 
+	/*
+	 * Light is accumulated in the volume of the current cascade
+	*/
+
+	auto lpvCascadeVolume = (LPVCascadeVolume*) rvc->GetRenderVolume ("LPVCascadeVolume");
+
+	LPVPropagationVolume* lpvAccumulationVolume = _lpvAccumulationVolumes [lpvCascadeVolume->GetCascadeIndex ()];
+
 	/*
 	 * Start screen space ambient occlusion generation pass
 	*/
 
-	StartPostProcessPass ();
+	StartPostProcessPass (lpvAccumulationVolume);
 
 	/*
 	 * Screen space ambient occlusion generation pass
 	*/
 
-	PostProcessPass (renderScene, camera, settings, rvc);
+	PostProcessPass (renderScene, camera, settings, lpvCascadeVolume, lpvAccumulationVolume, rvc);
 
 	/*
 	 * End screen space ambient occlusion generation pass
@@ -78,7 +94,7 @@ RenderVolumeCollection* LPVPropagationRenderPass::Execute (const RenderScene* re
 
 	EndPostProcessPass ();
 
-	return rvc->Insert ("LightPropagationVolume", _lpvAccumulationVolume);
+	return rvc->Insert ("LightPropagationVolume", lpvAccumulationVolume);
 }
 
 bool LPVPropagationRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
@@ -91,10 +107,10 @@ bool LPVPropagationRenderPass::IsAvailable (const RenderScene* renderScene, cons
 	return true;
 }
 
-void LPVPropagationRenderPass::StartPostProcessPass ()
+void LPVPropagationRenderPass::StartPostProcessPass (LPVPropagationVolume* lpvAccumulationVolume)
 {
 	_lpvPropagationVolume->ClearVolume ();
-	_lpvAccumulationVolume->ClearVolume ();
+	lpvAccumulationVolume->ClearVolume ();
 
 	/*
 	 * Bind screen space ambient occlusion volume for writing
@@ -104,19 +120,24 @@ void LPVPropagationRenderPass::StartPostProcessPass ()
 }
 
 void LPVPropagationRenderPass::PostProcessPass (const RenderScene* renderScene, const Camera* camera,
-	const RenderSettings& settings, RenderVolumeCollection* rvc)
+	const RenderSettings& settings, const LPVCascadeVolume* lpvCascadeVolume,
+	LPVPropagationVolume* lpvAccumulationVolume, RenderVolumeCollection* rvc)
 {
 	LPVPropagationVolume* lpvVolume = (LPVPropagationVolume*) rvc->GetRenderVolume ("LightPropagationVolume");
 	LPVGeometryVolume* lpvGeometryVolume = (LPVGeometryVolume*) rvc->GetRenderVolume ("LPVGeometryVolume");
 
 	_lpvPropagationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
-	_lpvAccumulationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
+	lpvAccumulationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
 
-	for (std::size_t index = 0; index < settings.lpv_iterations; index ++) {
+	/*
+	 * Outer cascades need less iterations to carry light as far
+	*/
+
+	for (std::size_t index = 0; index < lpvCascadeVolume->GetIterations (); index ++) {
 
 		Pipeline::SendCustomAttributes (_shaderView, lpvGeometryVolume->GetCustomAttributes ());
 
-		_lpvAccumulationVolume->BindForWriting (3);
+		lpvAccumulationVolume->BindForWriting (3);
 
 		if ((index & 1) == 0) {
 			_lpvPropagationVolume->BindForWriting ();
@@ -156,25 +177,68 @@ void LPVPropagationRenderPass::InitLPVVolume (const RenderSettings& settings)
 		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
 	}
 
-	if (!_lpvAccumulationVolume->Init (settings.lpv_volume_size)) {
+	/*
+	 * Initialize an accumulation volume for every cascade
+	*/
+
+	_lpvAccumulationVolumes.resize (LPVCascadeVolume::GetCascadesCount (settings), nullptr);
+
+	for (std::size_t index = 0; index < _lpvAccumulationVolumes.size (); index ++) {
+		InitLPVAccumulationVolume (index, settings);
+	}
+}
+
+void LPVPropagationRenderPass::InitLPVAccumulationVolume (std::size_t cascadeIndex, const RenderSettings& settings)
+{
+	LPVPropagationVolume*& lpvAccumulationVolume = _lpvAccumulationVolumes [cascadeIndex];
+
+	if (lpvAccumulationVolume == nullptr) {
+		lpvAccumulationVolume = new LPVPropagationVolume ();
+	}
+
+	if (!lpvAccumulationVolume->Init (settings.lpv_volume_size)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
 		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
 	}
+
+	/*
+	 * Indirect light passes sample every cascade at once
+	*/
+
+	std::string cascadeName = LPVCascadeVolume::GetCascadeName ("", cascadeIndex);
+
+	lpvAccumulationVolume->SetAttributesSuffix (cascadeName);
 }
 
 void LPVPropagationRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 {
-	if (_lpvPropagationVolume->GetVolumeSize () != settings.lpv_volume_size) {
+	if (_lpvPropagationVolume->GetVolumeSize () != settings.lpv_volume_size ||
+		_lpvAccumulationVolumes.size () != LPVCascadeVolume::GetCascadesCount (settings)) {
 
 		/*
 		 * Clear voxel volume
 		*/
 
-		_lpvAccumulationVolume->Clear ();
+		for (LPVPropagationVolume* lpvAccumulationVolume : _lpvAccumulationVolumes) {
+			lpvAccumulationVolume->Clear ();
+		}
+
 		_lpvPropagationVolume->Clear ();
 
+		/*
+		 * Release the volumes of the removed cascades
+		*/
+
+		std::size_t cascadesCount = LPVCascadeVolume::GetCascadesCount (settings);
+
+		for (std::size_t index = cascadesCount; index < _lpvAccumulationVolumes.size (); index ++) {
+			delete _lpvAccumulationVolumes [index];
+		}
+
+		_lpvAccumulationVolumes.resize (std::min (cascadesCount, _lpvAccumulationVolumes.size ()));
+
 		/*
 		 * Initialize voxel volume
 		*/
@@ -6,7 +6,10 @@
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/ShaderView.h"
 
+#include <vector>
+
 #include "LPVPropagationVolume.h"
+#include "LPVCascadeVolume.h"
 
 class ENGINE_API LPVPropagationRenderPass : public ContainerRenderSubPassI
 {
@@ -15,7 +18,7 @@ class ENGINE_API LPVPropagationRenderPass : public ContainerRenderSubPassI
 protected:
 	Resource<ShaderView> _shaderView;
 	LPVPropagationVolume* _lpvPropagationVolume;
-	LPVPropagationVolume* _lpvAccumulationVolume;
+	std::vector<LPVPropagationVolume*> _lpvAccumulationVolumes;
 
 public:
 	LPVPropagationRenderPass ();
@@ -30,12 +33,14 @@ protected:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
 
-	void StartPostProcessPass ();
+	void StartPostProcessPass (LPVPropagationVolume* lpvAccumulationVolume);
 	void PostProcessPass (const RenderScene* renderScene, const Camera* camera,
-		const RenderSettings& settings, RenderVolumeCollection* rvc);
+		const RenderSettings& settings, const LPVCascadeVolume* lpvCascadeVolume,
+		LPVPropagationVolume* lpvAccumulationVolume, RenderVolumeCollection* rvc);
 	void EndPostProcessPass ();
 
 	void InitLPVVolume (const RenderSettings& settings);
+	void InitLPVAccumulationVolume (std::size_t cascadeIndex, const RenderSettings& settings);
 	void UpdateLPVVolume (const RenderSettings& settings);
 };
 
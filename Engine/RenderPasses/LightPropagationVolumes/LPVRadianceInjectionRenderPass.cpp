@@ -1,5 +1,7 @@
 #include "LPVRadianceInjectionRenderPass.h"
 
+#include <algorithm>
+
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
@@ -9,14 +11,17 @@
 
 LPVRadianceInjectionRenderPass::LPVRadianceInjectionRenderPass () :
 	_lpvVolume (new LPVVolume ()),
-	_lpvGeometryVolume (new LPVGeometryVolume ())
+	_lpvGeometryVolumes ()
 {
 
 }
 
 LPVRadianceInjectionRenderPass::~LPVRadianceInjectionRenderPass ()
 {
-	delete _lpvGeometryVolume;
+	for (LPVGeometryVolume* lpvGeometryVolume : _lpvGeometryVolumes) {
+		delete lpvGeometryVolume;
+	}
+
 	delete _lpvVolume;
 }
 
@@ -46,7 +51,10 @@ void LPVRadianceInjectionRenderPass::Clear ()
 	 * Clear post processing volume
 	*/
 
-	_lpvGeometryVolume->Clear ();
+	for (LPVGeometryVolume* lpvGeometryVolume : _lpvGeometryVolumes) {
+		lpvGeometryVolume->Clear ();
+	}
+
 	_lpvVolume->Clear ();
 }
 
@@ -65,17 +73,32 @@ RenderVolumeCollection* LPVRadianceInjectionRenderPass::Execute (const RenderSce
 
 	UpdateLPVVolume (settings);
 
+	/*
+	 * Geometry volume is kept for every cascade, since the ambient
+	 * occlusion reads it while the cascade is not updated
+	*/
+
+	auto lpvCascadeVolume = (LPVCascadeVolume*) rvc->GetRenderVolume ("LPVCascadeVolume");
+
+	LPVGeometryVolume* lpvGeometryVolume = _lpvGeometryVolumes [lpvCascadeVolume->GetCascadeIndex ()];
+
+	/*
+	 * Update voxel volume based on cascade bounding box
+	*/
+
+	UpdateLPVVolumeBoundingBox (lpvCascadeVolume, lpvGeometryVolume);
+
 	/*
 	 * Start screen space ambient occlusion generation pass
 	*/
 
-	StartPostProcessPass ();
+	StartPostProcessPass (lpvGeometryVolume);
 
 	/*
 	 * Screen space ambient occlusion generation pass
 	*/
 
-	PostProcessPass (renderScene, camera, settings, renderLightObject, rvc);
+	PostProcessPass (renderScene, camera, settings, renderLightObject, lpvGeometryVolume, rvc);
 
 	/*
 	 * End screen space ambient occlusion generation pass
@@ -84,7 +107,7 @@ RenderVolumeCollection* LPVRadianceInjectionRenderPass::Execute (const RenderSce
 	EndPostProcessPass ();
 
 	return rvc->Insert ("LightPropagationVolume", _lpvVolume)
-		->Insert ("LPVGeometryVolume", _lpvGeometryVolume);
+		->Insert ("LPVGeometryVolume", lpvGeometryVolume);
 }
 
 bool LPVRadianceInjectionRenderPass::IsAvailable (const RenderLightObject*) const
@@ -96,9 +119,9 @@ bool LPVRadianceInjectionRenderPass::IsAvailable (const RenderLightObject*) cons
 	return true;
 }
 
-void LPVRadianceInjectionRenderPass::StartPostProcessPass ()
+void LPVRadianceInjectionRenderPass::StartPostProcessPass (LPVGeometryVolume* lpvGeometryVolume)
 {
-	_lpvGeometryVolume->ClearVolume ();
+	lpvGeometryVolume->ClearVolume ();
 	_lpvVolume->ClearVolume ();
 
 	/*
@@ -106,19 +129,14 @@ void LPVRadianceInjectionRenderPass::StartPostProcessPass ()
 	*/
 
 	_lpvVolume->BindForWriting ();
-	_lpvGeometryVolume->BindForWriting ();
+	lpvGeometryVolume->BindForWriting ();
 }
 
 void LPVRadianceInjectionRenderPass::PostProcessPass (const RenderScene* renderScene,
 	const Camera* camera, const RenderSettings& settings,
-	const RenderLightObject* renderLightObject, RenderVolumeCollection* rvc)
+	const RenderLightObject* renderLightObject, LPVGeometryVolume* lpvGeometryVolume,
+	RenderVolumeCollection* rvc)
 {
-	/*
-	 * Update voxel volume based on scene bounding box
-	*/
-
-	UpdateLPVVolumeBoundingBox (renderScene);
-
 	/*
 	 * Set viewport
 	*/
@@ -209,15 +227,14 @@ std::vector<PipelineAttribute> LPVRadianceInjectionRenderPass::GetCustomAttribut
 	return attributes;
 }
 
-void LPVRadianceInjectionRenderPass::UpdateLPVVolumeBoundingBox (const RenderScene* renderScene)
+void LPVRadianceInjectionRenderPass::UpdateLPVVolumeBoundingBox (const LPVCascadeVolume* lpvCascadeVolume,
+	LPVGeometryVolume* lpvGeometryVolume)
 {
-	auto& volume = renderScene->GetBoundingBox ();
-
-	glm::vec3 minVertex = volume.minVertex;
-	glm::vec3 maxVertex = volume.maxVertex;
+	glm::vec3 minVertex = lpvCascadeVolume->GetMinVertex ();
+	glm::vec3 maxVertex = lpvCascadeVolume->GetMaxVertex ();
 
 	_lpvVolume->UpdateBoundingBox (minVertex, maxVertex);
-	_lpvGeometryVolume->UpdateBoundingBox (minVertex, maxVertex);
+	lpvGeometryVolume->UpdateBoundingBox (minVertex, maxVertex);
 }
 
 void LPVRadianceInjectionRenderPass::InitLPVVolume (const RenderSettings& settings)
@@ -229,7 +246,24 @@ void LPVRadianceInjectionRenderPass::InitLPVVolume (const RenderSettings& settin
 		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
 	}
 
-	if (!_lpvGeometryVolume->Init (settings.lpv_volume_size)) {
+	/*
+	 * Initialize a geometry volume for every cascade
+	*/
+
+	_lpvGeometryVolumes.resize (LPVCascadeVolume::GetCascadesCount (settings), nullptr);
+
+	for (LPVGeometryVolume*& lpvGeometryVolume : _lpvGeometryVolumes) {
+		if (lpvGeometryVolume == nullptr) {
+			lpvGeometryVolume = new LPVGeometryVolume ();
+		}
+
+		InitLPVGeometryVolume (lpvGeometryVolume, settings);
+	}
+}
+
+void LPVRadianceInjectionRenderPass::InitLPVGeometryVolume (LPVGeometryVolume* lpvGeometryVolume, const RenderSettings& settings)
+{
+	if (!lpvGeometryVolume->Init (settings.lpv_volume_size)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
@@ -239,15 +273,31 @@ void LPVRadianceInjectionRenderPass::InitLPVVolume (const RenderSettings& settin
 
 void LPVRadianceInjectionRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 {
-	if (_lpvVolume->GetVolumeSize () != settings.lpv_volume_size) {
+	if (_lpvVolume->GetVolumeSize () != settings.lpv_volume_size ||
+		_lpvGeometryVolumes.size () != LPVCascadeVolume::GetCascadesCount (settings)) {
 
 		/*
 		 * Clear voxel volume
 		*/
 
-		_lpvGeometryVolume->Clear ();
+		for (LPVGeometryVolume* lpvGeometryVolume : _lpvGeometryVolumes) {
+			lpvGeometryVolume->Clear ();
+		}
+
 		_lpvVolume->Clear ();
 
+		/*
+		 * Release the volumes of the removed cascades
+		*/
+
+		std::size_t cascadesCount = LPVCascadeVolume::GetCascadesCount (settings);
+
+		for (std::size_t index = cascadesCount; index < _lpvGeometryVolumes.size (); index ++) {
+			delete _lpvGeometryVolumes [index];
+		}
+
+		_lpvGeometryVolumes.resize (std::min (cascadesCount, _lpvGeometryVolumes.size ()));
+
 		/*
 		 * Initialize voxel volume
 		*/
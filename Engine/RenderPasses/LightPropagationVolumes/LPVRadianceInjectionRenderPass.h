@@ -6,8 +6,11 @@
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/ShaderView.h"
 
+#include <vector>
+
 #include "LPVVolume.h"
 #include "LPVGeometryVolume.h"
+#include "LPVCascadeVolume.h"
 
 class ENGINE_API LPVRadianceInjectionRenderPass : public VolumetricLightRenderPassI
 {
@@ -16,7 +19,7 @@ class ENGINE_API LPVRadianceInjectionRenderPass : public VolumetricLightRenderPa
 protected:
 	Resource<ShaderView> _shaderView;
 	LPVVolume* _lpvVolume;
-	LPVGeometryVolume* _lpvGeometryVolume;
+	std::vector<LPVGeometryVolume*> _lpvGeometryVolumes;
 
 public:
 	LPVRadianceInjectionRenderPass ();
@@ -30,17 +33,19 @@ public:
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
-	void StartPostProcessPass ();
+	void StartPostProcessPass (LPVGeometryVolume* lpvGeometryVolume);
 	void PostProcessPass (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderLightObject* renderLightObject,
-		RenderVolumeCollection* rvc);
+		LPVGeometryVolume* lpvGeometryVolume, RenderVolumeCollection* rvc);
 	void EndPostProcessPass ();
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const RenderSettings& settings,
 		const RenderLightObject* renderLightObject) const;
 
-	void UpdateLPVVolumeBoundingBox (const RenderScene* renderScene);
+	void UpdateLPVVolumeBoundingBox (const LPVCascadeVolume* lpvCascadeVolume,
+		LPVGeometryVolume* lpvGeometryVolume);
 	void InitLPVVolume (const RenderSettings& settings);
+	void InitLPVGeometryVolume (LPVGeometryVolume* lpvGeometryVolume, const RenderSettings& settings);
 	void UpdateLPVVolume (const RenderSettings& settings);
 };
 
@@ -176,6 +176,17 @@ void LPVVolume::UpdateBoundingBox(const glm::vec3& minVertex, const glm::vec3& m
 	_attributes [4].value = _maxVertex;
 }
 
+void LPVVolume::SetAttributesSuffix (const std::string& suffix)
+{
+	/*
+	 * Attributes are created again at initialization, rename them after
+	*/
+
+	for (auto& attribute : _attributes) {
+		attribute.name += suffix;
+	}
+}
+
 std::size_t LPVVolume::GetVolumeSize () const
 {
 	return _volumeSize;
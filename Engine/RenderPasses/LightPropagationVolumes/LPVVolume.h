@@ -34,6 +34,8 @@ public:
 	virtual void ClearVolume();
 	virtual void UpdateBoundingBox (const glm::vec3& minVertex, const glm::vec3& maxVertex);
 
+	void SetAttributesSuffix (const std::string& suffix);
+
 	std::size_t GetVolumeSize () const;
 	glm::vec3 GetMinVertex () const;
 	glm::vec3 GetMaxVertex () const;
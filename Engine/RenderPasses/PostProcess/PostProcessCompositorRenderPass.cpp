@@ -0,0 +1,183 @@
+#include "PostProcessCompositorRenderPass.h"
+
+#include "Resources/Resources.h"
+
+#include "Renderer/RenderSystem.h"
+
+bool PostProcessCompositorRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Check if post process compositor is enabled and has a stage to run
+	*/
+
+	return settings.post_process_compositor_enabled && GetPostProcessDefinesKey (settings) != PostProcessDefinesKey ();
+}
+
+std::string PostProcessCompositorRenderPass::GetPostProcessFragmentShaderPath () const
+{
+	return "Assets/Shaders/PostProcess/postProcessCompositorFragment.glsl";
+}
+
+std::string PostProcessCompositorRenderPass::GetPostProcessVolumeName () const
+{
+	return "PostProcessMapVolume";
+}
+
+glm::ivec2 PostProcessCompositorRenderPass::GetPostProcessVolumeResolution (const RenderSettings& settings) const
+{
+	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
+}
+
+FramebufferRenderVolume* PostProcessCompositorRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+{
+	Resource<Texture> texture = Resource<Texture> (new Texture ("postProcessMap"));
+
+	glm::ivec2 size = GetPostProcessVolumeResolution (settings);
+
+	texture->SetSize (Size (size.x, size.y));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGB16);
+	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGB);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetAnisotropicFiltering (false);
+
+	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
+
+	return new FramebufferRenderVolume (framebuffer);
+}
+
+std::vector<PipelineAttribute> PostProcessCompositorRenderPass::GetCustomAttributes (const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Attach post process volume attributes to pipeline
+	*/
+
+	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+
+	/*
+	 * Attach the attributes of every enabled stage
+	*/
+
+	if (settings.bloom_enabled == true) {
+		PipelineAttribute bloomIntensity;
+
+		bloomIntensity.type = PipelineAttribute::AttrType::ATTR_1F;
+		bloomIntensity.name = "bloomIntensity";
+		bloomIntensity.value.x = settings.bloom_intensity;
+
+		attributes.push_back (bloomIntensity);
+	}
+
+	if (settings.hdr_enabled == true) {
+		PipelineAttribute exposure;
+
+		exposure.type = PipelineAttribute::AttrType::ATTR_1F;
+		exposure.name = "exposure";
+		exposure.value.x = settings.hdr_exposure;
+
+		attributes.push_back (exposure);
+	}
+
+	if (settings.lut_enabled == true) {
+		PipelineAttribute lutTexture;
+		PipelineAttribute lutIntensity;
+
+		lutTexture.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
+		lutIntensity.type = PipelineAttribute::AttrType::ATTR_1F;
+
+		lutTexture.name = "lutTexture";
+		lutIntensity.name = "lutIntensity";
+
+		lutTexture.value.x = _lutTextureView->GetGPUIndex ();
+		lutIntensity.value.x = settings.lut_intensity;
+
+		attributes.push_back (lutTexture);
+		attributes.push_back (lutIntensity);
+	}
+
+	return attributes;
+}
+
+void PostProcessCompositorRenderPass::UpdatePostProcessSettings (const RenderSettings& settings)
+{
+	/*
+	 * Update post process volume
+	*/
+
+	PostProcessRenderPass::UpdatePostProcessSettings (settings);
+
+	/*
+	 * Update texture LUT view
+	*/
+
+	if (settings.lut_enabled == true) {
+		UpdateTextureLUTView (settings);
+	}
+}
+
+void PostProcessCompositorRenderPass::UpdateTextureLUTView (const RenderSettings& settings)
+{
+	if (_lutTexturePath == settings.lut_texture_path) {
+		return;
+	}
+
+	_lutTexturePath = settings.lut_texture_path;
+
+	/*
+	 * Initialize texture LUT view
+	*/
+
+	Resource<Texture> lutTexture = Resources::LoadTexture (settings.lut_texture_path);
+
+	/*
+	 * Share the view of texture LUT render pass, which may have renamed
+	 * the texture already
+	*/
+
+	const std::string viewSuffix = "View";
+	const std::string& name = lutTexture->GetName ();
+
+	if (name.size () < viewSuffix.size () || name.compare (name.size () - viewSuffix.size (), viewSuffix.size (), viewSuffix) != 0) {
+		lutTexture->SetName (name + viewSuffix);
+	}
+
+	_lutTextureView = RenderSystem::LoadTextureLUT (lutTexture);
+}
+
+std::vector<std::string> PostProcessCompositorRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Stages are fused in the order the separate passes run
+	*/
+
+	std::vector<std::string> defines;
+
+	if (settings.bloom_enabled == true) {
+		defines.push_back ("BLOOM_ENABLED");
+	}
+
+	if (settings.hdr_enabled == true) {
+		defines.push_back ("HDR_ENABLED");
+	}
+
+	if (settings.lut_enabled == true) {
+		defines.push_back ("LUT_ENABLED");
+	}
+
+	if (settings.gamma_enabled == true) {
+		defines.push_back ("GAMMA_ENABLED");
+	}
+
+	return defines;
+}
+
+PostProcessDefinesKey PostProcessCompositorRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { settings.bloom_enabled, settings.hdr_enabled,
+		settings.lut_enabled, settings.gamma_enabled };
+}
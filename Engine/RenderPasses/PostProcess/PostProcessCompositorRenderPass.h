@@ -0,0 +1,43 @@
+#ifndef POSTPROCESSCOMPOSITORRENDERPASS_H
+#define POSTPROCESSCOMPOSITORRENDERPASS_H
+
+#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+
+#include "Renderer/RenderViews/TextureLUTView.h"
+
+/*
+ * Runs bloom accumulation, high dynamic range, texture LUT and gamma
+ * correction as a single full screen pass. The shader variant is built
+ * from the stages enabled in render settings, so only those are paid
+ * for, while the separate passes step aside.
+*/
+
+class ENGINE_API PostProcessCompositorRenderPass : public PostProcessRenderPass
+{
+	DECLARE_RENDER_PASS(PostProcessCompositorRenderPass)
+
+protected:
+	std::string _lutTexturePath;
+	Resource<TextureView> _lutTextureView;
+
+public:
+	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+protected:
+	std::string GetPostProcessFragmentShaderPath () const;
+	std::string GetPostProcessVolumeName () const;
+	glm::ivec2 GetPostProcessVolumeResolution (const RenderSettings& settings) const;
+	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+
+	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	void UpdatePostProcessSettings (const RenderSettings& settings);
+
+	void UpdateTextureLUTView (const RenderSettings& settings);
+
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
+};
+
+#endif
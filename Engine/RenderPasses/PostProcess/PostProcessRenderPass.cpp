@@ -3,6 +3,7 @@
 #include "RenderPasses/GBuffer.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/FrameGraph.h"
 
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
@@ -10,7 +11,8 @@
 #include "Core/Console/Console.h"
 
 PostProcessRenderPass::PostProcessRenderPass () :
-	_postProcessMapVolume (nullptr)
+	_postProcessMapVolume (nullptr),
+	_postProcessVolumeHandle (0)
 {
 
 }
@@ -21,10 +23,13 @@ void PostProcessRenderPass::Init (const RenderSettings& settings)
 	 * Initialize post processing shader
 	*/
 
+	_defines = GetPostProcessDefines (settings);
+	_definesKey = GetPostProcessDefinesKey (settings);
+
 	Resource<Shader> shader = Resources::LoadShader ({
 		"Assets/Shaders/PostProcess/postProcessVertex.glsl",
 		GetPostProcessFragmentShaderPath ()
-	});
+	}, _defines);
 
 	_shaderView = RenderSystem::LoadShader (shader);
 
@@ -33,6 +38,12 @@ void PostProcessRenderPass::Init (const RenderSettings& settings)
 	*/
 
 	_postProcessMapVolume = CreatePostProcessVolume (settings);
+
+	/*
+	 * Resolve post processing volume name
+	*/
+
+	_postProcessVolumeHandle = RenderVolumeCollection::GetHandle (GetPostProcessVolumeName ());
 }
 
 void PostProcessRenderPass::Clear ()
@@ -53,6 +64,21 @@ RenderVolumeCollection* PostProcessRenderPass::Execute (const RenderScene* rende
 
 	UpdatePostProcessSettings (settings);
 
+	/*
+	 * Update shader variant
+	*/
+
+	UpdatePostProcessShader (settings);
+
+	/*
+	 * Post processing volume only lives until its last reader, take
+	 * its framebuffer from the frame graph pool
+	*/
+
+	if (rvc->GetFrameGraph () != nullptr) {
+		rvc->GetFrameGraph ()->AcquireTransient (_postProcessMapVolume);
+	}
+
 	/*
 	 * Start screen space ambient occlusion generation pass
 	*/
@@ -71,7 +97,7 @@ RenderVolumeCollection* PostProcessRenderPass::Execute (const RenderScene* rende
 
 	EndPostProcessPass ();
 
-	return rvc->Insert (GetPostProcessVolumeName (), _postProcessMapVolume);
+	return rvc->Insert (_postProcessVolumeHandle, _postProcessMapVolume);
 }
 
 void PostProcessRenderPass::StartPostProcessPass ()
@@ -120,7 +146,9 @@ void PostProcessRenderPass::PostProcessPass (const RenderScene* renderScene, con
 	 * Update matrices
 	*/
 
-	Pipeline::CreateProjection (((GBuffer*) rvc->GetRenderVolume ("GBuffer"))->GetProjectionMatrix ());
+	static RenderVolumeHandle gBufferHandle = RenderVolumeCollection::GetHandle ("GBuffer");
+
+	Pipeline::CreateProjection (((GBuffer*) rvc->GetRenderVolume (gBufferHandle))->GetProjectionMatrix ());
 	Pipeline::SendCamera (camera);
 	Pipeline::SetObjectTransform (Transform::Default ());
 
@@ -171,6 +199,55 @@ void PostProcessRenderPass::UpdatePostProcessSettings (const RenderSettings& set
 	}
 }
 
+void PostProcessRenderPass::UpdatePostProcessShader (const RenderSettings& settings)
+{
+	/*
+	 * Defines are rebuilt only when the settings feeding them change
+	*/
+
+	PostProcessDefinesKey definesKey = GetPostProcessDefinesKey (settings);
+
+	if (_definesKey == definesKey) {
+		return;
+	}
+
+	_definesKey = definesKey;
+
+	std::vector<std::string> defines = GetPostProcessDefines (settings);
+
+	if (_defines == defines) {
+		return;
+	}
+
+	_defines = defines;
+
+	/*
+	 * Variants are cached by their defines, so switching back to a
+	 * combination used before does not compile it again
+	*/
+
+	Resource<Shader> shader = Resources::LoadShader ({
+		"Assets/Shaders/PostProcess/postProcessVertex.glsl",
+		GetPostProcessFragmentShaderPath ()
+	}, _defines);
+
+	_shaderView = RenderSystem::LoadShader (shader);
+}
+
+std::vector<std::string> PostProcessRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * No feature defines by default
+	*/
+
+	return std::vector<std::string> ();
+}
+
+PostProcessDefinesKey PostProcessRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return PostProcessDefinesKey ();
+}
+
 std::vector<PipelineAttribute> PostProcessRenderPass::GetCustomAttributes (const Camera* camera,
 	const RenderSettings& settings, RenderVolumeCollection* rvc)
 {
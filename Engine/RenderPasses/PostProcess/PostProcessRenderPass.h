@@ -4,6 +4,7 @@
 #include "RenderPasses/Container/ContainerRenderSubPassI.h"
 
 #include <vector>
+#include <array>
 #include <glm/vec2.hpp>
 
 #include "Core/Resources/Resource.h"
@@ -13,11 +14,21 @@
 
 #include "Renderer/PipelineAttribute.h"
 
+/*
+ * Values of the settings a pass builds its defines from, compared
+ * every frame instead of the define strings themselves
+*/
+
+typedef std::array<std::size_t, 4> PostProcessDefinesKey;
+
 class ENGINE_API PostProcessRenderPass : public ContainerRenderSubPassI
 {
 protected:
 	Resource<ShaderView> _shaderView;
+	std::vector<std::string> _defines;
+	PostProcessDefinesKey _definesKey;
 	FramebufferRenderVolume* _postProcessMapVolume;
+	RenderVolumeHandle _postProcessVolumeHandle;
 
 public:
 	PostProcessRenderPass ();
@@ -37,6 +48,10 @@ protected:
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	virtual void UpdatePostProcessSettings (const RenderSettings& settings);
+	void UpdatePostProcessShader (const RenderSettings& settings);
+
+	virtual std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	virtual PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
 
 	virtual std::string GetPostProcessFragmentShaderPath () const = 0;
 	virtual std::string GetPostProcessVolumeName () const = 0;
@@ -2,7 +2,7 @@
 
 #include "Renderer/Pipeline.h"
 
-#include "Core/Intersections/Intersection.h"
+#include "RenderPasses/ShadowMap/ShadowCastersVolume.h"
 
 #include "Core/Console/Console.h"
 
@@ -47,7 +47,7 @@ RenderVolumeCollection* RSMAccumulationRenderPass::Execute (const RenderScene* r
 	* Render geometry on shadow map
 	*/
 
-	ShadowMapGeometryPass (renderScene, lightCamera, settings, renderLightObject);
+	ShadowMapGeometryPass (renderScene, lightCamera, settings, renderLightObject, rvc);
 
 	/*
 	* End shadow map drawing process
@@ -82,7 +82,7 @@ void RSMAccumulationRenderPass::StartShadowMapPass ()
 }
 
 void RSMAccumulationRenderPass::ShadowMapGeometryPass (const RenderScene* renderScene, const Camera* lightCamera,
-	const RenderSettings& settings, const RenderLightObject* renderLightObject)
+	const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc)
 {
 	/*
 	* Send light camera
@@ -127,37 +127,10 @@ void RSMAccumulationRenderPass::ShadowMapGeometryPass (const RenderScene* render
 	GL::CullFace (GL_BACK);
 
 	/*
-	* Light camera
+	* Render shadow casters to framebuffer at Deferred Rendering Stage
 	*/
 
-	auto frustum = lightCamera->GetFrustumVolume ();
-
-	/*
-	* Render scene entities to framebuffer at Deferred Rendering Stage
-	*/
-
-	for_each_type (RenderObject*, renderObject, *renderScene) {
-
-		/*
-		 * Check if it's active
-		*/
-
-		if (renderObject->IsActive () == false) {
-			continue;
-		}
-
-		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
-			continue;
-		}
-
-		/*
-		* Culling Check
-		*/
-
-		auto& boundingBox = renderObject->GetBoundingBox ();
-		if (!Intersection::Instance ()->CheckFrustumVsAABB (frustum, boundingBox)) {
-			continue;
-		}
+	for (RenderObject* renderObject : GetShadowCasters (renderScene, renderLightObject, rvc, lightCamera)) {
 
 		/*
 		* Lock shader based on scene object layers
@@ -179,6 +152,34 @@ void RSMAccumulationRenderPass::ShadowMapGeometryPass (const RenderScene* render
 	}
 }
 
+const std::vector<RenderObject*>& RSMAccumulationRenderPass::GetShadowCasters (const RenderScene* renderScene,
+	const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc, const Camera* lightCamera)
+{
+	/*
+	 * Use shadow casters culled for all spot lights at once if available
+	*/
+
+	auto shadowCastersVolume = (ShadowCastersVolume*) rvc->GetRenderVolume ("ShadowCastersSpotLightVolume");
+
+	if (shadowCastersVolume != nullptr) {
+		auto shadowCasters = shadowCastersVolume->GetShadowCasters (renderLightObject);
+
+		if (shadowCasters != nullptr) {
+			return *shadowCasters;
+		}
+	}
+
+	/*
+	 * Cull scene only against this light camera otherwise
+	*/
+
+	_culling.Reset ();
+	_culling.AttachView (lightCamera->GetFrustumVolume ());
+	_culling.Execute (renderScene, RenderStage::RENDER_STAGE_DEFERRED);
+
+	return _culling.GetVisibleObjects (0);
+}
+
 void RSMAccumulationRenderPass::EndShadowMapPass ()
 {
 	Pipeline::UnlockShader ();
@@ -5,10 +5,13 @@
 
 #include "RSMVolume.h"
 
+#include "Renderer/MultiViewCulling.h"
+
 class RSMAccumulationRenderPass : public VolumetricLightRenderPassI
 {
 protected:
 	RSMVolume* _rsmVolume;
+	MultiViewCulling _culling;
 
 public:
 	RSMAccumulationRenderPass ();
@@ -22,12 +25,15 @@ public:
 protected:
 	void StartShadowMapPass ();
 	void ShadowMapGeometryPass (const RenderScene* renderScene, const Camera* lightCamera,
-		const RenderSettings& settings, const RenderLightObject* renderLightObject);
+		const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc);
 	void EndShadowMapPass ();
 
 	virtual void LockShader (int sceneLayers) = 0;
 	virtual Camera* GetLightCamera (const RenderScene* renderScene, const RenderLightObject* renderLightObject) = 0;
 
+	const std::vector<RenderObject*>& GetShadowCasters (const RenderScene* renderScene,
+		const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc, const Camera* lightCamera);
+
 	void InitRSMVolume (const RenderLightObject* renderLightObject);
 	void UpdateRSMVolume (const RenderLightObject* renderLightObject);
 
@@ -1,5 +1,7 @@
 #include "RSMIndirectDiffuseLightRenderPass.h"
 
+#include "RenderPasses/VolumetricLightVolume.h"
+
 #include "Debug/Statistics/StatisticsManager.h"
 #include "RSMStatisticsObject.h"
 
@@ -15,6 +17,16 @@ bool RSMIndirectDiffuseLightRenderPass::IsAvailable (const RenderScene* renderSc
 	return true;
 }
 
+void RSMIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.rsm_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.rsm_interpolation_scale);
+}
+
 std::string RSMIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapIndirectDiffuseFragment.glsl";
@@ -72,7 +84,7 @@ std::vector<PipelineAttribute> RSMIndirectDiffuseLightRenderPass::GetCustomAttri
 	 * Attach post process volume attributes to pipeline
 	*/
 
-	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	std::vector<PipelineAttribute> attributes = AmortizedRenderPass::GetCustomAttributes (camera, settings, rvc);
 
 	/*
 	 * Attach screen space ambient occlusion attributes to pipeline
@@ -122,3 +134,47 @@ std::vector<PipelineAttribute> RSMIndirectDiffuseLightRenderPass::GetCustomAttri
 
 	return attributes;
 }
+
+std::vector<std::string> RSMIndirectDiffuseLightRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Samples count is known up front, so the shader loop is bound by
+	 * a constant rather than the uniform count
+	*/
+
+	std::vector<std::string> defines = AmortizedRenderPass::GetPostProcessDefines (settings);
+
+	defines.push_back ("RSM_SAMPLES " + std::to_string (settings.rsm_samples));
+
+	return defines;
+}
+
+PostProcessDefinesKey RSMIndirectDiffuseLightRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	PostProcessDefinesKey definesKey = AmortizedRenderPass::GetPostProcessDefinesKey (settings);
+
+	definesKey [1] = settings.rsm_samples;
+
+	return definesKey;
+}
+
+std::size_t RSMIndirectDiffuseLightRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.rsm_amortization_interval;
+}
+
+bool RSMIndirectDiffuseLightRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.rsm_amortization_interleaved;
+}
+
+const RenderLightObject* RSMIndirectDiffuseLightRenderPass::GetAmortizedRenderLightObject (const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Indirect light is computed for the light of the container
+	*/
+
+	auto volume = (VolumetricLightVolume*) rvc->GetRenderVolume ("SubpassVolume");
+
+	return volume != nullptr ? volume->GetRenderLightObject () : nullptr;
+}
@@ -1,15 +1,17 @@
 #ifndef RSMINDIRECTDIFFUSELIGHTRENDERPASS_H
 #define RSMINDIRECTDIFFUSELIGHTRENDERPASS_H
 
-#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+#include "RenderPasses/TemporalFiltering/AmortizedRenderPass.h"
 
-class ENGINE_API RSMIndirectDiffuseLightRenderPass : public PostProcessRenderPass
+class ENGINE_API RSMIndirectDiffuseLightRenderPass : public AmortizedRenderPass
 {
 	DECLARE_RENDER_PASS(RSMIndirectDiffuseLightRenderPass)
 
 public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;
@@ -18,6 +20,13 @@ protected:
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
+
+	std::size_t GetAmortizationInterval (const RenderSettings& settings) const;
+	bool IsAmortizationInterleaved (const RenderSettings& settings) const;
+	const RenderLightObject* GetAmortizedRenderLightObject (const RenderVolumeCollection* rvc) const;
 };
 
 #endif
\ No newline at end of file
@@ -13,6 +13,16 @@ bool RSMInterpolatedIndirectDiffuseLightRenderPass::IsAvailable (const RenderSce
 	return true;
 }
 
+void RSMInterpolatedIndirectDiffuseLightRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.rsm_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.rsm_interpolation_scale);
+}
+
 std::string RSMInterpolatedIndirectDiffuseLightRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapInterpolatedIndirectDiffuseFragment.glsl";
@@ -105,3 +115,18 @@ std::vector<PipelineAttribute> RSMInterpolatedIndirectDiffuseLightRenderPass::Ge
 
 	return attributes;
 }
+
+std::vector<std::string> RSMInterpolatedIndirectDiffuseLightRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Samples count is known up front, so the shader loop is bound by
+	 * a constant rather than the uniform count
+	*/
+
+	return { "RSM_SAMPLES " + std::to_string (settings.rsm_samples) };
+}
+
+PostProcessDefinesKey RSMInterpolatedIndirectDiffuseLightRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { settings.rsm_samples };
+}
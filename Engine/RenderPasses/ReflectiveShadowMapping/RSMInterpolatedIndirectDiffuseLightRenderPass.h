@@ -10,6 +10,8 @@ class ENGINE_API RSMInterpolatedIndirectDiffuseLightRenderPass : public PostProc
 public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;
@@ -18,6 +20,9 @@ protected:
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
 };
 
 #endif
\ No newline at end of file
@@ -100,3 +100,18 @@ std::vector<PipelineAttribute> SSAORenderPass::GetCustomAttributes (const Camera
 
 	return attributes;
 }
+
+std::vector<std::string> SSAORenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	/*
+	 * Samples count is known up front, so the shader loop is bound by
+	 * a constant rather than the uniform count
+	*/
+
+	return { "SSAO_SAMPLES " + std::to_string (settings.ssao_samples) };
+}
+
+PostProcessDefinesKey SSAORenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { settings.ssao_samples };
+}
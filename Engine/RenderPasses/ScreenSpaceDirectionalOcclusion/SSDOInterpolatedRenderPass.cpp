@@ -13,6 +13,20 @@ bool SSDOInterpolatedRenderPass::IsAvailable (const RenderScene* renderScene, co
 	return settings.ssdo_enabled && settings.ssdo_interpolation_enabled;
 }
 
+void SSDOInterpolatedRenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	if (settings.ssdo_enabled == false || settings.ssdo_interpolation_enabled == false) {
+		return;
+	}
+
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.ssdo_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.ssdo_interpolation_scale);
+}
+
 std::string SSDOInterpolatedRenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/ScreenSpaceDirectionalOcclusion/screenSpaceDirectionalOcclusionInterpolatedFragment.glsl";
@@ -15,6 +15,20 @@ bool SSDORenderPass::IsAvailable (const RenderScene* renderScene, const Camera*
 	return settings.ssdo_enabled;
 }
 
+void SSDORenderPass::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	if (settings.ssdo_enabled == false || settings.ssdo_interpolation_enabled == false) {
+		return;
+	}
+
+	/*
+	 * Position and normal are sampled at the interpolation resolution
+	*/
+
+	requirements.RequireScale (GBUFFER_MIP_POSITION, settings.ssdo_interpolation_scale);
+	requirements.RequireScale (GBUFFER_MIP_NORMAL, settings.ssdo_interpolation_scale);
+}
+
 std::string SSDORenderPass::GetPostProcessFragmentShaderPath () const
 {
 	return "Assets/Shaders/ScreenSpaceDirectionalOcclusion/screenSpaceDirectionalOcclusionFragment.glsl";
@@ -72,7 +86,7 @@ std::vector<PipelineAttribute> SSDORenderPass::GetCustomAttributes (const Camera
 	 * Attach post process volume attributes to pipeline
 	*/
 
-	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	std::vector<PipelineAttribute> attributes = AmortizedRenderPass::GetCustomAttributes (camera, settings, rvc);
 
 	/*
 	 * Attach screen space directional occlusion attributes to pipeline
@@ -137,3 +151,13 @@ std::vector<PipelineAttribute> SSDORenderPass::GetCustomAttributes (const Camera
 
 	return attributes;
 }
+
+std::size_t SSDORenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.ssdo_amortization_interval;
+}
+
+bool SSDORenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.ssdo_amortization_interleaved;
+}
@@ -1,5 +1,8 @@
 #include "CascadedShadowMapVolume.h"
 
+#include <algorithm>
+#include <glm/vector_relational.hpp>
+
 #include "Renderer/PipelineAttribute.h"
 #include "Core/Console/Console.h"
 
@@ -7,7 +10,9 @@ CascadedShadowMapVolume::CascadedShadowMapVolume (const Resource<Framebuffer>& f
 	FramebufferRenderVolume (framebuffer),
 	_cascadeLevels (cascadeLevels),
 	_lightCameras (),
-	_shadowMapZEnd ()
+	_shadowMapZEnd (),
+	_cascadeStates (),
+	_framesCount (0)
 {
 	/*
 	 * Initialize cascaded levels
@@ -21,6 +26,7 @@ CascadedShadowMapVolume::CascadedShadowMapVolume (const Resource<Framebuffer>& f
 
 	_lightCameras.resize (_cascadeLevels, nullptr);
 	_shadowMapZEnd.resize (_cascadeLevels);
+	_cascadeStates.resize (_cascadeLevels, CascadeState {false, AABBVolume (), 0});
 
 	/*
 	 * Create attributes
@@ -167,3 +173,58 @@ std::size_t CascadedShadowMapVolume::GetCascadeLevels () const
 {
 	return _cascadeLevels;
 }
+
+void CascadedShadowMapVolume::NextFrame ()
+{
+	_framesCount ++;
+}
+
+void CascadedShadowMapVolume::InvalidateCascades ()
+{
+	for (auto& cascadeState : _cascadeStates) {
+		cascadeState.valid = false;
+	}
+}
+
+bool CascadedShadowMapVolume::IsCascadeScheduled (std::size_t cascadeLevel, std::size_t updateInterval) const
+{
+	/*
+	 * First cascade and cascades never drawn are always updated
+	*/
+
+	if (cascadeLevel == 0 || _cascadeStates [cascadeLevel].valid == false) {
+		return true;
+	}
+
+	/*
+	 * Cascades take turns, so far cascades are not drawn on the same frame
+	*/
+
+	updateInterval = std::max<std::size_t> (updateInterval, 1);
+
+	return _framesCount % updateInterval == cascadeLevel % updateInterval;
+}
+
+bool CascadedShadowMapVolume::IsCascadeCovering (std::size_t cascadeLevel, const AABBVolume& lightBounds) const
+{
+	const AABBVolume& cascadeBounds = _cascadeStates [cascadeLevel].lightBounds;
+
+	return glm::all (glm::lessThanEqual (cascadeBounds.minVertex, lightBounds.minVertex)) &&
+		glm::all (glm::lessThanEqual (lightBounds.maxVertex, cascadeBounds.maxVertex));
+}
+
+bool CascadedShadowMapVolume::IsCascadeCastersChanged (std::size_t cascadeLevel, std::size_t castersSignature) const
+{
+	return _cascadeStates [cascadeLevel].castersSignature != castersSignature;
+}
+
+void CascadedShadowMapVolume::UpdateCascadeBounds (std::size_t cascadeLevel, const AABBVolume& lightBounds)
+{
+	_cascadeStates [cascadeLevel].valid = true;
+	_cascadeStates [cascadeLevel].lightBounds = lightBounds;
+}
+
+void CascadedShadowMapVolume::UpdateCascadeCasters (std::size_t cascadeLevel, std::size_t castersSignature)
+{
+	_cascadeStates [cascadeLevel].castersSignature = castersSignature;
+}
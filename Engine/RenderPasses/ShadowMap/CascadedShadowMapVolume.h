@@ -5,14 +5,33 @@
 
 #include "Systems/Camera/Camera.h"
 
+#include "Core/Intersections/AABBVolume.h"
+
+/*
+ * Cascades keep the light space bounds and the casters they were last
+ * rendered with. A cascade past the first one is drawn again only on
+ * its turn of the update interval, when the region it has to cover
+ * leaves those bounds, or when its casters change.
+*/
+
 class CascadedShadowMapVolume : public FramebufferRenderVolume
 {
 protected:
+	struct CascadeState
+	{
+		bool valid;
+		AABBVolume lightBounds;
+		std::size_t castersSignature;
+	};
+
 	std::size_t _cascadeLevels;
 
 	std::vector<Camera*> _lightCameras;
 	std::vector<float> _shadowMapZEnd;
 
+	std::vector<CascadeState> _cascadeStates;
+	std::size_t _framesCount;
+
 public:
 	CascadedShadowMapVolume (const Resource<Framebuffer>& framebuffer, std::size_t cascadeLevels);
 	~CascadedShadowMapVolume ();
@@ -25,6 +44,16 @@ public:
 	float GetCameraLimit (std::size_t cascadedLevel);
 
 	std::size_t GetCascadeLevels () const;
+
+	void NextFrame ();
+	void InvalidateCascades ();
+
+	bool IsCascadeScheduled (std::size_t cascadeLevel, std::size_t updateInterval) const;
+	bool IsCascadeCovering (std::size_t cascadeLevel, const AABBVolume& lightBounds) const;
+	bool IsCascadeCastersChanged (std::size_t cascadeLevel, std::size_t castersSignature) const;
+
+	void UpdateCascadeBounds (std::size_t cascadeLevel, const AABBVolume& lightBounds);
+	void UpdateCascadeCasters (std::size_t cascadeLevel, std::size_t castersSignature);
 };
 
 #endif
\ No newline at end of file
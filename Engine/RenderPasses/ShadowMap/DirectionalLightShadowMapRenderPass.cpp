@@ -6,19 +6,31 @@
 #include <algorithm>
 #include <cmath>
 
-#include "Core/Intersections/Intersection.h"
-
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/LevelOfDetailSelection.h"
 
 #include "Core/Console/Console.h"
 
 #include "SceneNodes/SceneLayer.h"
 
+#include "Utils/Extensions/HashExtend.h"
+
+/*
+ * Reused cascades cover a bit more than their part of the view
+ * frustum, so small camera moves stay inside them
+*/
+
+#define CASCADE_COVERAGE_MARGIN 0.15f
+
 DirectionalLightShadowMapRenderPass::DirectionalLightShadowMapRenderPass () :
-	_volume (nullptr)
+	_volume (nullptr),
+	_culling (),
+	_lastRenderLightObject (nullptr),
+	_lastLightRotation (),
+	_cascadesUpdated ()
 {
 
 }
@@ -67,7 +79,7 @@ RenderVolumeCollection* DirectionalLightShadowMapRenderPass::Execute (const Rend
 	 * Draw shadow map
 	*/
 
-	ShadowMapPass (renderScene, camera, renderLightObject);
+	ShadowMapPass (renderScene, camera, settings, renderLightObject);
 
 	/*
 	 * End drawing
@@ -96,12 +108,40 @@ bool DirectionalLightShadowMapRenderPass::IsAvailable (const RenderLightObject*
 	return renderLightObject->IsCastingShadows ();
 }
 
-void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera, const RenderLightObject* renderLightObject)
+void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject)
 {
+	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
+
+	/*
+	 * Cascades drawn for another light or another light direction
+	 * cannot be reused
+	*/
+
+	glm::quat lightRotation = renderLightObject->GetTransform ()->GetRotation ();
+
+	if (settings.shadow_cascades_amortized_update == false ||
+		renderLightObject != _lastRenderLightObject || lightRotation != _lastLightRotation) {
+		_volume->InvalidateCascades ();
+	}
+
+	_lastRenderLightObject = renderLightObject;
+	_lastLightRotation = lightRotation;
+
+	_volume->NextFrame ();
+
 	UpdateCascadeLevelsLimits (camera, renderLightObject);
-	UpdateLightCameras (camera, renderLightObject);
+	UpdateLightCameras (camera, renderLightObject, settings);
 
-	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
+	/*
+	 * Cull shadow casters for all cascades at once
+	*/
+
+	CullShadowCasters (renderScene, shadow.cascadesCount);
+
+	if (settings.shadow_cascades_amortized_update == true) {
+		UpdateCascadesCasters (shadow.cascadesCount);
+	}
 
 	/*
 	 * Bind shadow map cascade for writing
@@ -109,10 +149,22 @@ void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* rend
 
 	_volume->GetFramebufferView ()->Activate ();
 
-	GL::Clear (GL_DEPTH_BUFFER_BIT);
+	bool fullUpdate = std::find (_cascadesUpdated.begin (), _cascadesUpdated.end (), false) == _cascadesUpdated.end ();
+
+	if (fullUpdate == true) {
+		GL::Clear (GL_DEPTH_BUFFER_BIT);
+	}
 
 	for (std::size_t index = 0; index < shadow.cascadesCount; index++) {
 
+		/*
+		 * Keep the cascades that are still valid
+		*/
+
+		if (_cascadesUpdated [index] == false) {
+			continue;
+		}
+
 		/*
 		 * Change resolution on viewport as shadow map size
 		*/
@@ -122,10 +174,24 @@ void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* rend
 
 		GL::Viewport (startPos.x, startPos.y, size.width / 2, size.height / 2);
 
+		/*
+		 * Clear only this cascade
+		*/
+
+		if (fullUpdate == false) {
+			GL::Enable (GL_SCISSOR_TEST);
+			GL::Scissor (startPos.x, startPos.y, size.width / 2, size.height / 2);
+
+			GL::DepthMask (GL_TRUE);
+			GL::Clear (GL_DEPTH_BUFFER_BIT);
+
+			GL::Disable (GL_SCISSOR_TEST);
+		}
+
 		OrthographicCamera* lightCamera = (OrthographicCamera*) _volume->GetLightCamera (index);
 
 		SendLightCamera (lightCamera);
-		Render (renderScene, lightCamera);
+		Render (_culling.GetVisibleObjects (index), camera, settings);
 	}
 }
 
@@ -202,7 +268,8 @@ void DirectionalLightShadowMapRenderPass::SendLightCamera (Camera* lightCamera)
  *    orthographic projection matrix for the shadow map.
 */
 
-void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* viewCamera, const RenderLightObject* renderLightObject)
+void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* viewCamera,
+	const RenderLightObject* renderLightObject, const RenderSettings& settings)
 {
 	const float LIGHT_CAMERA_OFFSET = 100.0f;
 
@@ -214,6 +281,8 @@ void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* view
 
 	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
 
+	_cascadesUpdated.assign (shadow.cascadesCount, true);
+
 	for (std::size_t index = 0; index < shadow.cascadesCount; index++) {
 
 		OrthographicCamera* lightCamera = (OrthographicCamera*)_volume->GetLightCamera (index);
@@ -221,6 +290,9 @@ void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* view
 		glm::vec3 cuboidExtendsMin = glm::vec3(std::numeric_limits<float>::max());
 		glm::vec3 cuboidExtendsMax = glm::vec3(-std::numeric_limits<float>::min());
 
+		glm::vec3 cuboidCorners [8];
+		std::size_t cornersCount = 0;
+
 		float zStart = index == 0 ? - 1 : _volume->GetCameraLimit (index - 1);
 		float zEnd = _volume->GetCameraLimit (index);
 
@@ -241,23 +313,133 @@ void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* view
 					cuboidExtendsMax.x = std::max(cuboidExtendsMax.x, cuboidCorner.x);
 					cuboidExtendsMax.y = std::max(cuboidExtendsMax.y, cuboidCorner.y);
 					cuboidExtendsMax.z = std::max(cuboidExtendsMax.z, cuboidCorner.z);
+
+					cuboidCorners [cornersCount ++] = glm::vec3 (cuboidCorner);
 				}
 			}
 		}
 
+		if (settings.shadow_cascades_amortized_update == false) {
+
+			lightCamera->SetRotation(lightRotation);
+
+			lightCamera->SetOrthographicInfo (
+				cuboidExtendsMin.x, cuboidExtendsMax.x,
+				cuboidExtendsMin.y, cuboidExtendsMax.y,
+				cuboidExtendsMin.z - LIGHT_CAMERA_OFFSET, cuboidExtendsMax.z + LIGHT_CAMERA_OFFSET
+			);
+
+			_volume->SetLightCamera (index, lightCamera);
+
+			continue;
+		}
+
+		/*
+		 * Fit a sphere around the cascade, so its size does not change
+		 * when the view camera rotates
+		*/
+
+		glm::vec3 center = glm::vec3 (0.0f);
+		for (std::size_t cornerIndex = 0; cornerIndex < cornersCount; cornerIndex ++) {
+			center += cuboidCorners [cornerIndex] / (float) cornersCount;
+		}
+
+		float radius = 0.0f;
+		for (std::size_t cornerIndex = 0; cornerIndex < cornersCount; cornerIndex ++) {
+			radius = std::max (radius, glm::length (cuboidCorners [cornerIndex] - center));
+		}
+
+		radius = std::ceil (radius * 16.0f) / 16.0f;
+
+		AABBVolume requiredBounds (center - glm::vec3 (radius), center + glm::vec3 (radius));
+
+		/*
+		 * Keep the cascade while it still covers its part of the view
+		 * frustum and it is not its turn to be updated
+		*/
+
+		if (_volume->IsCascadeScheduled (index, settings.shadow_cascades_update_interval) == false &&
+			_volume->IsCascadeCovering (index, requiredBounds) == true) {
+			_cascadesUpdated [index] = false;
+
+			continue;
+		}
+
+		/*
+		 * Snap the projection to shadow map texels, so reused cascades
+		 * and cascades drawn again line up
+		*/
+
+		float extent = index == 0 ? radius : radius * (1.0f + CASCADE_COVERAGE_MARGIN);
+		float texelSize = 2.0f * extent / shadow.resolution.x;
+
+		center.x = std::floor (center.x / texelSize) * texelSize;
+		center.y = std::floor (center.y / texelSize) * texelSize;
+
+		AABBVolume lightBounds (center - glm::vec3 (extent), center + glm::vec3 (extent));
+
 		lightCamera->SetRotation(lightRotation);
 
 		lightCamera->SetOrthographicInfo (
-			cuboidExtendsMin.x, cuboidExtendsMax.x,
-			cuboidExtendsMin.y, cuboidExtendsMax.y,
-			cuboidExtendsMin.z - LIGHT_CAMERA_OFFSET, cuboidExtendsMax.z + LIGHT_CAMERA_OFFSET
+			lightBounds.minVertex.x, lightBounds.maxVertex.x,
+			lightBounds.minVertex.y, lightBounds.maxVertex.y,
+			lightBounds.minVertex.z - LIGHT_CAMERA_OFFSET, lightBounds.maxVertex.z + LIGHT_CAMERA_OFFSET
 		);
 
 		_volume->SetLightCamera (index, lightCamera);
+		_volume->UpdateCascadeBounds (index, lightBounds);
 	}
 }
 
-void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene, OrthographicCamera* lightCamera)
+void DirectionalLightShadowMapRenderPass::UpdateCascadesCasters (std::size_t cascadesCount)
+{
+	for (std::size_t index = 0; index < cascadesCount; index++) {
+
+		const std::vector<RenderObject*>& shadowCasters = _culling.GetVisibleObjects (index);
+
+		/*
+		 * Draw the cascade again when its casters moved, appeared or
+		 * left. Animated casters change every frame.
+		*/
+
+		std::size_t castersSignature = GetCastersSignature (shadowCasters);
+
+		if (_volume->IsCascadeCastersChanged (index, castersSignature) == true) {
+			_cascadesUpdated [index] = true;
+		}
+
+		for (RenderObject* renderObject : shadowCasters) {
+			if (renderObject->GetSceneLayers () & SceneLayer::ANIMATION) {
+				_cascadesUpdated [index] = true;
+				break;
+			}
+		}
+
+		_volume->UpdateCascadeCasters (index, castersSignature);
+	}
+}
+
+void DirectionalLightShadowMapRenderPass::CullShadowCasters (const RenderScene* renderScene, std::size_t cascadesCount)
+{
+	_culling.Reset ();
+
+	/*
+	 * Attach every cascade light camera as a culling view
+	*/
+
+	for (std::size_t index = 0; index < cascadesCount; index++) {
+		_culling.AttachView (_volume->GetLightCamera (index)->GetFrustumVolume ());
+	}
+
+	/*
+	 * Walk the scene once for all cascades
+	*/
+
+	_culling.Execute (renderScene, RenderStage::RENDER_STAGE_DEFERRED);
+}
+
+void DirectionalLightShadowMapRenderPass::Render (const std::vector<RenderObject*>& shadowCasters,
+	const Camera* camera, const RenderSettings& settings)
 {
 	/*
 	 * Shadow map is a depth test
@@ -280,38 +462,11 @@ void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene
 	GL::Enable(GL_CULL_FACE);
 	GL::CullFace (GL_FRONT);
 
-	/*
-	 * Light camera
-	*/
-
-	auto frustum = lightCamera->GetFrustumVolume ();
-
 	/*
 	* Render scene entities to framebuffer at Deferred Rendering Stage
 	*/
 
-	for_each_type (RenderObject*, renderObject, *renderScene) {
-
-		/*
-		 * Check if it's active
-		*/
-
-		if (renderObject->IsActive () == false) {
-			continue;
-		}
-
-		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
-			continue;
-		}
-
-		/*
-		 * Culling Check
-		*/
-
-		auto& boundingBox = renderObject->GetBoundingBox ();
-		if (!Intersection::Instance ()->CheckFrustumVsAABB (frustum, boundingBox)) {
-			continue;
-		}
+	for (RenderObject* renderObject : shadowCasters) {
 
 		/*
 		 * Lock shader based on scene object layer
@@ -326,10 +481,10 @@ void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene
 		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
 
 		/*
-		 * Render object on shadow map
+		 * Render object on shadow map with the level of detail seen by view camera
 		*/
 
-		renderObject->DrawGeometry ();
+		renderObject->DrawGeometry (LevelOfDetailSelection::Select (renderObject, camera, settings));
 	}
 }
 
@@ -423,4 +578,21 @@ void DirectionalLightShadowMapRenderPass::InitShadowMapVolume (const RenderLight
 	for (std::size_t index = 0; index < shadow.cascadesCount; index ++) {
 		_volume->SetLightCamera (index, new OrthographicCamera ());
 	}
-}
\ No newline at end of file
+}
+
+std::size_t DirectionalLightShadowMapRenderPass::GetCastersSignature (const std::vector<RenderObject*>& shadowCasters) const
+{
+	std::size_t signature = shadowCasters.size ();
+
+	/*
+	 * Model matrix changes when a caster rotates in place as well,
+	 * unlike its bounding box
+	*/
+
+	for (const RenderObject* renderObject : shadowCasters) {
+		Extensions::HashExtend::Combine (signature, renderObject);
+		Extensions::HashExtend::Combine (signature, renderObject->GetTransform ()->GetModelMatrix ());
+	}
+
+	return signature;
+}
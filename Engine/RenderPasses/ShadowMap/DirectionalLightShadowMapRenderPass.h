@@ -8,6 +8,8 @@
 
 #include "RenderPasses/ShadowMap/CascadedShadowMapVolume.h"
 
+#include "Renderer/MultiViewCulling.h"
+
 #include "Systems/Camera/Camera.h"
 #include "Cameras/OrthographicCamera.h"
 
@@ -19,6 +21,11 @@ protected:
 	Resource<ShaderView> _staticShaderView;
 	Resource<ShaderView> _animationShaderView;
 	CascadedShadowMapVolume* _volume;
+	MultiViewCulling _culling;
+
+	const RenderLightObject* _lastRenderLightObject;
+	glm::quat _lastLightRotation;
+	std::vector<bool> _cascadesUpdated;
 
 public:
 	DirectionalLightShadowMapRenderPass ();
@@ -31,15 +38,20 @@ public:
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
-	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera, const RenderLightObject* renderLightObject);
+	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderLightObject* renderLightObject);
 	void EndShadowMapPass ();
 
 	void UpdateCascadeLevelsLimits (const Camera* camera, const RenderLightObject* renderLightObject);
 	void SendLightCamera (Camera* lightCamera);
-	void UpdateLightCameras (const Camera* viewCamera, const RenderLightObject* renderLightObject);
-	void Render (const RenderScene* renderScene, OrthographicCamera* lightCamera);
+	void UpdateLightCameras (const Camera* viewCamera, const RenderLightObject* renderLightObject, const RenderSettings& settings);
+	void UpdateCascadesCasters (std::size_t cascadesCount);
+	void CullShadowCasters (const RenderScene* renderScene, std::size_t cascadesCount);
+	void Render (const std::vector<RenderObject*>& shadowCasters, const Camera* camera, const RenderSettings& settings);
 	void LockShader (int sceneLayers);
 
+	std::size_t GetCastersSignature (const std::vector<RenderObject*>& shadowCasters) const;
+
 	virtual std::vector<PipelineAttribute> GetCustomAttributes () const;
 
 	virtual void UpdateShadowMapVolume (const RenderLightObject* renderLightObject);
@@ -46,7 +46,7 @@ void PerspectiveShadowMapVolume::SetLightCamera (PerspectiveCamera* lightCamera)
 	glm::mat4 lightView = glm::translate (glm::mat4_cast(_lightCamera->GetRotation ()), _lightCamera->GetPosition () * -1.0f);
 	glm::mat4 screenMatrix = glm::scale (glm::translate (glm::mat4 (1), glm::vec3 (0.5f)), glm::vec3 (0.5f));
 
-	_attributes [0].matrix = screenMatrix * lightProjection * lightView;
+	_attributes [1].matrix = screenMatrix * lightProjection * lightView;
 }
 
 void PerspectiveShadowMapVolume::SetShadowBias (float shadowBias)
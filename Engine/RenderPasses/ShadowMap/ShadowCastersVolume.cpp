@@ -0,0 +1,48 @@
+#include "ShadowCastersVolume.h"
+
+ShadowCastersVolume::ShadowCastersVolume () :
+	_culling (),
+	_lightViews ()
+{
+
+}
+
+void ShadowCastersVolume::Reset ()
+{
+	_culling.Reset ();
+	_lightViews.clear ();
+}
+
+void ShadowCastersVolume::AttachLightView (const RenderLightObject* renderLightObject, const FrustumVolume& frustum)
+{
+	_lightViews [renderLightObject] = _culling.AttachView (frustum);
+}
+
+void ShadowCastersVolume::Execute (const RenderScene* renderScene)
+{
+	/*
+	 * Shadow casters are the objects drawn at deferred stage
+	*/
+
+	_culling.Execute (renderScene, RenderStage::RENDER_STAGE_DEFERRED);
+}
+
+const std::vector<RenderObject*>* ShadowCastersVolume::GetShadowCasters (const RenderLightObject* renderLightObject) const
+{
+	auto it = _lightViews.find (renderLightObject);
+
+	if (it == _lightViews.end ()) {
+		return nullptr;
+	}
+
+	return &_culling.GetVisibleObjects (it->second);
+}
+
+const std::vector<PipelineAttribute>& ShadowCastersVolume::GetCustomAttributes () const
+{
+	/*
+	 * Nothing to do here
+	*/
+
+	return _attributes;
+}
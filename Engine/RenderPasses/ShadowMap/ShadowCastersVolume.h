@@ -0,0 +1,31 @@
+#ifndef SHADOWCASTERSVOLUME_H
+#define SHADOWCASTERSVOLUME_H
+
+#include "Renderer/RenderVolumeI.h"
+
+#include <map>
+
+#include "Renderer/MultiViewCulling.h"
+#include "Renderer/RenderLightObject.h"
+
+class ShadowCastersVolume : public RenderVolumeI
+{
+protected:
+	MultiViewCulling _culling;
+	std::map<const RenderLightObject*, std::size_t> _lightViews;
+
+	std::vector<PipelineAttribute> _attributes;
+
+public:
+	ShadowCastersVolume ();
+
+	void Reset ();
+	void AttachLightView (const RenderLightObject* renderLightObject, const FrustumVolume& frustum);
+	void Execute (const RenderScene* renderScene);
+
+	const std::vector<RenderObject*>* GetShadowCasters (const RenderLightObject* renderLightObject) const;
+
+	virtual const std::vector<PipelineAttribute>& GetCustomAttributes () const;
+};
+
+#endif
@@ -0,0 +1,390 @@
+#include "SpotLightShadowAtlasRenderPass.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "RenderPasses/ShadowMap/SpotLightShadowMapRenderPass.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "SpotLightShadowStatisticsObject.h"
+
+#include "SceneNodes/SceneLayer.h"
+
+#include "Utils/Extensions/HashExtend.h"
+
+/*
+ * Tile keeps its size until the wanted size is this many levels away
+*/
+
+#define SPOT_LIGHT_SHADOW_ATLAS_LEVEL_HYSTERESIS 0.75f
+
+SpotLightShadowAtlasRenderPass::SpotLightShadowAtlasRenderPass () :
+	_volume (nullptr),
+	_lightCamera (nullptr)
+{
+
+}
+
+void SpotLightShadowAtlasRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Light camera used to check lights for changes
+	*/
+
+	_lightCamera = new PerspectiveCamera ();
+}
+
+RenderVolumeCollection* SpotLightShadowAtlasRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Spot lights keep their own shadow maps without the atlas
+	*/
+
+	if (settings.spot_shadow_atlas_enabled == false) {
+		delete _volume;
+		_volume = nullptr;
+
+		return rvc;
+	}
+
+	UpdateAtlasVolume (settings);
+
+	auto shadowCastersVolume = (ShadowCastersVolume*) rvc->GetRenderVolume ("ShadowCastersSpotLightVolume");
+
+	/*
+	 * Lights nearest the camera come first, both when tiles are
+	 * allocated and when they are drawn
+	*/
+
+	std::vector<std::pair<float, const RenderSpotLightObject*>> renderSpotLightObjects;
+
+	for_each_type (RenderSpotLightObject*, renderSpotLightObject, *renderScene) {
+
+		if (renderSpotLightObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderSpotLightObject->IsCastingShadows () == false) {
+			continue;
+		}
+
+		float distance = glm::distance (camera->GetPosition (), renderSpotLightObject->GetTransform ()->GetPosition ());
+
+		renderSpotLightObjects.push_back (std::make_pair (distance, renderSpotLightObject));
+	}
+
+	std::sort (renderSpotLightObjects.begin (), renderSpotLightObjects.end (),
+		[] (const std::pair<float, const RenderSpotLightObject*>& left, const std::pair<float, const RenderSpotLightObject*>& right) {
+			return left.first < right.first;
+		});
+
+	ReleaseTiles (renderSpotLightObjects);
+
+	for (auto& tile : *_volume) {
+		tile.second.scheduled = false;
+	}
+
+	std::vector<ChangedTile> changedTiles;
+	std::size_t renderedTilesCount = 0;
+
+	for (auto& entry : renderSpotLightObjects) {
+		const RenderSpotLightObject* renderSpotLightObject = entry.second;
+
+		/*
+		 * Allocate a tile of the wanted size, or a smaller one if the
+		 * atlas is full. Lights left without a tile fall back to their
+		 * own shadow map.
+		*/
+
+		SpotLightShadowAtlasVolume::Tile* tile = _volume->GetTile (renderSpotLightObject);
+
+		std::size_t level = GetTileLevel (renderSpotLightObject, entry.first, tile);
+
+		/*
+		 * Keep a tile smaller than wanted while there is no room for a larger one
+		*/
+
+		if (tile != nullptr && tile->level > level && _volume->CanAllocateTile (level) == false) {
+			level = tile->level;
+		}
+
+		if (tile == nullptr || tile->level != level) {
+			tile = nullptr;
+
+			for (std::size_t tileLevel = level; tile == nullptr && tileLevel < _volume->GetLevelsCount (); tileLevel ++) {
+				tile = _volume->AllocateTile (renderSpotLightObject, tileLevel);
+			}
+
+			if (tile == nullptr) {
+				continue;
+			}
+		}
+
+		/*
+		 * Check if the light or its casters changed since the tile was drawn
+		*/
+
+		SpotLightShadowMapRenderPass::SetupLightCamera (_lightCamera, renderSpotLightObject);
+
+		bool animated = false;
+
+		std::size_t castersSignature = GetCastersSignature (shadowCastersVolume != nullptr ?
+			shadowCastersVolume->GetShadowCasters (renderSpotLightObject) : nullptr, animated);
+
+		if (tile->valid == false) {
+			ScheduleTile (tile, renderSpotLightObject, castersSignature);
+
+			renderedTilesCount ++;
+
+			continue;
+		}
+
+		if (animated == true || tile->castersSignature != castersSignature ||
+			tile->shadowBias != renderSpotLightObject->GetShadow ().bias ||
+			IsLightCameraChanged (tile->lightCamera) == true) {
+
+			/*
+			 * Lights waiting for long get ahead of nearer ones
+			*/
+
+			float priority = entry.first / (1.0f + tile->staleFrames);
+
+			changedTiles.push_back (ChangedTile {priority, renderSpotLightObject, castersSignature});
+		}
+	}
+
+	/*
+	 * Draw changed tiles within the update budget
+	*/
+
+	std::sort (changedTiles.begin (), changedTiles.end (),
+		[] (const ChangedTile& left, const ChangedTile& right) {
+			return left.priority < right.priority;
+		});
+
+	for (auto& changedTile : changedTiles) {
+		SpotLightShadowAtlasVolume::Tile* tile = _volume->GetTile (changedTile.renderSpotLightObject);
+
+		if (renderedTilesCount >= settings.spot_shadow_atlas_update_budget) {
+			tile->staleFrames ++;
+
+			continue;
+		}
+
+		ScheduleTile (tile, changedTile.renderSpotLightObject, changedTile.castersSignature);
+
+		renderedTilesCount ++;
+	}
+
+	UpdateStatistics (renderedTilesCount);
+
+	return rvc->Insert ("SpotLightShadowAtlasVolume", _volume, false);
+}
+
+void SpotLightShadowAtlasRenderPass::Clear ()
+{
+	/*
+	 * Clear shadow atlas volume
+	*/
+
+	delete _volume;
+
+	/*
+	 * Clear light camera
+	*/
+
+	delete _lightCamera;
+}
+
+void SpotLightShadowAtlasRenderPass::UpdateAtlasVolume (const RenderSettings& settings)
+{
+	if (_volume == nullptr || _volume->GetSize () != GetAtlasSize (settings)) {
+
+		/*
+		 * Clear shadow atlas volume
+		*/
+
+		delete _volume;
+
+		/*
+		 * Initialize shadow atlas volume
+		*/
+
+		InitAtlasVolume (settings);
+	}
+}
+
+void SpotLightShadowAtlasRenderPass::InitAtlasVolume (const RenderSettings& settings)
+{
+	/*
+	 * Create shadow atlas volume
+	*/
+
+	Resource<Texture> texture = Resource<Texture> (new Texture ("shadowMap"));
+
+	std::size_t atlasSize = GetAtlasSize (settings);
+
+	texture->SetSize (Size (atlasSize, atlasSize));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_DEPTH16);
+	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_DEPTH);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetAnisotropicFiltering (false);
+	texture->SetBorderColor (Color (glm::vec4 (1.0)));
+
+	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (nullptr, texture));
+
+	_volume = new SpotLightShadowAtlasVolume (framebuffer);
+}
+
+void SpotLightShadowAtlasRenderPass::ReleaseTiles (const std::vector<std::pair<float, const RenderSpotLightObject*>>& renderSpotLightObjects)
+{
+	/*
+	 * Release tiles of lights that no longer cast shadows, before new
+	 * tiles are allocated
+	*/
+
+	for (auto& tile : *_volume) {
+		tile.second.visited = false;
+	}
+
+	for (auto& entry : renderSpotLightObjects) {
+		SpotLightShadowAtlasVolume::Tile* tile = _volume->GetTile (entry.second);
+
+		if (tile != nullptr) {
+			tile->visited = true;
+		}
+	}
+
+	std::vector<const RenderLightObject*> releasedRenderLightObjects;
+
+	for (auto& tile : *_volume) {
+		if (tile.second.visited == false) {
+			releasedRenderLightObjects.push_back (tile.first);
+		}
+	}
+
+	for (const RenderLightObject* renderLightObject : releasedRenderLightObjects) {
+		_volume->ReleaseTile (renderLightObject);
+	}
+}
+
+void SpotLightShadowAtlasRenderPass::ScheduleTile (SpotLightShadowAtlasVolume::Tile* tile,
+	const RenderSpotLightObject* renderSpotLightObject, std::size_t castersSignature)
+{
+	SpotLightShadowMapRenderPass::SetupLightCamera (tile->lightCamera, renderSpotLightObject);
+
+	tile->castersSignature = castersSignature;
+	tile->shadowBias = renderSpotLightObject->GetShadow ().bias;
+
+	tile->valid = true;
+	tile->scheduled = true;
+	tile->staleFrames = 0;
+}
+
+std::size_t SpotLightShadowAtlasRenderPass::GetTileLevel (const RenderSpotLightObject* renderSpotLightObject,
+	float distance, const SpotLightShadowAtlasVolume::Tile* tile) const
+{
+	/*
+	 * Approximate screen coverage of the light by the angle its range
+	 * takes from the camera
+	*/
+
+	float coverage = 1.0f;
+
+	if (distance > renderSpotLightObject->GetLightRange ()) {
+		coverage = renderSpotLightObject->GetLightRange () / distance;
+	}
+
+	float tileSize = std::max (renderSpotLightObject->GetShadow ().resolution.x * coverage,
+		(float) SPOT_LIGHT_SHADOW_ATLAS_MIN_TILE_SIZE);
+
+	float maxLevel = (float) (_volume->GetLevelsCount () - 1);
+	float level = glm::clamp (std::log2 (_volume->GetSize () / tileSize), 0.0f, maxLevel);
+
+	/*
+	 * Keep the current size near level boundaries, so tiles are not
+	 * allocated again every frame
+	*/
+
+	if (tile != nullptr && std::abs (level - tile->level) < SPOT_LIGHT_SHADOW_ATLAS_LEVEL_HYSTERESIS) {
+		return tile->level;
+	}
+
+	return (std::size_t) std::round (level);
+}
+
+std::size_t SpotLightShadowAtlasRenderPass::GetAtlasSize (const RenderSettings& settings) const
+{
+	/*
+	 * Atlas holds at least one tile of the smallest size, and is split
+	 * in halves down to it by the allocator
+	*/
+
+	std::size_t atlasSize = SPOT_LIGHT_SHADOW_ATLAS_MIN_TILE_SIZE;
+
+	while (atlasSize * 2 <= settings.spot_shadow_atlas_size) {
+		atlasSize *= 2;
+	}
+
+	return atlasSize;
+}
+
+bool SpotLightShadowAtlasRenderPass::IsLightCameraChanged (const PerspectiveCamera* tileCamera) const
+{
+	return tileCamera->GetPosition () != _lightCamera->GetPosition () ||
+		tileCamera->GetRotation () != _lightCamera->GetRotation () ||
+		tileCamera->GetZFar () != _lightCamera->GetZFar () ||
+		tileCamera->GetFieldOfViewAngle () != _lightCamera->GetFieldOfViewAngle ();
+}
+
+std::size_t SpotLightShadowAtlasRenderPass::GetCastersSignature (const std::vector<RenderObject*>* shadowCasters, bool& animated) const
+{
+	animated = false;
+
+	/*
+	 * Without culled casters the tile cannot tell if they moved
+	*/
+
+	if (shadowCasters == nullptr) {
+		animated = true;
+
+		return 0;
+	}
+
+	std::size_t signature = shadowCasters->size ();
+
+	/*
+	 * Model matrix changes when a caster rotates in place as well,
+	 * unlike its bounding box
+	*/
+
+	for (const RenderObject* renderObject : *shadowCasters) {
+		Extensions::HashExtend::Combine (signature, renderObject);
+		Extensions::HashExtend::Combine (signature, renderObject->GetTransform ()->GetModelMatrix ());
+
+		if (renderObject->GetSceneLayers () & SceneLayer::ANIMATION) {
+			animated = true;
+		}
+	}
+
+	return signature;
+}
+
+void SpotLightShadowAtlasRenderPass::UpdateStatistics (std::size_t renderedTilesCount)
+{
+	std::size_t tilesCount = 0;
+
+	for (auto& tile : *_volume) {
+		tilesCount += tile.second.valid == true ? 1 : 0;
+	}
+
+	auto spotLightShadowStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <SpotLightShadowStatisticsObject> ();
+
+	spotLightShadowStatisticsObject->RenderedTilesCount = renderedTilesCount;
+	spotLightShadowStatisticsObject->ReusedTilesCount = tilesCount - renderedTilesCount;
+}
@@ -0,0 +1,59 @@
+#ifndef SPOTLIGHTSHADOWATLASRENDERPASS_H
+#define SPOTLIGHTSHADOWATLASRENDERPASS_H
+
+#include "Renderer/RenderPassI.h"
+
+#include "RenderPasses/ShadowMap/SpotLightShadowAtlasVolume.h"
+#include "RenderPasses/ShadowMap/ShadowCastersVolume.h"
+
+#include "Renderer/RenderSpotLightObject.h"
+
+/*
+ * Places every shadow casting spot light in the shadow atlas and
+ * decides which tiles are drawn this frame. Tiles are sized by how much
+ * of the screen the light may cover. New tiles are always drawn, while
+ * tiles whose light or casters changed are drawn nearest first, up to
+ * the update budget. The others keep the shadow map of an earlier frame.
+*/
+
+class ENGINE_API SpotLightShadowAtlasRenderPass : public RenderPassI
+{
+	DECLARE_RENDER_PASS(SpotLightShadowAtlasRenderPass)
+
+protected:
+	struct ChangedTile
+	{
+		float priority;
+		const RenderSpotLightObject* renderSpotLightObject;
+		std::size_t castersSignature;
+	};
+
+	SpotLightShadowAtlasVolume* _volume;
+	PerspectiveCamera* _lightCamera;
+
+public:
+	SpotLightShadowAtlasRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	void Clear ();
+protected:
+	void UpdateAtlasVolume (const RenderSettings& settings);
+	void InitAtlasVolume (const RenderSettings& settings);
+
+	void ReleaseTiles (const std::vector<std::pair<float, const RenderSpotLightObject*>>& renderSpotLightObjects);
+	void ScheduleTile (SpotLightShadowAtlasVolume::Tile* tile, const RenderSpotLightObject* renderSpotLightObject,
+		std::size_t castersSignature);
+
+	std::size_t GetTileLevel (const RenderSpotLightObject* renderSpotLightObject, float distance,
+		const SpotLightShadowAtlasVolume::Tile* tile) const;
+	std::size_t GetAtlasSize (const RenderSettings& settings) const;
+	bool IsLightCameraChanged (const PerspectiveCamera* tileCamera) const;
+	std::size_t GetCastersSignature (const std::vector<RenderObject*>* shadowCasters, bool& animated) const;
+
+	void UpdateStatistics (std::size_t renderedTilesCount);
+};
+
+#endif
@@ -0,0 +1,261 @@
+#include "SpotLightShadowAtlasVolume.h"
+
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+
+SpotLightShadowAtlasVolume::SpotLightShadowAtlasVolume (const Resource<Framebuffer>& framebuffer) :
+	FramebufferRenderVolume (framebuffer),
+	_freeNodes (),
+	_tiles ()
+{
+	/*
+	 * Create attributes
+	*/
+
+	PipelineAttribute lightSpaceMatrix;
+	PipelineAttribute shadowBias;
+
+	lightSpaceMatrix.type = PipelineAttribute::AttrType::ATTR_MATRIX_4X4F;
+	shadowBias.type = PipelineAttribute::AttrType::ATTR_1F;
+
+	lightSpaceMatrix.name = "lightSpaceMatrix";
+	shadowBias.name = "shadowBias";
+
+	_attributes.push_back (lightSpaceMatrix);
+	_attributes.push_back (shadowBias);
+
+	/*
+	 * Whole atlas is a single free node at first
+	*/
+
+	_freeNodes.resize (GetLevelsCount ());
+	_freeNodes [0].push_back (glm::uvec2 (0));
+}
+
+SpotLightShadowAtlasVolume::~SpotLightShadowAtlasVolume ()
+{
+	/*
+	 * Delete light cameras
+	*/
+
+	for (auto& tile : _tiles) {
+		delete tile.second.lightCamera;
+	}
+
+	_tiles.clear ();
+}
+
+SpotLightShadowAtlasVolume::Tile* SpotLightShadowAtlasVolume::GetTile (const RenderLightObject* renderLightObject)
+{
+	auto it = _tiles.find (renderLightObject);
+
+	if (it == _tiles.end ()) {
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
+SpotLightShadowAtlasVolume::Tile* SpotLightShadowAtlasVolume::AllocateTile (const RenderLightObject* renderLightObject, std::size_t level)
+{
+	/*
+	 * Release the tile the light had before
+	*/
+
+	ReleaseTile (renderLightObject);
+
+	glm::uvec2 position;
+
+	if (AllocateNode (level, position) == false) {
+		return nullptr;
+	}
+
+	Tile& tile = _tiles [renderLightObject];
+
+	tile.level = level;
+	tile.position = position;
+	tile.size = GetTileSize (level);
+
+	tile.valid = false;
+	tile.scheduled = false;
+	tile.visited = true;
+	tile.staleFrames = 0;
+
+	tile.lightCamera = new PerspectiveCamera ();
+	tile.castersSignature = 0;
+	tile.shadowBias = 0.0f;
+
+	return &tile;
+}
+
+void SpotLightShadowAtlasVolume::ReleaseTile (const RenderLightObject* renderLightObject)
+{
+	auto it = _tiles.find (renderLightObject);
+
+	if (it == _tiles.end ()) {
+		return;
+	}
+
+	ReleaseNode (it->second.level, it->second.position);
+
+	delete it->second.lightCamera;
+
+	_tiles.erase (it);
+}
+
+bool SpotLightShadowAtlasVolume::CanAllocateTile (std::size_t level) const
+{
+	/*
+	 * A free node of the level, or a larger one to split, is needed
+	*/
+
+	for (std::size_t nodeLevel = 0; nodeLevel <= level && nodeLevel < _freeNodes.size (); nodeLevel ++) {
+		if (_freeNodes [nodeLevel].empty () == false) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SpotLightShadowAtlasVolume::SelectTile (const RenderLightObject* renderLightObject)
+{
+	Tile* tile = GetTile (renderLightObject);
+
+	if (tile == nullptr) {
+		return;
+	}
+
+	/*
+	 * Map light space on the tile inside its border, so filtering never
+	 * reads a neighbour tile
+	*/
+
+	float atlasSize = (float) GetSize ();
+	float border = (float) SPOT_LIGHT_SHADOW_ATLAS_TILE_BORDER;
+
+	glm::vec2 offset = (glm::vec2 (tile->position) + border) / atlasSize;
+	float scale = (tile->size - 2.0f * border) / atlasSize;
+
+	glm::mat4 lightProjection = tile->lightCamera->GetProjectionMatrix ();
+	glm::mat4 lightView = glm::translate (glm::mat4_cast(tile->lightCamera->GetRotation ()), tile->lightCamera->GetPosition () * -1.0f);
+	glm::mat4 screenMatrix = glm::scale (glm::translate (glm::mat4 (1), glm::vec3 (0.5f)), glm::vec3 (0.5f));
+	glm::mat4 tileMatrix = glm::scale (glm::translate (glm::mat4 (1), glm::vec3 (offset, 0.0f)), glm::vec3 (scale, scale, 1.0f));
+
+	/*
+	 * Update attributes
+	*/
+
+	_attributes [1].matrix = tileMatrix * screenMatrix * lightProjection * lightView;
+	_attributes [2].value.x = tile->shadowBias;
+}
+
+std::size_t SpotLightShadowAtlasVolume::GetSize () const
+{
+	return _framebuffer->GetDepthTexture ()->GetSize ().width;
+}
+
+std::size_t SpotLightShadowAtlasVolume::GetLevelsCount () const
+{
+	std::size_t levelsCount = 1;
+
+	while ((GetSize () >> levelsCount) >= SPOT_LIGHT_SHADOW_ATLAS_MIN_TILE_SIZE) {
+		levelsCount ++;
+	}
+
+	return levelsCount;
+}
+
+std::size_t SpotLightShadowAtlasVolume::GetTileSize (std::size_t level) const
+{
+	return GetSize () >> level;
+}
+
+std::map<const RenderLightObject*, SpotLightShadowAtlasVolume::Tile>::iterator SpotLightShadowAtlasVolume::begin ()
+{
+	return _tiles.begin ();
+}
+
+std::map<const RenderLightObject*, SpotLightShadowAtlasVolume::Tile>::iterator SpotLightShadowAtlasVolume::end ()
+{
+	return _tiles.end ();
+}
+
+bool SpotLightShadowAtlasVolume::AllocateNode (std::size_t level, glm::uvec2& position)
+{
+	if (_freeNodes [level].empty () == false) {
+		position = _freeNodes [level].back ();
+		_freeNodes [level].pop_back ();
+
+		return true;
+	}
+
+	/*
+	 * Split a node of the level above in four
+	*/
+
+	if (level == 0) {
+		return false;
+	}
+
+	glm::uvec2 parent;
+
+	if (AllocateNode (level - 1, parent) == false) {
+		return false;
+	}
+
+	unsigned int size = GetTileSize (level);
+
+	_freeNodes [level].push_back (parent + glm::uvec2 (size, 0));
+	_freeNodes [level].push_back (parent + glm::uvec2 (0, size));
+	_freeNodes [level].push_back (parent + glm::uvec2 (size, size));
+
+	position = parent;
+
+	return true;
+}
+
+void SpotLightShadowAtlasVolume::ReleaseNode (std::size_t level, const glm::uvec2& position)
+{
+	auto& freeNodes = _freeNodes [level];
+
+	/*
+	 * Merge the node back into its parent when its siblings are free
+	*/
+
+	if (level > 0) {
+		unsigned int size = GetTileSize (level);
+		unsigned int parentSize = GetTileSize (level - 1);
+
+		glm::uvec2 parent = (position / parentSize) * parentSize;
+
+		std::size_t freeSiblingsCount = 0;
+
+		for (unsigned int y = 0; y < 2; y ++) {
+			for (unsigned int x = 0; x < 2; x ++) {
+				glm::uvec2 sibling = parent + glm::uvec2 (x, y) * size;
+
+				if (sibling == position) {
+					continue;
+				}
+
+				if (std::find (freeNodes.begin (), freeNodes.end (), sibling) != freeNodes.end ()) {
+					freeSiblingsCount ++;
+				}
+			}
+		}
+
+		if (freeSiblingsCount == 3) {
+			freeNodes.erase (std::remove_if (freeNodes.begin (), freeNodes.end (),
+				[&parent, parentSize] (const glm::uvec2& node) {
+					return (node / parentSize) * parentSize == parent;
+				}), freeNodes.end ());
+
+			ReleaseNode (level - 1, parent);
+
+			return;
+		}
+	}
+
+	freeNodes.push_back (position);
+}
@@ -0,0 +1,72 @@
+#ifndef SPOTLIGHTSHADOWATLASVOLUME_H
+#define SPOTLIGHTSHADOWATLASVOLUME_H
+
+#include "RenderPasses/FramebufferRenderVolume.h"
+
+#include <map>
+
+#include "Renderer/RenderLightObject.h"
+#include "Cameras/PerspectiveCamera.h"
+
+#define SPOT_LIGHT_SHADOW_ATLAS_MIN_TILE_SIZE 64
+
+/*
+ * Texels left cleared around each tile, wide enough for the 3x3 PCF
+ * kernel of the light pass
+*/
+
+#define SPOT_LIGHT_SHADOW_ATLAS_TILE_BORDER 2
+
+/*
+ * Shadow maps of all spot lights packed in a single depth texture.
+ * Tiles are square, power of two sized and placed by a quadtree buddy
+ * allocator, so a light keeps its tile, and the shadow map drawn in it,
+ * for as long as its size does not change.
+*/
+
+class SpotLightShadowAtlasVolume : public FramebufferRenderVolume
+{
+public:
+	struct Tile
+	{
+		std::size_t level;
+		glm::uvec2 position;
+		std::size_t size;
+
+		bool valid;
+		bool scheduled;
+		bool visited;
+		std::size_t staleFrames;
+
+		PerspectiveCamera* lightCamera;
+		std::size_t castersSignature;
+		float shadowBias;
+	};
+
+protected:
+	std::vector<std::vector<glm::uvec2>> _freeNodes;
+	std::map<const RenderLightObject*, Tile> _tiles;
+
+public:
+	SpotLightShadowAtlasVolume (const Resource<Framebuffer>& framebuffer);
+	~SpotLightShadowAtlasVolume ();
+
+	Tile* GetTile (const RenderLightObject* renderLightObject);
+	Tile* AllocateTile (const RenderLightObject* renderLightObject, std::size_t level);
+	void ReleaseTile (const RenderLightObject* renderLightObject);
+	bool CanAllocateTile (std::size_t level) const;
+
+	void SelectTile (const RenderLightObject* renderLightObject);
+
+	std::size_t GetSize () const;
+	std::size_t GetLevelsCount () const;
+	std::size_t GetTileSize (std::size_t level) const;
+
+	std::map<const RenderLightObject*, Tile>::iterator begin ();
+	std::map<const RenderLightObject*, Tile>::iterator end ();
+protected:
+	bool AllocateNode (std::size_t level, glm::uvec2& position);
+	void ReleaseNode (std::size_t level, const glm::uvec2& position);
+};
+
+#endif
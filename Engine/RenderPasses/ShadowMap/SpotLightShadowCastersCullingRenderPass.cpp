@@ -0,0 +1,79 @@
+#include "SpotLightShadowCastersCullingRenderPass.h"
+
+#include "RenderPasses/ShadowMap/SpotLightShadowMapRenderPass.h"
+
+SpotLightShadowCastersCullingRenderPass::SpotLightShadowCastersCullingRenderPass () :
+	_volume (nullptr),
+	_lightCameras ()
+{
+
+}
+
+void SpotLightShadowCastersCullingRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Initialize shadow casters volume
+	*/
+
+	_volume = new ShadowCastersVolume ();
+}
+
+RenderVolumeCollection* SpotLightShadowCastersCullingRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	_volume->Reset ();
+
+	/*
+	 * Attach a view for every active spot light that casts shadows
+	*/
+
+	std::size_t lightIndex = 0;
+
+	for_each_type (RenderSpotLightObject*, renderSpotLightObject, *renderScene) {
+
+		if (renderSpotLightObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderSpotLightObject->IsCastingShadows () == false) {
+			continue;
+		}
+
+		if (lightIndex == _lightCameras.size ()) {
+			_lightCameras.push_back (new PerspectiveCamera ());
+		}
+
+		PerspectiveCamera* lightCamera = _lightCameras [lightIndex ++];
+
+		SpotLightShadowMapRenderPass::SetupLightCamera (lightCamera, renderSpotLightObject);
+
+		_volume->AttachLightView (renderSpotLightObject, lightCamera->GetFrustumVolume ());
+	}
+
+	/*
+	 * Cull shadow casters for all spot lights in a single sweep
+	*/
+
+	_volume->Execute (renderScene);
+
+	return rvc->Insert ("ShadowCastersSpotLightVolume", _volume, false);
+}
+
+void SpotLightShadowCastersCullingRenderPass::Clear ()
+{
+	/*
+	 * Clear shadow casters volume
+	*/
+
+	delete _volume;
+
+	/*
+	 * Clear light cameras
+	*/
+
+	for (PerspectiveCamera* lightCamera : _lightCameras) {
+		delete lightCamera;
+	}
+
+	_lightCameras.clear ();
+}
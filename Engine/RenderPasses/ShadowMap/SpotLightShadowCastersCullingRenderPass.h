@@ -0,0 +1,28 @@
+#ifndef SPOTLIGHTSHADOWCASTERSCULLINGRENDERPASS_H
+#define SPOTLIGHTSHADOWCASTERSCULLINGRENDERPASS_H
+
+#include "Renderer/RenderPassI.h"
+
+#include "RenderPasses/ShadowMap/ShadowCastersVolume.h"
+
+#include "Cameras/PerspectiveCamera.h"
+
+class ENGINE_API SpotLightShadowCastersCullingRenderPass : public RenderPassI
+{
+	DECLARE_RENDER_PASS(SpotLightShadowCastersCullingRenderPass)
+
+protected:
+	ShadowCastersVolume* _volume;
+	std::vector<PerspectiveCamera*> _lightCameras;
+
+public:
+	SpotLightShadowCastersCullingRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	void Clear ();
+};
+
+#endif
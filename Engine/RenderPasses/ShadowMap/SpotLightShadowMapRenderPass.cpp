@@ -1,8 +1,9 @@
 #include "SpotLightShadowMapRenderPass.h"
 
-#include "Core/Intersections/Intersection.h"
+#include "RenderPasses/ShadowMap/ShadowCastersVolume.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/LevelOfDetailSelection.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -11,7 +12,8 @@
 #include "SceneNodes/SceneLayer.h"
 
 SpotLightShadowMapRenderPass::SpotLightShadowMapRenderPass () :
-	_volume (nullptr)
+	_volume (nullptr),
+	_culling ()
 {
 
 }
@@ -25,6 +27,29 @@ RenderVolumeCollection* SpotLightShadowMapRenderPass::Execute (const RenderScene
 
 	RenderLightObject* renderLightObject = GetRenderLightObject (rvc);
 
+	/*
+	 * Use the tile of the light in the shadow atlas if it has one
+	*/
+
+	auto atlasVolume = (SpotLightShadowAtlasVolume*) rvc->GetRenderVolume ("SpotLightShadowAtlasVolume");
+
+	if (atlasVolume != nullptr && atlasVolume->GetTile (renderLightObject) != nullptr) {
+
+		/*
+		 * Draw the tile only if it was scheduled for this frame
+		*/
+
+		if (atlasVolume->GetTile (renderLightObject)->scheduled == true) {
+			ShadowAtlasTilePass (renderScene, camera, settings, renderLightObject, rvc, atlasVolume);
+
+			EndShadowMapPass ();
+		}
+
+		atlasVolume->SelectTile (renderLightObject);
+
+		return rvc->Insert ("ShadowMapSpotLightVolume", atlasVolume, false);
+	}
+
 	/*
 	 * Update shadow map volume
 	*/
@@ -41,7 +66,7 @@ RenderVolumeCollection* SpotLightShadowMapRenderPass::Execute (const RenderScene
 	 * Draw shadow map
 	*/
 
-	ShadowMapPass (renderScene, camera);
+	ShadowMapPass (renderScene, camera, settings, renderLightObject, rvc);
 
 	/*
 	 * End drawing
@@ -70,7 +95,21 @@ bool SpotLightShadowMapRenderPass::IsAvailable (const RenderLightObject* renderL
 	return renderLightObject->IsCastingShadows ();
 }
 
-void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera)
+void SpotLightShadowMapRenderPass::SetupLightCamera (PerspectiveCamera* lightCamera, const RenderSpotLightObject* renderSpotLightObject)
+{
+	const Transform* lightTransform = renderSpotLightObject->GetTransform ();
+
+	lightCamera->SetPosition (lightTransform->GetPosition ());
+	lightCamera->SetRotation (glm::conjugate (lightTransform->GetRotation ()));
+
+	lightCamera->SetZNear (0.05f);
+	lightCamera->SetZFar (renderSpotLightObject->GetLightRange ());
+	lightCamera->SetFieldOfViewAngle (renderSpotLightObject->GetLightSpotOuterCutoff () * 2);
+	lightCamera->SetAspect (1.0f);
+}
+
+void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc)
 {
 	/*
 	 * Change resolution on viewport as shadow map size
@@ -88,6 +127,56 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 
 	GL::Clear (GL_DEPTH_BUFFER_BIT);
 
+	/*
+	 * Render shadow casters from light camera
+	*/
+
+	RenderShadowCasters (renderScene, camera, settings, renderLightObject, rvc, _volume->GetLightCamera ());
+}
+
+void SpotLightShadowMapRenderPass::ShadowAtlasTilePass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc,
+	SpotLightShadowAtlasVolume* atlasVolume)
+{
+	const SpotLightShadowAtlasVolume::Tile* tile = atlasVolume->GetTile (renderLightObject);
+
+	/*
+	 * Bind shadow atlas for writing
+	*/
+
+	atlasVolume->GetFramebufferView ()->Activate ();
+
+	/*
+	 * Clear only the tile, borders included
+	*/
+
+	GL::Enable (GL_SCISSOR_TEST);
+	GL::Scissor (tile->position.x, tile->position.y, tile->size, tile->size);
+
+	GL::DepthMask (GL_TRUE);
+	GL::Clear (GL_DEPTH_BUFFER_BIT);
+
+	GL::Disable (GL_SCISSOR_TEST);
+
+	/*
+	 * Draw inside the tile borders, so they stay cleared
+	*/
+
+	const std::size_t border = SPOT_LIGHT_SHADOW_ATLAS_TILE_BORDER;
+
+	GL::Viewport (tile->position.x + border, tile->position.y + border, tile->size - 2 * border, tile->size - 2 * border);
+
+	/*
+	 * Render shadow casters from tile light camera
+	*/
+
+	RenderShadowCasters (renderScene, camera, settings, renderLightObject, rvc, tile->lightCamera);
+}
+
+void SpotLightShadowMapRenderPass::RenderShadowCasters (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc,
+	PerspectiveCamera* lightCamera)
+{
 	/*
 	 * Shadow map is a depth test
 	*/
@@ -109,8 +198,6 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 	GL::Enable(GL_CULL_FACE);
 	GL::CullFace (GL_FRONT);
 
-	PerspectiveCamera* lightCamera = _volume->GetLightCamera ();
-
 	/*
 	 * Send light camera
 	*/
@@ -119,37 +206,16 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 	Pipeline::SendCamera (lightCamera);
 
 	/*
-	 * Light camera
+	 * Get shadow casters visible from light camera
 	*/
 
-	auto frustum = lightCamera->GetFrustumVolume ();
+	const auto& shadowCasters = GetShadowCasters (renderScene, renderLightObject, rvc, lightCamera);
 
 	/*
 	* Render scene entities to framebuffer at Deferred Rendering Stage
 	*/
 
-	for_each_type (RenderObject*, renderObject, *renderScene) {
-
-		/*
-		 * Check if it's active
-		*/
-
-		if (renderObject->IsActive () == false) {
-			continue;
-		}
-
-		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
-			continue;
-		}
-
-		/*
-		 * Culling Check
-		*/
-
-		auto& boundingBox = renderObject->GetBoundingBox ();
-		if (!Intersection::Instance ()->CheckFrustumVsAABB (frustum, boundingBox)) {
-			continue;
-		}
+	for (RenderObject* renderObject : shadowCasters) {
 
 		/*
 		 * Lock shader based on scene object layer
@@ -164,13 +230,41 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
 
 		/*
-		 * Render object on shadow map
+		 * Render object on shadow map with the level of detail seen by view camera
 		*/
 
-		renderObject->DrawGeometry ();
+		renderObject->DrawGeometry (LevelOfDetailSelection::Select (renderObject, camera, settings));
 	}
 }
 
+const std::vector<RenderObject*>& SpotLightShadowMapRenderPass::GetShadowCasters (const RenderScene* renderScene,
+	const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc, const Camera* lightCamera)
+{
+	/*
+	 * Use shadow casters culled for all spot lights at once if available
+	*/
+
+	auto shadowCastersVolume = (ShadowCastersVolume*) rvc->GetRenderVolume ("ShadowCastersSpotLightVolume");
+
+	if (shadowCastersVolume != nullptr) {
+		auto shadowCasters = shadowCastersVolume->GetShadowCasters (renderLightObject);
+
+		if (shadowCasters != nullptr) {
+			return *shadowCasters;
+		}
+	}
+
+	/*
+	 * Cull scene only against this light camera otherwise
+	*/
+
+	_culling.Reset ();
+	_culling.AttachView (lightCamera->GetFrustumVolume ());
+	_culling.Execute (renderScene, RenderStage::RENDER_STAGE_DEFERRED);
+
+	return _culling.GetVisibleObjects (0);
+}
+
 void SpotLightShadowMapRenderPass::EndShadowMapPass ()
 {
 	/*
@@ -195,17 +289,9 @@ void SpotLightShadowMapRenderPass::UpdateLightCamera (const RenderLightObject* r
 {
 	auto renderSpotLightObject = dynamic_cast<const RenderSpotLightObject*> (renderLightObject);
 
-	const Transform* lightTransform = renderSpotLightObject->GetTransform ();
-
 	PerspectiveCamera* lightCamera = _volume->GetLightCamera ();
 
-	lightCamera->SetPosition (lightTransform->GetPosition ());
-	lightCamera->SetRotation (glm::conjugate (lightTransform->GetRotation ()));
-
-	lightCamera->SetZNear (0.05f);
-	lightCamera->SetZFar (renderSpotLightObject->GetLightRange ());
-	lightCamera->SetFieldOfViewAngle (renderSpotLightObject->GetLightSpotOuterCutoff () * 2);
-	lightCamera->SetAspect (1.0f);
+	SetupLightCamera (lightCamera, renderSpotLightObject);
 
 	_volume->SetLightCamera (lightCamera);
 }
@@ -4,11 +4,16 @@
 #include "RenderPasses/VolumetricLightRenderPassI.h"
 
 #include "RenderPasses/ShadowMap/PerspectiveShadowMapVolume.h"
+#include "RenderPasses/ShadowMap/SpotLightShadowAtlasVolume.h"
+
+#include "Renderer/MultiViewCulling.h"
+#include "Renderer/RenderSpotLightObject.h"
 
 class ENGINE_API SpotLightShadowMapRenderPass : public VolumetricLightRenderPassI
 {
 protected:
 	PerspectiveShadowMapVolume* _volume;
+	MultiViewCulling _culling;
 
 public:
 	SpotLightShadowMapRenderPass ();
@@ -17,16 +22,27 @@ public:
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	void Clear ();
+
+	static void SetupLightCamera (PerspectiveCamera* lightCamera, const RenderSpotLightObject* renderSpotLightObject);
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
-	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera);
+	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc);
+	void ShadowAtlasTilePass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc,
+		SpotLightShadowAtlasVolume* atlasVolume);
+	void RenderShadowCasters (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings,
+		const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc, PerspectiveCamera* lightCamera);
 	void EndShadowMapPass ();
 
 	virtual void LockShader (int sceneLayers) = 0;
 
 	virtual std::vector<PipelineAttribute> GetCustomAttributes () const;
 
+	const std::vector<RenderObject*>& GetShadowCasters (const RenderScene* renderScene,
+		const RenderLightObject* renderLightObject, const RenderVolumeCollection* rvc, const Camera* lightCamera);
+
 	void UpdateLightCamera (const RenderLightObject* renderLightObject);
 	void UpdateShadowMapVolume (const RenderLightObject* renderLightObject);
 	void InitShadowMapVolume (const RenderLightObject* renderLightObject);
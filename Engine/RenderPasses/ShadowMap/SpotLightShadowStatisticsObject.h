@@ -0,0 +1,14 @@
+#ifndef SPOTLIGHTSHADOWSTATISTICSOBJECT_H
+#define SPOTLIGHTSHADOWSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API SpotLightShadowStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(SpotLightShadowStatisticsObject)
+
+	std::size_t RenderedTilesCount;
+	std::size_t ReusedTilesCount;
+};
+
+#endif
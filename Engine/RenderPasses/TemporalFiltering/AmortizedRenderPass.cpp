@@ -0,0 +1,265 @@
+#include "AmortizedRenderPass.h"
+
+#include "Renderer/FrameGraph.h"
+
+AmortizedRenderPass::AmortizedRenderPass () :
+	_amortized (false),
+	_historyValid (false),
+	_amortizationFrame (0),
+	_amortizedRenderLightObject (nullptr),
+	_amortizationShared (false)
+{
+
+}
+
+void AmortizedRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Initialize post process render pass. Last post process map volume
+	 * is only created when the pass is amortized.
+	*/
+
+	PostProcessRenderPass::Init (settings);
+}
+
+RenderVolumeCollection* AmortizedRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * History is kept for one light only. A pass that sees another
+	 * light than on its previous execution is shared by several lights,
+	 * which would reproject each other's result.
+	*/
+
+	const RenderLightObject* renderLightObject = GetAmortizedRenderLightObject (rvc);
+
+	_amortizationShared = renderLightObject != _amortizedRenderLightObject;
+	_amortizedRenderLightObject = renderLightObject;
+
+	std::size_t framesCount = GetAmortizationFramesCount (settings);
+
+	/*
+	 * Pass computed every frame keeps a transient volume
+	*/
+
+	if (framesCount == 1) {
+		if (_amortized == true) {
+			EndAmortization (rvc);
+		}
+
+		return PostProcessRenderPass::Execute (renderScene, camera, settings, rvc);
+	}
+
+	if (_amortized == false) {
+		StartAmortization (settings, rvc);
+	}
+
+	_frameCount = (_frameCount + 1) & 1;
+
+	/*
+	 * History is lost when the volumes are recreated
+	*/
+
+	glm::ivec2 volumeResolution = GetPostProcessVolumeResolution (settings);
+
+	auto framebufferSize = _postProcessMapVolume->GetFramebuffer ()->GetTexture (0)->GetSize ();
+
+	if ((std::size_t) volumeResolution.x != framebufferSize.width ||
+		(std::size_t) volumeResolution.y != framebufferSize.height) {
+		_historyValid = false;
+	}
+
+	UpdateLastPostProcessMapVolume (settings);
+
+	/*
+	 * Update settings
+	*/
+
+	UpdatePostProcessSettings (settings);
+
+	/*
+	 * Update shader variant
+	*/
+
+	UpdatePostProcessShader (settings);
+
+	/*
+	 * Start amortized pass
+	*/
+
+	StartPostProcessPass ();
+
+	/*
+	 * Amortized pass
+	*/
+
+	PostProcessPass (renderScene, camera, settings, rvc);
+
+	/*
+	 * End amortized pass
+	*/
+
+	EndPostProcessPass ();
+
+	/*
+	 * Keep current camera view projection matrix
+	*/
+
+	glm::mat4 projectionMatrix = camera->GetProjectionMatrix ();
+	glm::mat4 viewMatrix = glm::translate (glm::mat4_cast (camera->GetRotation ()), camera->GetPosition () * -1.0f);
+
+	_lastViewProjectionMatrix = projectionMatrix * viewMatrix;
+
+	/*
+	 * Advance to the next frame or pixels subset
+	*/
+
+	_amortizationFrame = _historyValid == true ? (_amortizationFrame + 1) % framesCount : 1 % framesCount;
+	_historyValid = true;
+
+	return rvc->Insert (_postProcessVolumeHandle, GetCurrentPostProcessMapVolume ());
+}
+
+void AmortizedRenderPass::StartPostProcessPass ()
+{
+	if (_amortized == true) {
+		TemporalFilterRenderPass::StartPostProcessPass ();
+	} else {
+		PostProcessRenderPass::StartPostProcessPass ();
+	}
+}
+
+std::vector<PipelineAttribute> AmortizedRenderPass::GetCustomAttributes (const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	if (_amortized == false) {
+		return PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	}
+
+	/*
+	 * Attach temporal filter attributes to pipeline
+	*/
+
+	std::vector<PipelineAttribute> attributes = TemporalFilterRenderPass::GetCustomAttributes (camera, settings, rvc);
+
+	/*
+	 * Attach amortization attributes to pipeline. The first frame after
+	 * a reset has no history, so it is computed entirely.
+	*/
+
+	PipelineAttribute amortizationInterval;
+	PipelineAttribute amortizationFrame;
+	PipelineAttribute amortizationInterleaved;
+
+	amortizationInterval.type = PipelineAttribute::AttrType::ATTR_1I;
+	amortizationFrame.type = PipelineAttribute::AttrType::ATTR_1I;
+	amortizationInterleaved.type = PipelineAttribute::AttrType::ATTR_1I;
+
+	amortizationInterval.name = "amortizationInterval";
+	amortizationFrame.name = "amortizationFrame";
+	amortizationInterleaved.name = "amortizationInterleaved";
+
+	amortizationInterval.value.x = _historyValid == true ? GetAmortizationFramesCount (settings) : 1;
+	amortizationFrame.value.x = _historyValid == true ? _amortizationFrame % GetAmortizationFramesCount (settings) : 0;
+	amortizationInterleaved.value.x = IsAmortizationInterleaved (settings);
+
+	attributes.push_back (amortizationInterval);
+	attributes.push_back (amortizationFrame);
+	attributes.push_back (amortizationInterleaved);
+
+	return attributes;
+}
+
+std::vector<std::string> AmortizedRenderPass::GetPostProcessDefines (const RenderSettings& settings) const
+{
+	if (GetAmortizationFramesCount (settings) == 1) {
+		return {};
+	}
+
+	return { "AMORTIZED" };
+}
+
+PostProcessDefinesKey AmortizedRenderPass::GetPostProcessDefinesKey (const RenderSettings& settings) const
+{
+	return { GetAmortizationFramesCount (settings) };
+}
+
+std::size_t AmortizedRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return 1;
+}
+
+bool AmortizedRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return false;
+}
+
+const RenderLightObject* AmortizedRenderPass::GetAmortizedRenderLightObject (const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Pass does not depend on a light by default
+	*/
+
+	return nullptr;
+}
+
+std::size_t AmortizedRenderPass::GetAmortizationFramesCount (const RenderSettings& settings) const
+{
+	std::size_t interval = GetAmortizationInterval (settings);
+
+	if (interval <= 1 || _amortizationShared == true) {
+		return 1;
+	}
+
+	/*
+	 * Interleaved pixels are split in a checkerboard or a 2x2 pattern
+	*/
+
+	if (IsAmortizationInterleaved (settings) == true) {
+		return interval <= 2 ? 2 : 4;
+	}
+
+	return interval;
+}
+
+void AmortizedRenderPass::StartAmortization (const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Post process volume may share its framebuffer through the frame
+	 * graph pool, give the pass its own volumes to keep as history
+	*/
+
+	delete _postProcessMapVolume;
+
+	_postProcessMapVolume = CreatePostProcessVolume (settings);
+	_postProcessMapVolume2 = CreatePostProcessVolume (settings);
+
+	/*
+	 * Current plan still releases the replaced volume
+	*/
+
+	if (rvc->GetFrameGraph () != nullptr) {
+		rvc->GetFrameGraph ()->Invalidate ();
+	}
+
+	_amortized = true;
+	_historyValid = false;
+	_amortizationFrame = 0;
+}
+
+void AmortizedRenderPass::EndAmortization (RenderVolumeCollection* rvc)
+{
+	/*
+	 * History is not needed anymore
+	*/
+
+	delete _postProcessMapVolume2;
+
+	_postProcessMapVolume2 = nullptr;
+
+	if (rvc->GetFrameGraph () != nullptr) {
+		rvc->GetFrameGraph ()->Invalidate ();
+	}
+
+	_amortized = false;
+}
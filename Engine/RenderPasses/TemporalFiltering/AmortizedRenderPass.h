@@ -0,0 +1,52 @@
+#ifndef AMORTIZEDRENDERPASS_H
+#define AMORTIZEDRENDERPASS_H
+
+#include "TemporalFilterRenderPass.h"
+
+#include "Renderer/RenderLightObject.h"
+
+/*
+ * Post process pass whose cost can be spread over several frames. With
+ * an amortization interval above one, the pass either computes a whole
+ * frame once every interval frames, or an interleaved subset of the
+ * pixels every frame (checkerboard for two, 2x2 pattern for four). The
+ * pixels not computed are reprojected from the previous result, kept
+ * in the temporal filter history. The history belongs to a single
+ * light, so a pass shared by several lights is computed entirely.
+*/
+
+class ENGINE_API AmortizedRenderPass : public TemporalFilterRenderPass
+{
+protected:
+	bool _amortized;
+	bool _historyValid;
+	std::size_t _amortizationFrame;
+	const RenderLightObject* _amortizedRenderLightObject;
+	bool _amortizationShared;
+
+public:
+	AmortizedRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+protected:
+	void StartPostProcessPass ();
+
+	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::vector<std::string> GetPostProcessDefines (const RenderSettings& settings) const;
+	PostProcessDefinesKey GetPostProcessDefinesKey (const RenderSettings& settings) const;
+
+	virtual std::size_t GetAmortizationInterval (const RenderSettings& settings) const;
+	virtual bool IsAmortizationInterleaved (const RenderSettings& settings) const;
+	virtual const RenderLightObject* GetAmortizedRenderLightObject (const RenderVolumeCollection* rvc) const;
+
+	std::size_t GetAmortizationFramesCount (const RenderSettings& settings) const;
+
+	void StartAmortization (const RenderSettings& settings, RenderVolumeCollection* rvc);
+	void EndAmortization (RenderVolumeCollection* rvc);
+};
+
+#endif
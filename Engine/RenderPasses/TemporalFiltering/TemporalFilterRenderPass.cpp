@@ -70,7 +70,7 @@ RenderVolumeCollection* TemporalFilterRenderPass::Execute (const RenderScene* re
 
 	_lastViewProjectionMatrix = projectionMatrix * viewMatrix;
 
-	return rvc->Insert (GetPostProcessVolumeName (), GetCurrentPostProcessMapVolume ());
+	return rvc->Insert (_postProcessVolumeHandle, GetCurrentPostProcessMapVolume ());
 }
 
 void TemporalFilterRenderPass::Clear ()
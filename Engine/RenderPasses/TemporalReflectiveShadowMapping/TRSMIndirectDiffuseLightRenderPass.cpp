@@ -42,3 +42,13 @@ FramebufferRenderVolume* TRSMIndirectDiffuseLightRenderPass::CreatePostProcessVo
 
 	return renderVolume;
 }
+
+std::size_t TRSMIndirectDiffuseLightRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.trsm_amortization_interval;
+}
+
+bool TRSMIndirectDiffuseLightRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.trsm_amortization_interleaved;
+}
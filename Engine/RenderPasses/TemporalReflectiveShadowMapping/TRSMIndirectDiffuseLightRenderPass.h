@@ -10,6 +10,9 @@ class ENGINE_API TRSMIndirectDiffuseLightRenderPass : public RSMIndirectDiffuseL
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+
+	std::size_t GetAmortizationInterval (const RenderSettings& settings) const;
+	bool IsAmortizationInterleaved (const RenderSettings& settings) const;
 };
 
 #endif
\ No newline at end of file
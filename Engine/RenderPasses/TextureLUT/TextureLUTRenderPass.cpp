@@ -23,10 +23,10 @@ bool TextureLUTRenderPass::IsAvailable (const RenderScene* renderScene, const Ca
 	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
 {
 	/*
-	 * Check if texture LUT is enabled
+	 * Check if texture LUT is enabled and not fused in post process compositor
 	*/
 
-	return settings.lut_enabled;
+	return settings.lut_enabled && !settings.post_process_compositor_enabled;
 }
 
 std::string TextureLUTRenderPass::GetPostProcessFragmentShaderPath () const
@@ -46,6 +46,24 @@ RenderVolumeCollection* VolumetricLightRenderPass::Execute (const RenderScene* r
 	return rvc;
 }
 
+bool VolumetricLightRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Lights without shadows are drawn by clustered lighting
+	*/
+
+	if (settings.clustered_lighting_enabled == true) {
+		RenderLightObject* renderLightObject = GetRenderLightObject (rvc);
+
+		if (renderLightObject->IsCastingShadows () == false) {
+			return false;
+		}
+	}
+
+	return VolumetricLightRenderPassI::IsAvailable (renderScene, camera, settings, rvc);
+}
+
 bool VolumetricLightRenderPass::IsAvailable (const RenderLightObject*) const
 {
 	/*
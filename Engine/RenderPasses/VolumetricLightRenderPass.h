@@ -15,6 +15,9 @@ public:
 	void Init (const RenderSettings&);
 
 	RenderVolumeCollection* Execute (const RenderScene*, const Camera*, const RenderSettings&, RenderVolumeCollection* );
+
+	bool IsAvailable (const RenderScene*, const Camera*,
+		const RenderSettings& settings, const RenderVolumeCollection*) const;
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
@@ -70,7 +70,7 @@ std::vector<PipelineAttribute> VCTIndirectDiffuseLightRenderPass::GetCustomAttri
 	 * Attach post process volume attributes to pipeline
 	*/
 
-	std::vector<PipelineAttribute> attributes = PostProcessRenderPass::GetCustomAttributes (camera, settings, rvc);
+	std::vector<PipelineAttribute> attributes = AmortizedRenderPass::GetCustomAttributes (camera, settings, rvc);
 
 	/*
 	 * Attach screen space ambient occlusion attributes to pipeline
@@ -98,3 +98,13 @@ std::vector<PipelineAttribute> VCTIndirectDiffuseLightRenderPass::GetCustomAttri
 
 	return attributes;
 }
+
+std::size_t VCTIndirectDiffuseLightRenderPass::GetAmortizationInterval (const RenderSettings& settings) const
+{
+	return settings.vct_amortization_interval;
+}
+
+bool VCTIndirectDiffuseLightRenderPass::IsAmortizationInterleaved (const RenderSettings& settings) const
+{
+	return settings.vct_amortization_interleaved;
+}
@@ -1,9 +1,9 @@
 #ifndef VCTINDIRECTDIFFUSELIGHTRENDERPASS_H
 #define VCTINDIRECTDIFFUSELIGHTRENDERPASS_H
 
-#include "RenderPasses/PostProcess/PostProcessRenderPass.h"
+#include "RenderPasses/TemporalFiltering/AmortizedRenderPass.h"
 
-class ENGINE_API VCTIndirectDiffuseLightRenderPass : public PostProcessRenderPass
+class ENGINE_API VCTIndirectDiffuseLightRenderPass : public AmortizedRenderPass
 {
 	DECLARE_RENDER_PASS(VCTIndirectDiffuseLightRenderPass)
 
@@ -18,6 +18,9 @@ protected:
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	std::size_t GetAmortizationInterval (const RenderSettings& settings) const;
+	bool IsAmortizationInterleaved (const RenderSettings& settings) const;
 };
 
 #endif
\ No newline at end of file
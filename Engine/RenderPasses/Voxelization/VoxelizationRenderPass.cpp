@@ -1,5 +1,7 @@
 #include "VoxelizationRenderPass.h"
 
+#include <algorithm>
+
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
@@ -11,6 +13,26 @@
 
 #include "SceneNodes/SceneLayer.h"
 
+#include "Debug/Statistics/StatisticsManager.h"
+#include "VoxelizationStatisticsObject.h"
+
+/*
+ * Conservative rasterization in the geometry shader may reach the
+ * voxels right outside an object's bounds
+*/
+
+#define VOXELIZATION_REGION_PADDING 1
+
+VoxelizationRenderPass::VoxelizationRenderPass () :
+	_staticVolumeSize (0),
+	_staticMinVertex (0.0f),
+	_staticMaxVertex (0.0f),
+	_revoxelizedObjectsCount (0),
+	_revoxelizedVoxelsCount (0)
+{
+
+}
+
 bool VoxelizationRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
 	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
 {
@@ -53,17 +75,25 @@ RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* rend
 {
 	VoxelVolume* voxelVolume = (VoxelVolume*) rvc->GetRenderVolume ("VoxelVolume");
 
+	_revoxelizedObjectsCount = 0;
+	_revoxelizedVoxelsCount = 0;
+
 	/*
 	* Voxelization start
 	*/
 
-	StartVoxelization (voxelVolume);
+	StartVoxelization (settings, voxelVolume);
 
 	/*
 	* Voxelization: voxelize geomtry
 	*/
 
-	GeometryVoxelizationPass (renderScene, settings, voxelVolume);
+	if (settings.vct_incremental_voxelization == true) {
+		StaticVoxelizationPass (renderScene, settings, voxelVolume);
+		DynamicVoxelizationPass (renderScene, settings, voxelVolume);
+	} else {
+		GeometryVoxelizationPass (renderScene, settings, voxelVolume);
+	}
 
 	/*
 	* Clear opengl state after voxelization
@@ -71,6 +101,12 @@ RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* rend
 
 	EndVoxelization ();
 
+	/*
+	 * Update statistics
+	*/
+
+	UpdateStatistics ();
+
 	/*
 	 * Send back the collection with voxel volume attached
 	*/
@@ -80,21 +116,38 @@ RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* rend
 
 void VoxelizationRenderPass::Clear ()
 {
+	/*
+	 * Release static volume
+	*/
+
+	_staticVolumeView = nullptr;
 
+	_staticObjects.clear ();
 }
 
-void VoxelizationRenderPass::StartVoxelization (VoxelVolume* voxelVolume)
+void VoxelizationRenderPass::StartVoxelization (const RenderSettings& settings, VoxelVolume* voxelVolume)
 {
 	/*
-	 * Clear voxel volume
+	 * Clear voxel volume. Incremental voxelization overwrites it with
+	 * the static volume instead.
 	*/
 
-	voxelVolume->GetFramebufferView ()->Activate ();
+	if (settings.vct_incremental_voxelization == false) {
+		voxelVolume->GetFramebufferView ()->Activate ();
+
+		GL::ClearColor(0, 0, 0, 0);
+		GL::Clear(GL_COLOR_BUFFER_BIT);
 
-	GL::ClearColor(0, 0, 0, 0);
-	GL::Clear(GL_COLOR_BUFFER_BIT);
+		GL::BindFramebuffer (GL_FRAMEBUFFER, 0);
 
-	GL::BindFramebuffer (GL_FRAMEBUFFER, 0);
+		/*
+		 * Release static volume while it is not used
+		*/
+
+		if (_staticVolumeView != nullptr) {
+			Clear ();
+		}
+	}
 
 	/*
 	* Render to window but mask out all color.
@@ -132,31 +185,188 @@ void VoxelizationRenderPass::GeometryVoxelizationPass (const RenderScene* render
 		 * Check if it's active
 		*/
 
-		if (renderObject->IsActive () == false) {
+		if (IsVoxelizable (renderObject) == false) {
+			continue;
+		}
+
+		/*
+		 * Voxelize object
+		*/
+
+		VoxelizeObject (renderObject, voxelVolume);
+	}
+
+	/*
+	 * Whole volume is voxelized again
+	*/
+
+	_revoxelizedVoxelsCount = settings.vct_voxels_size * settings.vct_voxels_size * settings.vct_voxels_size;
+}
+
+void VoxelizationRenderPass::StaticVoxelizationPass (const RenderScene* renderScene,
+	const RenderSettings& settings, VoxelVolume* voxelVolume)
+{
+	/*
+	 * Voxelize everything again when there is no static volume yet or
+	 * when the volume no longer maps to the same part of the scene
+	*/
+
+	bool rebuild = _staticVolumeView == nullptr ||
+		_staticVolumeSize != settings.vct_voxels_size ||
+		_staticMinVertex != voxelVolume->GetMinVertex () ||
+		_staticMaxVertex != voxelVolume->GetMaxVertex ();
+
+	if (rebuild == true) {
+		if (_staticVolumeView == nullptr || _staticVolumeSize != settings.vct_voxels_size) {
+			InitStaticVolume (settings);
+		}
+
+		_staticObjects.clear ();
+
+		_staticMinVertex = voxelVolume->GetMinVertex ();
+		_staticMaxVertex = voxelVolume->GetMaxVertex ();
+	}
+
+	/*
+	 * Find the regions touched by static objects that were added,
+	 * moved or removed since last frame
+	*/
+
+	std::vector<RenderObject*> staticObjects;
+	std::vector<VoxelRegion> dirtyRegions;
+
+	for (auto& staticObject : _staticObjects) {
+		staticObject.second.visited = false;
+	}
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		if (IsVoxelizable (renderObject) == false || IsStatic (renderObject) == false) {
 			continue;
 		}
 
-		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+		staticObjects.push_back (renderObject);
+
+		VoxelRegion region = GetVoxelRegion (renderObject, voxelVolume);
+
+		auto it = _staticObjects.find (renderObject);
+
+		if (it == _staticObjects.end ()) {
+			if (rebuild == false) {
+				dirtyRegions.push_back (region);
+			}
+
+			_staticObjects [renderObject] = StaticObjectState {region, true};
+
 			continue;
 		}
 
-		/*
-		 * Lock voxelization shader for geomtry rendering
-		*/
+		if (it->second.region.minVoxel != region.minVoxel || it->second.region.maxVoxel != region.maxVoxel) {
+			dirtyRegions.push_back (it->second.region);
+			dirtyRegions.push_back (region);
 
-		LockShader (renderObject->GetSceneLayers ());
+			it->second.region = region;
+		}
 
-		/*
-		 * Send voxel volume attributes to pipeline
-		*/
+		it->second.visited = true;
+	}
 
-		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (voxelVolume));
+	for (auto it = _staticObjects.begin (); it != _staticObjects.end ();) {
+		if (it->second.visited == false) {
+			dirtyRegions.push_back (it->second.region);
 
-		/*
-		 * Voxelize object
-		*/
+			it = _staticObjects.erase (it);
+		} else {
+			++ it;
+		}
+	}
+
+	/*
+	 * Clear the static volume where it has to be voxelized again
+	*/
+
+	unsigned int staticTextureID = _staticVolumeView->GetGPUIndex ();
+
+	if (rebuild == true) {
+		GL::ClearTexImage (staticTextureID, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		_revoxelizedVoxelsCount += settings.vct_voxels_size * settings.vct_voxels_size * settings.vct_voxels_size;
+	}
+
+	for (const auto& region : dirtyRegions) {
+		glm::ivec3 size = region.maxVoxel - region.minVoxel;
+
+		GL::ClearTexSubImage (staticTextureID, 0, region.minVoxel.x, region.minVoxel.y, region.minVoxel.z,
+			size.x, size.y, size.z, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		_revoxelizedVoxelsCount += GetVoxelsCount (region);
+	}
+
+	/*
+	 * Voxelize the static objects that overlap cleared regions
+	*/
+
+	if (rebuild == true || dirtyRegions.size () > 0) {
+		GL::Viewport (0, 0, settings.vct_voxels_size, settings.vct_voxels_size);
+
+		GL::BindImageTexture (0, staticTextureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+
+		for (RenderObject* renderObject : staticObjects) {
+			const VoxelRegion& region = _staticObjects [renderObject].region;
+
+			bool overlaps = rebuild;
+
+			for (std::size_t index = 0; overlaps == false && index < dirtyRegions.size (); index ++) {
+				overlaps = glm::all (glm::lessThan (region.minVoxel, dirtyRegions [index].maxVoxel)) &&
+					glm::all (glm::lessThan (dirtyRegions [index].minVoxel, region.maxVoxel));
+			}
+
+			if (overlaps == false) {
+				continue;
+			}
+
+			VoxelizeObject (renderObject, voxelVolume);
+		}
 
-		renderObject->Draw ();
+		GL::MemoryBarrier (GL_ALL_BARRIER_BITS);
+	}
+
+	/*
+	 * Start this frame's voxel volume from the static one
+	*/
+
+	CopyStaticVolume (voxelVolume);
+}
+
+void VoxelizationRenderPass::DynamicVoxelizationPass (const RenderScene* renderScene,
+	const RenderSettings& settings, VoxelVolume* voxelVolume)
+{
+	/*
+	 * Set viewport
+	*/
+
+	GL::Viewport (0, 0, settings.vct_voxels_size, settings.vct_voxels_size);
+
+	/*
+	* Bind voxel volume to geometry render pass
+	*/
+
+	unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex ();
+	GL::BindImageTexture (0, voxelTextureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+
+	/*
+	 * Voxelize dynamic and animated objects over the static volume
+	*/
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		if (IsVoxelizable (renderObject) == false || IsStatic (renderObject) == true) {
+			continue;
+		}
+
+		VoxelizeObject (renderObject, voxelVolume);
+
+		_revoxelizedVoxelsCount += GetVoxelsCount (GetVoxelRegion (renderObject, voxelVolume));
 	}
 }
 
@@ -178,6 +388,126 @@ void VoxelizationRenderPass::EndVoxelization ()
 	Pipeline::UnlockShader ();
 }
 
+void VoxelizationRenderPass::InitStaticVolume (const RenderSettings& settings)
+{
+	/*
+	 * Same layout as the highest resolution of the voxel volume
+	*/
+
+	Resource<Texture> texture = Resource<Texture> (new Texture ("staticVoxelTexture"));
+
+	glm::ivec3 size = glm::ivec3 (settings.vct_voxels_size);
+
+	texture->SetType (TEXTURE_TYPE::TEXTURE_3D);
+	texture->SetSize (Size (size.x, size.y, size.z));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA8);
+	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_UNSIGNED_BYTE);
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetAnisotropicFiltering (false);
+	texture->SetBorderColor (Color::Black);
+
+	_staticVolumeView = RenderSystem::LoadTexture (texture);
+
+	_staticVolumeSize = settings.vct_voxels_size;
+}
+
+void VoxelizationRenderPass::CopyStaticVolume (VoxelVolume* voxelVolume)
+{
+	unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex ();
+
+	GL::CopyImageSubData (_staticVolumeView->GetGPUIndex (), GL_TEXTURE_3D, 0, 0, 0, 0,
+		voxelTextureID, GL_TEXTURE_3D, 0, 0, 0, 0,
+		_staticVolumeSize, _staticVolumeSize, _staticVolumeSize);
+}
+
+void VoxelizationRenderPass::VoxelizeObject (RenderObject* renderObject, VoxelVolume* voxelVolume)
+{
+	/*
+	 * Lock voxelization shader for geomtry rendering
+	*/
+
+	LockShader (renderObject->GetSceneLayers ());
+
+	/*
+	 * Send voxel volume attributes to pipeline
+	*/
+
+	Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (voxelVolume));
+
+	/*
+	 * Voxelize object
+	*/
+
+	renderObject->Draw ();
+
+	_revoxelizedObjectsCount ++;
+}
+
+bool VoxelizationRenderPass::IsVoxelizable (const RenderObject* renderObject) const
+{
+	if (renderObject->IsActive () == false) {
+		return false;
+	}
+
+	if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+		return false;
+	}
+
+	return true;
+}
+
+bool VoxelizationRenderPass::IsStatic (const RenderObject* renderObject) const
+{
+	return (renderObject->GetSceneLayers () & (SceneLayer::DYNAMIC | SceneLayer::ANIMATION)) == 0;
+}
+
+VoxelizationRenderPass::VoxelRegion VoxelizationRenderPass::GetVoxelRegion (const RenderObject* renderObject,
+	VoxelVolume* voxelVolume) const
+{
+	const AABBVolume& boundingBox = renderObject->GetBoundingBox ();
+
+	glm::vec3 volumeMin = voxelVolume->GetMinVertex ();
+	glm::vec3 volumeSize = voxelVolume->GetMaxVertex () - volumeMin;
+
+	float voxelsCount = (float) voxelVolume->GetFramebuffer ()->GetTexture (0)->GetSize ().width;
+
+	/*
+	 * Map world space bounds to a padded voxel range
+	*/
+
+	glm::vec3 minVoxel = (boundingBox.minVertex - volumeMin) / volumeSize * voxelsCount;
+	glm::vec3 maxVoxel = (boundingBox.maxVertex - volumeMin) / volumeSize * voxelsCount;
+
+	VoxelRegion region;
+
+	region.minVoxel = glm::ivec3 (glm::floor (minVoxel)) - VOXELIZATION_REGION_PADDING;
+	region.maxVoxel = glm::ivec3 (glm::ceil (maxVoxel)) + VOXELIZATION_REGION_PADDING;
+
+	region.minVoxel = glm::clamp (region.minVoxel, glm::ivec3 (0), glm::ivec3 ((int) voxelsCount));
+	region.maxVoxel = glm::clamp (region.maxVoxel, region.minVoxel, glm::ivec3 ((int) voxelsCount));
+
+	return region;
+}
+
+std::size_t VoxelizationRenderPass::GetVoxelsCount (const VoxelRegion& region) const
+{
+	glm::ivec3 size = region.maxVoxel - region.minVoxel;
+
+	return (std::size_t) size.x * size.y * size.z;
+}
+
+void VoxelizationRenderPass::UpdateStatistics ()
+{
+	auto voxelizationStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <VoxelizationStatisticsObject> ();
+
+	voxelizationStatisticsObject->RevoxelizedObjectsCount = _revoxelizedObjectsCount;
+	voxelizationStatisticsObject->RevoxelizedVoxelsCount = _revoxelizedVoxelsCount;
+}
+
 void VoxelizationRenderPass::LockShader (int sceneLayers)
 {
 	/*
@@ -5,18 +5,53 @@
 
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/ShaderView.h"
+#include "Renderer/RenderViews/TextureView.h"
+
+#include <map>
 
 #include "VoxelVolume.h"
 
+/*
+ * With incremental voxelization, static objects are voxelized into a
+ * persistent volume that is copied into the voxel volume every frame.
+ * Only the regions touched by static objects that were added, moved or
+ * removed are cleared and voxelized again. Dynamic and animated objects
+ * are voxelized over the copy every frame.
+*/
+
 class VoxelizationRenderPass : public ContainerRenderSubPassI
 {
 	DECLARE_RENDER_PASS(VoxelizationRenderPass)
 
 protected:
+	struct VoxelRegion
+	{
+		glm::ivec3 minVoxel;
+		glm::ivec3 maxVoxel;
+	};
+
+	struct StaticObjectState
+	{
+		VoxelRegion region;
+		bool visited;
+	};
+
 	Resource<ShaderView> _staticShaderView;
 	Resource<ShaderView> _animationShaderView;
 
+	Resource<TextureView> _staticVolumeView;
+	std::map<const RenderObject*, StaticObjectState> _staticObjects;
+
+	std::size_t _staticVolumeSize;
+	glm::vec3 _staticMinVertex;
+	glm::vec3 _staticMaxVertex;
+
+	std::size_t _revoxelizedObjectsCount;
+	std::size_t _revoxelizedVoxelsCount;
+
 public:
+	VoxelizationRenderPass ();
+
 	void Init (const RenderSettings& settings);
 	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
@@ -26,10 +61,24 @@ public:
 
 	void Clear ();
 protected:
-	void StartVoxelization (VoxelVolume* voxelVolume);
+	void StartVoxelization (const RenderSettings& settings, VoxelVolume* voxelVolume);
 	void GeometryVoxelizationPass (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+	void StaticVoxelizationPass (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+	void DynamicVoxelizationPass (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
 	void EndVoxelization ();
 
+	void InitStaticVolume (const RenderSettings& settings);
+	void CopyStaticVolume (VoxelVolume* voxelVolume);
+
+	void VoxelizeObject (RenderObject* renderObject, VoxelVolume* voxelVolume);
+	bool IsVoxelizable (const RenderObject* renderObject) const;
+	bool IsStatic (const RenderObject* renderObject) const;
+
+	VoxelRegion GetVoxelRegion (const RenderObject* renderObject, VoxelVolume* voxelVolume) const;
+	std::size_t GetVoxelsCount (const VoxelRegion& region) const;
+
+	void UpdateStatistics ();
+
 	void LockShader (int sceneLayers);
 
 	std::vector<PipelineAttribute> GetCustomAttributes (VoxelVolume* voxelVolume);
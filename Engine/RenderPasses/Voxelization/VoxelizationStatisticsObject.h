@@ -0,0 +1,14 @@
+#ifndef VOXELIZATIONSTATISTICSOBJECT_H
+#define VOXELIZATIONSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API VoxelizationStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(VoxelizationStatisticsObject)
+
+	std::size_t RevoxelizedObjectsCount;
+	std::size_t RevoxelizedVoxelsCount;
+};
+
+#endif
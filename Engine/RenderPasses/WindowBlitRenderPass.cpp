@@ -49,9 +49,20 @@ void WindowBlitRenderPass::EndDrawing (FramebufferRenderVolume* frameBufferVolum
 
 	frameBufferVolume->GetFramebufferView ()->ActivateSource ();
 
+	/*
+	 * Upscale when rendering below the window resolution
+	*/
+
+	GLenum filter = GL_NEAREST;
+
+	if (settings.viewport.width != settings.window.width ||
+		settings.viewport.height != settings.window.height) {
+		filter = GL_LINEAR;
+	}
+
 	GL::BlitFramebuffer (settings.viewport.x, settings.viewport.y,
 		settings.viewport.width, settings.viewport.height,
-		settings.viewport.x, settings.viewport.y,
-		settings.viewport.width, settings.viewport.height,
-		GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		settings.window.x, settings.window.y,
+		settings.window.width, settings.window.height,
+		GL_COLOR_BUFFER_BIT, filter);
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Frame time is smoothed over a few frames, the scale changes only
+ * after it stays out of the band for a number of frames
+*/
+
+#define DYNAMIC_RESOLUTION_SMOOTHING 0.1f
+#define DYNAMIC_RESOLUTION_UPSCALE_THRESHOLD 0.85f
+#define DYNAMIC_RESOLUTION_DOWNSCALE_THRESHOLD 1.0f
+#define DYNAMIC_RESOLUTION_STABLE_FRAMES 30
+#define DYNAMIC_RESOLUTION_STEP 0.05f
+#define DYNAMIC_RESOLUTION_MAX_STEPS 4
+
+float DynamicResolution::_scale (1.0f);
+float DynamicResolution::_frameTime (0.0f);
+std::size_t DynamicResolution::_stableFrames (0);
+
+void DynamicResolution::Update (RenderSettings& settings, float gpuFrameTime)
+{
+	float scale = 1.0f;
+
+	if (settings.dynamic_resolution_enabled == true) {
+		scale = Evaluate (settings, gpuFrameTime);
+	}
+
+	if (settings.dynamic_resolution_enabled == false) {
+		_scale = 1.0f;
+		_frameTime = 0.0f;
+		_stableFrames = 0;
+	}
+
+	/*
+	 * Render targets follow the scaled resolution, window blit scales
+	 * the result back up to the window
+	*/
+
+	std::size_t width = std::max ((std::size_t) (settings.window.width * scale), (std::size_t) 1);
+	std::size_t height = std::max ((std::size_t) (settings.window.height * scale), (std::size_t) 1);
+
+	settings.resolution.width = width;
+	settings.resolution.height = height;
+
+	settings.viewport.x = 0;
+	settings.viewport.y = 0;
+	settings.viewport.width = width;
+	settings.viewport.height = height;
+}
+
+float DynamicResolution::GetScale ()
+{
+	return _scale;
+}
+
+float DynamicResolution::GetFrameTime ()
+{
+	return _frameTime;
+}
+
+float DynamicResolution::Evaluate (const RenderSettings& settings, float gpuFrameTime)
+{
+	float minScale = std::min (std::max (settings.dynamic_resolution_min_scale, DYNAMIC_RESOLUTION_STEP), 1.0f);
+	float targetTime = settings.dynamic_resolution_target;
+
+	/*
+	 * No timings yet
+	*/
+
+	if (gpuFrameTime <= 0.0f || targetTime <= 0.0f) {
+		return _scale;
+	}
+
+	if (_frameTime == 0.0f) {
+		_frameTime = gpuFrameTime;
+	}
+
+	_frameTime += (gpuFrameTime - _frameTime) * DYNAMIC_RESOLUTION_SMOOTHING;
+
+	bool overBudget = _frameTime > targetTime * DYNAMIC_RESOLUTION_DOWNSCALE_THRESHOLD;
+	bool underBudget = _frameTime < targetTime * DYNAMIC_RESOLUTION_UPSCALE_THRESHOLD;
+
+	if ((overBudget == false || _scale <= minScale) && (underBudget == false || _scale >= 1.0f)) {
+		_stableFrames = 0;
+
+		return _scale;
+	}
+
+	_stableFrames ++;
+
+	if (_stableFrames < DYNAMIC_RESOLUTION_STABLE_FRAMES) {
+		return _scale;
+	}
+
+	/*
+	 * Cost follows the pixel count, the scale moves by the square root
+	 * of the time ratio, in whole steps to bound the target sizes
+	*/
+
+	float idealScale = _scale * std::sqrt (targetTime / _frameTime);
+
+	int steps = (int) std::round ((idealScale - _scale) / DYNAMIC_RESOLUTION_STEP);
+
+	if (steps == 0) {
+		steps = overBudget ? -1 : 1;
+	}
+
+	steps = std::min (std::max (steps, -DYNAMIC_RESOLUTION_MAX_STEPS), DYNAMIC_RESOLUTION_MAX_STEPS);
+
+	_scale = std::min (std::max (_scale + steps * DYNAMIC_RESOLUTION_STEP, minScale), 1.0f);
+
+	/*
+	 * Measured time belongs to the old scale, start over
+	*/
+
+	_frameTime = 0.0f;
+	_stableFrames = 0;
+
+	return _scale;
+}
@@ -0,0 +1,32 @@
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+#include "Core/Interfaces/Object.h"
+
+#include "Renderer/RenderSettings.h"
+
+/*
+ * Scales the internal render resolution to hold a target GPU frame
+ * time. The scale moves in fixed steps and only after the smoothed
+ * frame time stays outside the tolerance band for a while, so render
+ * targets are not reallocated on every frame. Screen space effects
+ * follow since their scales are relative to the render resolution.
+*/
+
+class ENGINE_API DynamicResolution
+{
+private:
+	static float _scale;
+	static float _frameTime;
+	static std::size_t _stableFrames;
+
+public:
+	static void Update (RenderSettings& settings, float gpuFrameTime);
+
+	static float GetScale ();
+	static float GetFrameTime ();
+private:
+	static float Evaluate (const RenderSettings& settings, float gpuFrameTime);
+};
+
+#endif
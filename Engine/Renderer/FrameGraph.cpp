@@ -0,0 +1,302 @@
+#include "FrameGraph.h"
+
+#include <algorithm>
+#include <limits>
+
+#define FRAME_GRAPH_UNTRACKED_PASS std::numeric_limits<std::size_t>::max ()
+
+FrameGraph::FrameGraph () :
+	_compiled (false),
+	_recording (false),
+	_passIndex (0)
+{
+
+}
+
+void FrameGraph::BeginFrame ()
+{
+	_passIndex = 0;
+	_activePasses.clear ();
+
+	/*
+	 * Record the frame again if there is no valid plan
+	*/
+
+	_recording = !_compiled;
+
+	if (_recording == true) {
+		_passes.clear ();
+		_resources.clear ();
+
+		_volumeResources.clear ();
+		_textureResources.clear ();
+	}
+}
+
+void FrameGraph::EndFrame ()
+{
+	if (_recording == true) {
+		Compile ();
+	}
+
+	/*
+	 * Less passes than planned also means the plan is outdated
+	*/
+
+	if (_recording == false && _compiled == true && _passIndex != _passes.size ()) {
+		Invalidate ();
+	}
+
+	_recording = false;
+
+	_pool.EndFrame ();
+}
+
+bool FrameGraph::BeginPass (RenderPassI* renderPass)
+{
+	if (_recording == true) {
+		PassNode passNode;
+
+		passNode.renderPass = renderPass;
+		passNode.culled = false;
+
+		_passes.push_back (passNode);
+
+		_activePasses.push_back (_passIndex ++);
+
+		return true;
+	}
+
+	/*
+	 * A different pass sequence invalidates the plan. The rest of the
+	 * frame is executed without culling and aliasing.
+	*/
+
+	if (_compiled == true && (_passIndex >= _passes.size () || _passes [_passIndex].renderPass != renderPass)) {
+		Invalidate ();
+	}
+
+	if (_compiled == false) {
+		_activePasses.push_back (FRAME_GRAPH_UNTRACKED_PASS);
+
+		return true;
+	}
+
+	if (_passes [_passIndex].culled == true) {
+		_passIndex ++;
+
+		return false;
+	}
+
+	_activePasses.push_back (_passIndex ++);
+
+	return true;
+}
+
+void FrameGraph::EndPass ()
+{
+	std::size_t passIndex = _activePasses.back ();
+
+	_activePasses.pop_back ();
+
+	if (_recording == true || _compiled == false || passIndex == FRAME_GRAPH_UNTRACKED_PASS) {
+		return;
+	}
+
+	/*
+	 * Return the targets whose last reader was this pass
+	*/
+
+	for (FramebufferRenderVolume* volume : _passes [passIndex].releases) {
+		_pool.Release (volume);
+	}
+}
+
+void FrameGraph::AcquireTransient (FramebufferRenderVolume* volume)
+{
+	if (_activePasses.empty () == true) {
+		return;
+	}
+
+	std::size_t passIndex = _activePasses.back ();
+
+	/*
+	 * A target recreated since recording (e.g. after a resolution
+	 * change) is not the one the plan releases
+	*/
+
+	if (_recording == false && _compiled == true) {
+		const auto& writes = _passes [passIndex].writes;
+
+		bool isPlanned = std::any_of (writes.begin (), writes.end (),
+			[&] (std::size_t resourceIndex) { return _resources [resourceIndex].volume == volume; });
+
+		if (isPlanned == false) {
+			Invalidate ();
+		}
+	}
+
+	_pool.Acquire (volume);
+
+	if (_recording == false) {
+		return;
+	}
+
+	/*
+	 * Every write creates a new version of the target
+	*/
+
+	ResourceNode resourceNode;
+
+	resourceNode.volume = volume;
+	resourceNode.writer = passIndex;
+	resourceNode.readersCount = 0;
+
+	_resources.push_back (resourceNode);
+
+	_passes [passIndex].writes.push_back (_resources.size () - 1);
+
+	_volumeResources [volume] = _resources.size () - 1;
+
+	Resource<FramebufferView> framebufferView = volume->GetFramebufferView ();
+
+	for (std::size_t index = 0; index < framebufferView->GetTextureViewCount (); index ++) {
+		_textureResources [framebufferView->GetTextureView (index)->GetGPUIndex ()] = _resources.size () - 1;
+	}
+
+	if (framebufferView->GetDepthTextureView () != nullptr) {
+		_textureResources [framebufferView->GetDepthTextureView ()->GetGPUIndex ()] = _resources.size () - 1;
+	}
+}
+
+void FrameGraph::ReadVolume (const RenderVolumeI* volume)
+{
+	if (_recording == false) {
+		return;
+	}
+
+	auto it = _volumeResources.find (volume);
+
+	if (it != _volumeResources.end ()) {
+		ReadResource (it->second);
+	}
+}
+
+void FrameGraph::ReadTexture (unsigned int gpuIndex)
+{
+	if (_recording == false) {
+		return;
+	}
+
+	auto it = _textureResources.find (gpuIndex);
+
+	if (it != _textureResources.end ()) {
+		ReadResource (it->second);
+	}
+}
+
+void FrameGraph::Clear ()
+{
+	_passes.clear ();
+	_resources.clear ();
+
+	_volumeResources.clear ();
+	_textureResources.clear ();
+
+	_compiled = false;
+
+	_pool.Clear ();
+}
+
+void FrameGraph::Compile ()
+{
+	/*
+	 * Cull transient passes whose targets are never read, walking
+	 * backwards so culling propagates to the passes feeding them
+	*/
+
+	for (auto& passNode : _passes) {
+		for (std::size_t resourceIndex : passNode.reads) {
+			_resources [resourceIndex].readersCount ++;
+		}
+	}
+
+	for (std::size_t passIndex = _passes.size (); passIndex > 0; passIndex --) {
+		PassNode& passNode = _passes [passIndex - 1];
+
+		if (passNode.writes.empty () == true) {
+			continue;
+		}
+
+		passNode.culled = std::all_of (passNode.writes.begin (), passNode.writes.end (),
+			[&] (std::size_t resourceIndex) { return _resources [resourceIndex].readersCount == 0; });
+
+		if (passNode.culled == false) {
+			continue;
+		}
+
+		for (std::size_t resourceIndex : passNode.reads) {
+			_resources [resourceIndex].readersCount --;
+		}
+	}
+
+	/*
+	 * Release every target after its last executed reader
+	*/
+
+	std::vector<std::size_t> lastReaders (_resources.size ());
+
+	for (std::size_t resourceIndex = 0; resourceIndex < _resources.size (); resourceIndex ++) {
+		lastReaders [resourceIndex] = _resources [resourceIndex].writer;
+	}
+
+	for (std::size_t passIndex = 0; passIndex < _passes.size (); passIndex ++) {
+		if (_passes [passIndex].culled == true) {
+			continue;
+		}
+
+		for (std::size_t resourceIndex : _passes [passIndex].reads) {
+			lastReaders [resourceIndex] = passIndex;
+		}
+	}
+
+	for (std::size_t resourceIndex = 0; resourceIndex < _resources.size (); resourceIndex ++) {
+		const ResourceNode& resourceNode = _resources [resourceIndex];
+
+		if (_passes [resourceNode.writer].culled == true) {
+			continue;
+		}
+
+		_passes [lastReaders [resourceIndex]].releases.push_back (resourceNode.volume);
+	}
+
+	_compiled = true;
+}
+
+void FrameGraph::Invalidate ()
+{
+	_compiled = false;
+}
+
+void FrameGraph::ReadResource (std::size_t resourceIndex)
+{
+	if (_activePasses.empty () == true) {
+		return;
+	}
+
+	std::size_t passIndex = _activePasses.back ();
+
+	/*
+	 * Passes sampling their own target do not depend on themselves
+	*/
+
+	if (_resources [resourceIndex].writer == passIndex) {
+		return;
+	}
+
+	auto& reads = _passes [passIndex].reads;
+
+	if (std::find (reads.begin (), reads.end (), resourceIndex) == reads.end ()) {
+		reads.push_back (resourceIndex);
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef FRAMEGRAPH_H
+#define FRAMEGRAPH_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <map>
+#include <vector>
+
+#include "RenderPassI.h"
+#include "TransientFramebufferPool.h"
+
+/*
+ * Dependency graph of the passes executed in a frame. Passes declare
+ * their transient render targets through AcquireTransient, while reads
+ * are collected from volume lookups and from every texture bound for
+ * reading through Pipeline: attributes sampled by the bound shader,
+ * texture views activated directly, blit sources and images bound for
+ * loading. Reads made with raw GL calls must be declared by the pass
+ * with ReadVolume or ReadTexture. Passes bind their inputs by walking
+ * the volume collection, so the graph is recorded over one frame and
+ * compiled at its end; the plan is then replayed for as long as the
+ * same passes execute in the same order. A compiled plan culls
+ * transient passes nobody reads and returns their targets to the pool
+ * right after the last reader, so targets with disjoint lifetimes
+ * share memory.
+*/
+
+class ENGINE_API FrameGraph : public Object
+{
+protected:
+	struct PassNode
+	{
+		RenderPassI* renderPass;
+		std::vector<std::size_t> reads;
+		std::vector<std::size_t> writes;
+		std::vector<FramebufferRenderVolume*> releases;
+		bool culled;
+	};
+
+	struct ResourceNode
+	{
+		FramebufferRenderVolume* volume;
+		std::size_t writer;
+		std::size_t readersCount;
+	};
+
+	std::vector<PassNode> _passes;
+	std::vector<ResourceNode> _resources;
+
+	bool _compiled;
+	bool _recording;
+
+	std::size_t _passIndex;
+	std::vector<std::size_t> _activePasses;
+
+	std::map<const RenderVolumeI*, std::size_t> _volumeResources;
+	std::map<unsigned int, std::size_t> _textureResources;
+
+	TransientFramebufferPool _pool;
+
+public:
+	FrameGraph ();
+
+	void BeginFrame ();
+	void EndFrame ();
+
+	bool BeginPass (RenderPassI* renderPass);
+	void EndPass ();
+
+	void AcquireTransient (FramebufferRenderVolume* volume);
+
+	void ReadVolume (const RenderVolumeI* volume);
+	void ReadTexture (unsigned int gpuIndex);
+
+	void Invalidate ();
+
+	void Clear ();
+protected:
+	void Compile ();
+
+	void ReadResource (std::size_t resourceIndex);
+};
+
+#endif
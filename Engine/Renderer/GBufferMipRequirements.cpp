@@ -0,0 +1,43 @@
+#include "GBufferMipRequirements.h"
+
+#include <algorithm>
+#include <cmath>
+
+GBufferMipRequirements::GBufferMipRequirements ()
+{
+	Reset ();
+}
+
+void GBufferMipRequirements::Reset ()
+{
+	std::fill (_levels, _levels + GBUFFER_MIP_TEXTURES_COUNT, 0);
+}
+
+void GBufferMipRequirements::Require (GBUFFER_MIP_TEXTURE texture, std::size_t levels)
+{
+	_levels [texture] = std::max (_levels [texture], std::min (levels, (std::size_t) GBUFFER_MIP_MAX_LEVELS));
+}
+
+void GBufferMipRequirements::RequireScale (GBUFFER_MIP_TEXTURE texture, float scale)
+{
+	/*
+	 * Passes drawn at a fraction of the resolution sample the level
+	 * log2 (1 / scale), rounded to the nearest one by the sampler
+	*/
+
+	if (scale <= 0.0f || scale >= 1.0f) {
+		return;
+	}
+
+	Require (texture, (std::size_t) std::ceil (std::log2 (1.0f / scale)));
+}
+
+std::size_t GBufferMipRequirements::GetLevels (GBUFFER_MIP_TEXTURE texture) const
+{
+	return _levels [texture];
+}
+
+const std::vector<PipelineAttribute>& GBufferMipRequirements::GetCustomAttributes () const
+{
+	return _attributes;
+}
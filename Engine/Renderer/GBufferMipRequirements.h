@@ -0,0 +1,45 @@
+#ifndef GBUFFERMIPREQUIREMENTS_H
+#define GBUFFERMIPREQUIREMENTS_H
+
+#include "RenderVolumeI.h"
+
+/*
+ * Deepest GBuffer mip level generated, limited by the levels a single
+ * downsample dispatch reduces in shared memory
+*/
+
+#define GBUFFER_MIP_MAX_LEVELS 4
+
+enum GBUFFER_MIP_TEXTURE
+{
+	GBUFFER_MIP_NORMAL = 0,
+	GBUFFER_MIP_POSITION,
+	GBUFFER_MIP_TEXTURES_COUNT
+};
+
+/*
+ * GBuffer mip levels sampled by the passes of a render module. Passes
+ * declare them before the frame is drawn, so the geometry pass only
+ * downsamples the textures and levels that are actually read.
+*/
+
+class ENGINE_API GBufferMipRequirements : public RenderVolumeI
+{
+protected:
+	std::size_t _levels [GBUFFER_MIP_TEXTURES_COUNT];
+	std::vector<PipelineAttribute> _attributes;
+
+public:
+	GBufferMipRequirements ();
+
+	void Reset ();
+
+	void Require (GBUFFER_MIP_TEXTURE texture, std::size_t levels);
+	void RequireScale (GBUFFER_MIP_TEXTURE texture, float scale);
+
+	std::size_t GetLevels (GBUFFER_MIP_TEXTURE texture) const;
+
+	const std::vector<PipelineAttribute>& GetCustomAttributes () const;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "LevelOfDetailSelection.h"
+
+#include <limits>
+#include <glm/gtc/matrix_transform.hpp>
+
+std::size_t LevelOfDetailSelection::Select (const RenderObject* renderObject, const Camera* camera, const RenderSettings& settings)
+{
+	if (settings.lod_enabled == false) {
+		return 0;
+	}
+
+	std::size_t levelsOfDetailCount = renderObject->GetModelView ()->GetLevelsOfDetailCount ();
+
+	if (levelsOfDetailCount == 1) {
+		return 0;
+	}
+
+	float screenSize = GetScreenSize (renderObject->GetBoundingBox (), camera);
+
+	float thresholds [MAX_LEVELS_OF_DETAIL - 1] = {
+		settings.lod_threshold_1,
+		settings.lod_threshold_2,
+		settings.lod_threshold_3
+	};
+
+	/*
+	 * Go down one level for every threshold the object is smaller than
+	*/
+
+	std::size_t levelOfDetail = 0;
+
+	while (levelOfDetail + 1 < levelsOfDetailCount && screenSize < thresholds [levelOfDetail]) {
+		levelOfDetail ++;
+	}
+
+	return levelOfDetail;
+}
+
+float LevelOfDetailSelection::GetScreenSize (const AABBVolume& boundingBox, const Camera* camera)
+{
+	glm::vec3 center = (boundingBox.minVertex + boundingBox.maxVertex) * 0.5f;
+	float radius = glm::length (boundingBox.maxVertex - boundingBox.minVertex) * 0.5f;
+
+	glm::mat4 viewMatrix = glm::mat4_cast (camera->GetRotation ());
+	viewMatrix = glm::translate (viewMatrix, camera->GetPosition () * -1.0f);
+
+	glm::mat4 projectionMatrix = camera->GetProjectionMatrix ();
+
+	glm::vec4 clipPos = projectionMatrix * viewMatrix * glm::vec4 (center, 1.0f);
+
+	/*
+	 * Camera is inside or behind the bounding sphere
+	*/
+
+	if (clipPos.w <= radius * projectionMatrix [2][3] * -1.0f) {
+		return std::numeric_limits<float>::infinity ();
+	}
+
+	return radius * projectionMatrix [1][1] / clipPos.w;
+}
@@ -0,0 +1,20 @@
+#ifndef LEVELOFDETAILSELECTION_H
+#define LEVELOFDETAILSELECTION_H
+
+#include "Renderer/RenderObject.h"
+#include "Renderer/RenderSettings.h"
+#include "Systems/Camera/Camera.h"
+
+/*
+ * Select model level of detail by the bounding sphere size projected
+ * on screen, as a fraction of the screen height.
+*/
+
+class ENGINE_API LevelOfDetailSelection
+{
+public:
+	static std::size_t Select (const RenderObject* renderObject, const Camera* camera, const RenderSettings& settings);
+	static float GetScreenSize (const AABBVolume& boundingBox, const Camera* camera);
+};
+
+#endif
@@ -0,0 +1,188 @@
+#include "MultiViewCulling.h"
+
+#include <cmath>
+#include <glm/geometric.hpp>
+
+#include "Core/Intersections/Intersection.h"
+
+#include "Renderer/RenderWorkers.h"
+
+#define MULTI_VIEW_CULLING_OBJECTS_PER_TASK 128
+
+MultiViewCulling::MultiViewCulling () :
+	_frustums (),
+	_viewsBoundingBox (),
+	_viewsBounded (true),
+	_visibleObjects ()
+{
+
+}
+
+void MultiViewCulling::Reset ()
+{
+	_frustums.clear ();
+
+	_viewsBoundingBox = AABBVolume ();
+	_viewsBounded = true;
+
+	/*
+	 * Keep visible lists allocated between frames
+	*/
+
+	for (auto& visibleObjects : _visibleObjects) {
+		visibleObjects.clear ();
+	}
+}
+
+std::size_t MultiViewCulling::AttachView (const FrustumVolume& frustum)
+{
+	_frustums.push_back (frustum);
+
+	ExtendViewsBoundingBox (frustum);
+
+	if (_visibleObjects.size () < _frustums.size ()) {
+		_visibleObjects.resize (_frustums.size ());
+	}
+
+	return _frustums.size () - 1;
+}
+
+void MultiViewCulling::Execute (const RenderScene* renderScene, RenderStage renderStage)
+{
+	for (std::size_t viewIndex = 0; viewIndex < _frustums.size (); viewIndex ++) {
+		_visibleObjects [viewIndex].clear ();
+	}
+
+	/*
+	 * Nothing to test if no view is attached
+	*/
+
+	if (_frustums.empty ()) {
+		return;
+	}
+
+	/*
+	 * Walk the scene once, the frustum tests are split between
+	 * render workers
+	*/
+
+	_renderObjects.clear ();
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		/*
+		 * Check if it's active
+		*/
+
+		if (renderObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderObject->GetRenderStage () != renderStage) {
+			continue;
+		}
+
+		_renderObjects.push_back (renderObject);
+	}
+
+	std::size_t tasksCount = RenderWorkers::GetTasksCount (_renderObjects.size (), MULTI_VIEW_CULLING_OBJECTS_PER_TASK);
+
+	if (_taskVisibleObjects.size () < tasksCount) {
+		_taskVisibleObjects.resize (tasksCount);
+	}
+
+	Intersection* intersection = Intersection::Instance ();
+
+	RenderWorkers::Execute (tasksCount, [&] (std::size_t taskIndex) {
+		std::size_t begin = _renderObjects.size () * taskIndex / tasksCount;
+		std::size_t end = _renderObjects.size () * (taskIndex + 1) / tasksCount;
+
+		auto& visibleObjects = _taskVisibleObjects [taskIndex];
+
+		visibleObjects.resize (_frustums.size ());
+
+		for (auto& objects : visibleObjects) {
+			objects.clear ();
+		}
+
+		/*
+		 * Culling Check against the bounds of all views first, then
+		 * against every view
+		*/
+
+		for (std::size_t index = begin; index < end; index ++) {
+			auto& boundingBox = _renderObjects [index]->GetBoundingBox ();
+
+			if (_viewsBounded == true && !intersection->CheckAABBVsAABB (_viewsBoundingBox, boundingBox)) {
+				continue;
+			}
+
+			for (std::size_t viewIndex = 0; viewIndex < _frustums.size (); viewIndex ++) {
+				if (!intersection->CheckFrustumVsAABB (_frustums [viewIndex], boundingBox)) {
+					continue;
+				}
+
+				visibleObjects [viewIndex].push_back (_renderObjects [index]);
+			}
+		}
+	});
+
+	/*
+	 * Merge in task order to keep the scene order
+	*/
+
+	for (std::size_t taskIndex = 0; taskIndex < tasksCount; taskIndex ++) {
+		for (std::size_t viewIndex = 0; viewIndex < _frustums.size (); viewIndex ++) {
+			auto& objects = _taskVisibleObjects [taskIndex][viewIndex];
+
+			_visibleObjects [viewIndex].insert (_visibleObjects [viewIndex].end (), objects.begin (), objects.end ());
+		}
+	}
+}
+
+const std::vector<RenderObject*>& MultiViewCulling::GetVisibleObjects (std::size_t viewIndex) const
+{
+	return _visibleObjects [viewIndex];
+}
+
+std::size_t MultiViewCulling::GetViewsCount () const
+{
+	return _frustums.size ();
+}
+
+void MultiViewCulling::ExtendViewsBoundingBox (const FrustumVolume& frustum)
+{
+	/*
+	 * Frustum corners are where a left or right, a bottom or top and a
+	 * near or far plane meet
+	*/
+
+	for (std::size_t x = 0; x < 2; x ++) {
+		for (std::size_t y = 2; y < 4; y ++) {
+			for (std::size_t z = 4; z < 6; z ++) {
+				glm::vec3 normal1 = glm::vec3 (frustum.plane [x]);
+				glm::vec3 normal2 = glm::vec3 (frustum.plane [y]);
+				glm::vec3 normal3 = glm::vec3 (frustum.plane [z]);
+
+				float denominator = glm::dot (normal1, glm::cross (normal2, normal3));
+
+				glm::vec3 corner = -(frustum.plane [x].w * glm::cross (normal2, normal3) +
+					frustum.plane [y].w * glm::cross (normal3, normal1) +
+					frustum.plane [z].w * glm::cross (normal1, normal2)) / denominator;
+
+				/*
+				 * Views without a finite volume, such as an infinite far
+				 * plane, are only tested on their own
+				*/
+
+				if (!std::isfinite (corner.x) || !std::isfinite (corner.y) || !std::isfinite (corner.z)) {
+					_viewsBounded = false;
+					return;
+				}
+
+				_viewsBoundingBox.minVertex = glm::min (_viewsBoundingBox.minVertex, corner);
+				_viewsBoundingBox.maxVertex = glm::max (_viewsBoundingBox.maxVertex, corner);
+			}
+		}
+	}
+}
@@ -0,0 +1,46 @@
+#ifndef MULTIVIEWCULLING_H
+#define MULTIVIEWCULLING_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+
+#include "Renderer/RenderScene.h"
+#include "Core/Intersections/FrustumVolume.h"
+#include "Core/Intersections/AABBVolume.h"
+
+/*
+ * Cull the render objects of a scene against several views at once.
+ * The scene is walked a single time and every candidate is first tested
+ * against the bounds enclosing all attached frustums. Only candidates
+ * inside them are tested against every view, producing one visible list
+ * per view.
+*/
+
+class ENGINE_API MultiViewCulling : public Object
+{
+protected:
+	std::vector<FrustumVolume> _frustums;
+	AABBVolume _viewsBoundingBox;
+	bool _viewsBounded;
+	std::vector<std::vector<RenderObject*>> _visibleObjects;
+
+	std::vector<RenderObject*> _renderObjects;
+	std::vector<std::vector<std::vector<RenderObject*>>> _taskVisibleObjects;
+
+public:
+	MultiViewCulling ();
+
+	void Reset ();
+
+	std::size_t AttachView (const FrustumVolume& frustum);
+
+	void Execute (const RenderScene* renderScene, RenderStage renderStage);
+
+	const std::vector<RenderObject*>& GetVisibleObjects (std::size_t viewIndex) const;
+	std::size_t GetViewsCount () const;
+protected:
+	void ExtendViewsBoundingBox (const FrustumVolume& frustum);
+};
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef OCCLUDERMESH_H
+#define OCCLUDERMESH_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+#include <glm/vec3.hpp>
+
+/*
+ * Position only triangle list of a model, kept on CPU
+ * to be rasterized by software occlusion culling
+*/
+
+struct OccluderMesh : public Object
+{
+	std::vector<glm::vec3> vertices;
+	std::vector<unsigned int> indices;
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include "PersistentRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "UploadStatisticsObject.h"
+
+#include "Core/Console/Console.h"
+
+#define PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT 16
+
+unsigned int PersistentRingBuffer::_buffer (0);
+unsigned char* PersistentRingBuffer::_mappedData (nullptr);
+
+std::size_t PersistentRingBuffer::_regionSize (0);
+std::size_t PersistentRingBuffer::_regionIndex (0);
+std::size_t PersistentRingBuffer::_regionOffset (0);
+
+GLsync PersistentRingBuffer::_fences [PERSISTENT_RING_BUFFER_REGIONS] = { nullptr };
+
+std::size_t PersistentRingBuffer::_uniformAlignment (PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT);
+std::size_t PersistentRingBuffer::_storageAlignment (PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT);
+
+std::size_t PersistentRingBuffer::_uploadedBytesCount (0);
+std::size_t PersistentRingBuffer::_stallsCount (0);
+std::size_t PersistentRingBuffer::_overflowsCount (0);
+
+void PersistentRingBuffer::Init ()
+{
+	/*
+	 * Without buffer storage every allocation fails and callers keep
+	 * uploading through their own buffers
+	*/
+
+	if (!GLEW_ARB_buffer_storage) {
+		Console::LogWarning ("Persistent mapped buffers are not supported, dynamic uploads will not use the ring buffer");
+		return;
+	}
+
+	_regionSize = (std::size_t) SettingsManager::Instance ()->GetValue<int> ("upload_buffer_size", 8) * 1024 * 1024;
+
+	/*
+	 * Offset alignments required when binding buffer ranges
+	*/
+
+	GLint alignment = 0;
+
+	GL::GetIntegerv (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	_uniformAlignment = (std::size_t) std::max (alignment, (GLint) PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT);
+
+	GL::GetIntegerv (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	_storageAlignment = (std::size_t) std::max (alignment, (GLint) PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT);
+
+	/*
+	 * Create immutable storage and keep it mapped for the whole run
+	*/
+
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	GL::GenBuffers (1, &_buffer);
+	GL::BindBuffer (GL_COPY_WRITE_BUFFER, _buffer);
+	GL::BufferStorage (GL_COPY_WRITE_BUFFER, _regionSize * PERSISTENT_RING_BUFFER_REGIONS, nullptr, flags);
+
+	_mappedData = (unsigned char*) GL::MapBufferRange (GL_COPY_WRITE_BUFFER, 0,
+		_regionSize * PERSISTENT_RING_BUFFER_REGIONS, flags);
+
+	GL::BindBuffer (GL_COPY_WRITE_BUFFER, 0);
+}
+
+void PersistentRingBuffer::Clear ()
+{
+	for (std::size_t index = 0; index < PERSISTENT_RING_BUFFER_REGIONS; index ++) {
+		if (_fences [index] != nullptr) {
+			GL::DeleteSync (_fences [index]);
+			_fences [index] = nullptr;
+		}
+	}
+
+	if (_buffer != 0) {
+		GL::BindBuffer (GL_COPY_WRITE_BUFFER, _buffer);
+		GL::UnmapBuffer (GL_COPY_WRITE_BUFFER);
+		GL::BindBuffer (GL_COPY_WRITE_BUFFER, 0);
+
+		GL::DeleteBuffers (1, &_buffer);
+	}
+
+	_buffer = 0;
+	_mappedData = nullptr;
+}
+
+void PersistentRingBuffer::BeginFrame ()
+{
+	/*
+	 * Publish statistics of the last frame
+	*/
+
+	auto uploadStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <UploadStatisticsObject> ();
+
+	uploadStatisticsObject->UploadedBytesCount = _uploadedBytesCount;
+	uploadStatisticsObject->StallsCount = _stallsCount;
+	uploadStatisticsObject->OverflowsCount = _overflowsCount;
+
+	_uploadedBytesCount = _stallsCount = _overflowsCount = 0;
+
+	if (_mappedData == nullptr) {
+		return;
+	}
+
+	/*
+	 * Move to the next region and wait for the GPU to be done with it
+	*/
+
+	_regionIndex = (_regionIndex + 1) % PERSISTENT_RING_BUFFER_REGIONS;
+	_regionOffset = 0;
+
+	GLsync& fence = _fences [_regionIndex];
+
+	if (fence == nullptr) {
+		return;
+	}
+
+	GLenum status = GL::ClientWaitSync (fence, 0, 0);
+
+	if (status == GL_TIMEOUT_EXPIRED) {
+		_stallsCount ++;
+
+		while (status == GL_TIMEOUT_EXPIRED) {
+			status = GL::ClientWaitSync (fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		}
+	}
+
+	GL::DeleteSync (fence);
+
+	fence = nullptr;
+}
+
+void PersistentRingBuffer::EndFrame ()
+{
+	if (_mappedData == nullptr) {
+		return;
+	}
+
+	/*
+	 * Mark the end of the GPU commands reading the current region
+	*/
+
+	_fences [_regionIndex] = GL::FenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+bool PersistentRingBuffer::Allocate (GLenum target, std::size_t size, RingBufferAllocation& allocation)
+{
+	if (_mappedData == nullptr) {
+		return false;
+	}
+
+	std::size_t alignment = GetAlignment (target);
+	std::size_t offset = (_regionOffset + alignment - 1) / alignment * alignment;
+
+	/*
+	 * Region is full, caller has to upload on its own this frame
+	*/
+
+	if (offset + size > _regionSize) {
+		_overflowsCount ++;
+
+		return false;
+	}
+
+	_regionOffset = offset + size;
+
+	allocation.buffer = _buffer;
+	allocation.offset = _regionIndex * _regionSize + offset;
+	allocation.size = size;
+	allocation.data = _mappedData + allocation.offset;
+
+	_uploadedBytesCount += size;
+
+	return true;
+}
+
+bool PersistentRingBuffer::Upload (GLenum target, const void* data, std::size_t size, RingBufferAllocation& allocation)
+{
+	if (Allocate (target, size, allocation) == false) {
+		return false;
+	}
+
+	std::memcpy (allocation.data, data, size);
+
+	return true;
+}
+
+std::size_t PersistentRingBuffer::GetAlignment (GLenum target)
+{
+	switch (target) {
+		case GL_UNIFORM_BUFFER:
+			return _uniformAlignment;
+		case GL_SHADER_STORAGE_BUFFER:
+			return _storageAlignment;
+	}
+
+	return PERSISTENT_RING_BUFFER_DEFAULT_ALIGNMENT;
+}
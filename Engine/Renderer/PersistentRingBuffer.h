@@ -0,0 +1,61 @@
+#ifndef PERSISTENTRINGBUFFER_H
+#define PERSISTENTRINGBUFFER_H
+
+#include "Core/Interfaces/Object.h"
+
+#include "Wrappers/OpenGL/GL.h"
+
+#define PERSISTENT_RING_BUFFER_REGIONS 3
+
+/*
+ * Range of the ring buffer written by the CPU this frame
+*/
+
+struct RingBufferAllocation
+{
+	unsigned int buffer;
+	std::size_t offset;
+	std::size_t size;
+	unsigned char* data;
+};
+
+/*
+ * Persistently mapped buffer for data uploaded every frame. It is split
+ * in one region per frame in flight; a region is reused only after the
+ * fence of the frame that last wrote it is signaled, so writes never
+ * wait for the driver to copy or orphan the buffer.
+*/
+
+class ENGINE_API PersistentRingBuffer
+{
+private:
+	static unsigned int _buffer;
+	static unsigned char* _mappedData;
+
+	static std::size_t _regionSize;
+	static std::size_t _regionIndex;
+	static std::size_t _regionOffset;
+
+	static GLsync _fences [PERSISTENT_RING_BUFFER_REGIONS];
+
+	static std::size_t _uniformAlignment;
+	static std::size_t _storageAlignment;
+
+	static std::size_t _uploadedBytesCount;
+	static std::size_t _stallsCount;
+	static std::size_t _overflowsCount;
+
+public:
+	static void Init ();
+	static void Clear ();
+
+	static void BeginFrame ();
+	static void EndFrame ();
+
+	static bool Allocate (GLenum target, std::size_t size, RingBufferAllocation& allocation);
+	static bool Upload (GLenum target, const void* data, std::size_t size, RingBufferAllocation& allocation);
+private:
+	static std::size_t GetAlignment (GLenum target);
+};
+
+#endif
@@ -16,10 +16,13 @@
 #include "PipelineAttribute.h"
 
 #include "Renderer/RenderSystem.h"
+#include "Renderer/FrameGraph.h"
+#include "Renderer/ShaderCompiler.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
 glm::mat4 Pipeline::_modelMatrix (0);
+glm::mat4 Pipeline::_dequantizationMatrix (1.0);
 glm::mat4 Pipeline::_viewMatrix (0);
 glm::mat4 Pipeline::_projectionMatrix (0);
 const Camera* Pipeline::_currentCamera (nullptr);
@@ -30,6 +33,8 @@ Resource<ShaderView> Pipeline::_lockedShaderView (nullptr);
 Resource<MaterialView> Pipeline::_defaultMaterialView (nullptr);
 Resource<TextureView> Pipeline::_defaultTextureView (nullptr);
 
+FrameGraph* Pipeline::_frameGraph (nullptr);
+
 void Pipeline::Init ()
 {
 	/*
@@ -69,6 +74,12 @@ void Pipeline::SetShader (const Resource<ShaderView>& shaderView)
 
 	_textureCount = 0;
 
+	/*
+	 * Program may still be compiled by the driver
+	*/
+
+	ShaderCompiler::Complete (shaderView->GetProgram ());
+
 	GL::UseProgram (shaderView->GetProgram ());
 }
 
@@ -117,11 +128,49 @@ void Pipeline::SendCamera (const Camera* camera)
 void Pipeline::SetObjectTransform (const Transform* transform)
 {
 	_modelMatrix = transform->GetModelMatrix ();
+	_dequantizationMatrix = glm::mat4 (1.0);
+}
+
+void Pipeline::SetObjectDequantization (const glm::mat4& dequantizationMatrix)
+{
+	_dequantizationMatrix = dequantizationMatrix;
 }
 
 void Pipeline::ClearObjectTransform ()
 {
 	_modelMatrix = glm::mat4 (1.0);
+	_dequantizationMatrix = glm::mat4 (1.0);
+}
+
+void Pipeline::SetFrameGraph (FrameGraph* frameGraph)
+{
+	_frameGraph = frameGraph;
+}
+
+void Pipeline::ReadTexture (unsigned int gpuIndex)
+{
+	/*
+	 * Every texture a pass binds for reading is reported, so the frame
+	 * graph never returns a target to the pool before its last reader
+	*/
+
+	if (_frameGraph != nullptr) {
+		_frameGraph->ReadTexture (gpuIndex);
+	}
+}
+
+void Pipeline::BindImageTexture (unsigned int unit, unsigned int gpuIndex, int level,
+	bool layered, int layer, unsigned int access, unsigned int format)
+{
+	/*
+	 * Images bound for loading are read like sampled textures
+	*/
+
+	if (access != GL_WRITE_ONLY) {
+		ReadTexture (gpuIndex);
+	}
+
+	GL::BindImageTexture (unit, gpuIndex, level, layered ? GL_TRUE : GL_FALSE, layer, access, format);
 }
 
 void Pipeline::UpdateMatrices (const Resource<ShaderView>& shaderView)
@@ -132,18 +181,25 @@ void Pipeline::UpdateMatrices (const Resource<ShaderView>& shaderView)
 		currentShaderView = _lockedShaderView;
 	}
 
-	glm::mat4 modelViewMatrix = _viewMatrix * _modelMatrix;
+	/*
+	 * Quantized positions are expanded by the position matrices only,
+	 * normals keep using the object transform
+	*/
+
+	glm::mat4 modelMatrix = _modelMatrix * _dequantizationMatrix;
+
+	glm::mat4 modelViewMatrix = _viewMatrix * modelMatrix;
 	glm::mat4 viewProjectionMatrix = _projectionMatrix * _viewMatrix;
-	glm::mat4 modelViewProjectionMatrix = _projectionMatrix * _viewMatrix * _modelMatrix;
+	glm::mat4 modelViewProjectionMatrix = _projectionMatrix * _viewMatrix * modelMatrix;
 
-	glm::mat3 normalWorldMatrix = glm::transpose (glm::inverse (glm::mat3 (modelViewMatrix)));
+	glm::mat3 normalWorldMatrix = glm::transpose (glm::inverse (glm::mat3 (_viewMatrix * _modelMatrix)));
 	glm::mat3 normalMatrix = glm::transpose (glm::inverse (glm::mat3 (_modelMatrix)));
 
 	glm::mat4 inverseViewMatrix = glm::inverse (_viewMatrix);
 	glm::mat4 inverseViewProjectionMatrix = glm::inverse (modelViewProjectionMatrix);
 	glm::mat3 inverseNormalWorldMatrix = glm::inverse (normalWorldMatrix);
 
-	GL::UniformMatrix4fv (currentShaderView->GetUniformLocation ("modelMatrix"), 1, GL_FALSE, glm::value_ptr (_modelMatrix));
+	GL::UniformMatrix4fv (currentShaderView->GetUniformLocation ("modelMatrix"), 1, GL_FALSE, glm::value_ptr (modelMatrix));
 	GL::UniformMatrix4fv (currentShaderView->GetUniformLocation ("viewMatrix"), 1, GL_FALSE, glm::value_ptr (_viewMatrix));
 	GL::UniformMatrix4fv (currentShaderView->GetUniformLocation ("modelViewMatrix"), 1, GL_FALSE, glm::value_ptr (modelViewMatrix));
 	GL::UniformMatrix4fv (currentShaderView->GetUniformLocation ("projectionMatrix"), 1, GL_FALSE, glm::value_ptr (_projectionMatrix));
@@ -299,6 +355,16 @@ void Pipeline::SendCustomAttributes (const Resource<ShaderView>& shaderView, con
 
 		int unifLoc = currentShaderView->GetUniformLocation (attr [i].name.c_str ());
 
+		/*
+		 * Report the textures actually sampled by the shader
+		*/
+
+		if (unifLoc != -1 &&
+			attr [i].type >= PipelineAttribute::ATTR_TEXTURE_2D &&
+			attr [i].type <= PipelineAttribute::ATTR_TEXTURE_VIEW_DEPTH) {
+			ReadTexture ((unsigned int) attr [i].value.x);
+		}
+
 		switch (attr [i].type) {
 			case PipelineAttribute::ATTR_1I :
 				GL::Uniform1i (unifLoc, (int) attr [i].value.x);
@@ -365,6 +431,19 @@ void Pipeline::SendCustomAttributes (const Resource<ShaderView>& shaderView, con
 					GL::BindBufferBase (GL_UNIFORM_BUFFER, 0, (unsigned int) attr [i].value.x);
 				}
 				break;
+			case PipelineAttribute::ATTR_STORAGE_BLOCK :
+				/*
+				 * Binding point is fixed by the shader layout
+				*/
+
+				if (attr [i].size == 0) {
+					GL::BindBufferBase (GL_SHADER_STORAGE_BUFFER, (unsigned int) attr [i].value.y, (unsigned int) attr [i].value.x);
+					break;
+				}
+
+				GL::BindBufferRange (GL_SHADER_STORAGE_BUFFER, (unsigned int) attr [i].value.y,
+					(unsigned int) attr [i].value.x, attr [i].offset, attr [i].size);
+				break;
 		}
 	}
 }
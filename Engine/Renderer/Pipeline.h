@@ -15,12 +15,15 @@
 #include "Renderer/RenderViews/TextureView.h"
 #include "Renderer/RenderViews/ShaderView.h"
 
+class FrameGraph;
+
 // TODO: Refactor this
 
 class ENGINE_API Pipeline
 {
 private:
 	static glm::mat4 _modelMatrix;
+	static glm::mat4 _dequantizationMatrix;
 	static glm::mat4 _viewMatrix;
 	static glm::mat4 _projectionMatrix;
 
@@ -33,6 +36,8 @@ private:
 	static Resource<MaterialView> _defaultMaterialView;
 	static Resource<TextureView> _defaultTextureView;
 
+	static FrameGraph* _frameGraph;
+
 public:
 	static void Init ();
 	static void Clear ();
@@ -46,6 +51,7 @@ public:
 	static void CreateProjection (glm::mat4 projectionMatrix);
 
 	static void SetObjectTransform (const Transform *transform);
+	static void SetObjectDequantization (const glm::mat4& dequantizationMatrix);
 	static void SendCamera (const Camera* camera);
 
 	static void UpdateMatrices (const Resource<ShaderView>& shaderView);
@@ -56,6 +62,12 @@ public:
 		const std::vector<PipelineAttribute>& attrs);
 
 	static void ClearObjectTransform ();
+
+	static void SetFrameGraph (FrameGraph* frameGraph);
+
+	static void ReadTexture (unsigned int gpuIndex);
+	static void BindImageTexture (unsigned int unit, unsigned int gpuIndex, int level,
+		bool layered, int layer, unsigned int access, unsigned int format);
 };
 
 #endif
\ No newline at end of file
@@ -20,13 +20,21 @@ struct PipelineAttribute
 		ATTR_TEXTURE_CUBE,
 		ATTR_TEXTURE_VIEW_DEPTH,
 		ATTR_MATRIX_4X4F,
-		ATTR_BLOCK
+		ATTR_BLOCK,
+		ATTR_STORAGE_BLOCK
 	};
 
 	AttrType type;
 	std::string name;
 	glm::vec3 value;
 	glm::mat4 matrix;
+
+	/*
+	 * Range of a storage block, whole buffer when size is zero
+	*/
+
+	std::size_t offset = 0;
+	std::size_t size = 0;
 };
 
 #endif
\ No newline at end of file
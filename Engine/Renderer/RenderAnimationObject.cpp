@@ -18,22 +18,22 @@ RenderAnimationObject::RenderAnimationObject () :
 
 }
 
-void RenderAnimationObject::Draw ()
+void RenderAnimationObject::Draw (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
 	Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
 
-	_modelView->Draw ();
+	_modelView->Draw (levelOfDetail);
 }
 
-void RenderAnimationObject::DrawGeometry ()
+void RenderAnimationObject::DrawGeometry (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
 	Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
 
-	_modelView->DrawGeometry ();
+	_modelView->DrawGeometry (levelOfDetail);
 }
 
 void RenderAnimationObject::SetAnimationModel (const Resource<Model>& animationModel)
@@ -14,6 +14,8 @@
 
 class RenderAnimationObject : public RenderObject
 {
+	DECLARE_RENDER_OBJECT(RenderAnimationObject)
+
 protected:
 	Resource<Model> _animationModel;
 	std::string _currentAnimClipName;
@@ -27,8 +29,8 @@ protected:
 public:
 	RenderAnimationObject ();
 
-	void Draw ();
-	void DrawGeometry ();
+	void Draw (std::size_t levelOfDetail = 0);
+	void DrawGeometry (std::size_t levelOfDetail = 0);
 
 	//TODO: Fix this
 	void SetAnimationModel (const Resource<Model>& animationModel);
@@ -0,0 +1,65 @@
+#include "RenderCommandList.h"
+
+RenderCommandList::RenderCommandList () :
+	_lastState (0),
+	_hasState (false)
+{
+
+}
+
+void RenderCommandList::Reset ()
+{
+	/*
+	 * Keep the storage for the next frame
+	*/
+
+	_commands.clear ();
+
+	_hasState = false;
+}
+
+void RenderCommandList::SetState (int state)
+{
+	if (_hasState == true && _lastState == state) {
+		return;
+	}
+
+	RenderCommand command;
+
+	command.type = RENDER_COMMAND_STATE;
+	command.state = state;
+	command.renderObject = nullptr;
+	command.levelOfDetail = 0;
+
+	_commands.push_back (command);
+
+	_lastState = state;
+	_hasState = true;
+}
+
+void RenderCommandList::Draw (RenderObject* renderObject, std::size_t levelOfDetail)
+{
+	RenderCommand command;
+
+	command.type = RENDER_COMMAND_DRAW;
+	command.state = _lastState;
+	command.renderObject = renderObject;
+	command.levelOfDetail = levelOfDetail;
+
+	_commands.push_back (command);
+}
+
+std::size_t RenderCommandList::GetCommandsCount () const
+{
+	return _commands.size ();
+}
+
+std::vector<RenderCommand>::const_iterator RenderCommandList::begin () const
+{
+	return _commands.begin ();
+}
+
+std::vector<RenderCommand>::const_iterator RenderCommandList::end () const
+{
+	return _commands.end ();
+}
@@ -0,0 +1,57 @@
+#ifndef RENDERCOMMANDLIST_H
+#define RENDERCOMMANDLIST_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+
+#include "Renderer/RenderObject.h"
+
+enum RenderCommandType
+{
+	RENDER_COMMAND_STATE,
+	RENDER_COMMAND_DRAW
+};
+
+/*
+ * State commands carry a pass defined key (scene layers for geometry
+ * passes) that the pass turns into framebuffer and shader binds.
+*/
+
+struct RenderCommand
+{
+	RenderCommandType type;
+	int state;
+	RenderObject* renderObject;
+	std::size_t levelOfDetail;
+};
+
+/*
+ * Draw and state commands recorded without touching the GL context.
+ * Lists are recorded by render workers and replayed in order on the
+ * thread that owns the context. Repeated states are dropped while
+ * recording.
+*/
+
+class ENGINE_API RenderCommandList : public Object
+{
+protected:
+	std::vector<RenderCommand> _commands;
+	int _lastState;
+	bool _hasState;
+
+public:
+	RenderCommandList ();
+
+	void Reset ();
+
+	void SetState (int state);
+	void Draw (RenderObject* renderObject, std::size_t levelOfDetail);
+
+	std::size_t GetCommandsCount () const;
+
+	std::vector<RenderCommand>::const_iterator begin () const;
+	std::vector<RenderCommand>::const_iterator end () const;
+};
+
+#endif
@@ -7,7 +7,7 @@
 
 class RenderDirectionalLightObject : public RenderLightObject
 {
-
+	DECLARE_RENDER_OBJECT(RenderDirectionalLightObject)
 };
 
 #endif
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 class RenderLightObject : public RenderObject
 {
+	DECLARE_RENDER_OBJECT(RenderLightObject)
+
 public:
 	struct Shadow
 	{
@@ -1,6 +1,11 @@
 #include "RenderManager.h"
 
 #include "RenderModuleManager.h"
+#include "ShaderCompiler.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Utils/Extensions/StringExtend.h"
 
 #include "Debug/Profiler/Profiler.h"
 
@@ -9,7 +14,10 @@
 */
 
 RenderManager::RenderManager () :
-	_renderScene (nullptr)
+	_renderScene (nullptr),
+	_snapshotScene (nullptr),
+	_snapshotCamera (nullptr),
+	_snapshotSettings (nullptr)
 {
 
 }
@@ -28,6 +36,32 @@ SPECIALIZE_SINGLETON(RenderManager)
 void RenderManager::Init ()
 {
 	_renderScene = new RenderScene ();
+
+	/*
+	 * Modules initialized ahead of use get their shaders compiled by
+	 * the time they are switched on
+	*/
+
+	if (SettingsManager::Instance ()->GetValue<bool> ("render_modules_warm_up", false) == true) {
+
+		/*
+		 * Only the listed modules are warmed up, every module if the
+		 * list is empty
+		*/
+
+		std::vector<std::string> renderModes = Extensions::StringExtend::Split (
+			SettingsManager::Instance ()->GetValue<std::string> ("render_modules_warm_up_list", ""), ", ");
+
+		if (renderModes.empty () == true) {
+			renderModes = RenderModuleManager::Instance ()->GetRenderModuleNames ();
+		}
+
+		for (const std::string& renderMode : renderModes) {
+			if (renderMode.empty () == false) {
+				WarmUpRenderModule (renderMode);
+			}
+		}
+	}
 }
 
 void RenderManager::SetRenderSkyboxObject (RenderSkyboxObject* renderSkyboxObject)
@@ -80,30 +114,115 @@ void RenderManager::SetRenderAmbientLightObject (RenderAmbientLightObject* rende
 	_renderScene->SetRenderAmbientLightObject (renderAmbientLightObject);
 }
 
-//TODO: Remove this
-#include <set>
-
 RenderProduct RenderManager::Render (const Camera* camera, const RenderSettings& settings)
+{
+	return Render (_renderScene, camera, settings);
+}
+
+void RenderManager::UpdateSnapshot (const Camera* camera, const RenderSettings& settings)
+{
+	PROFILER_LOGGER("Snapshot")
+
+	/*
+	 * Called while the update thread is idle. Rendering the snapshot
+	 * does not touch anything the update thread changes.
+	*/
+
+	if (_snapshotScene == nullptr) {
+		_snapshotScene = new RenderSceneSnapshot ();
+	}
+
+	_snapshotScene->Update (_renderScene);
+
+	delete _snapshotCamera;
+	_snapshotCamera = camera->Clone ();
+
+	if (_snapshotSettings == nullptr) {
+		_snapshotSettings = new RenderSettings (settings);
+	} else {
+		*_snapshotSettings = settings;
+	}
+}
+
+RenderProduct RenderManager::RenderSnapshot ()
+{
+	return Render (_snapshotScene, _snapshotCamera, *_snapshotSettings);
+}
+
+RenderProduct RenderManager::Render (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings)
 {
 	PROFILER_LOGGER("Render")
 
 	RenderModule* renderModule = RenderModuleManager::Instance ()->GetRenderModule (settings.renderMode);
 
-	static std::set<RenderModule*> initalized;
+	InitRenderModule (renderModule, settings);
+
+	/*
+	 * Initialize the next module waiting to be warmed up
+	*/
+
+	UpdateWarmUp (settings);
 
-	if (initalized.find (renderModule) == initalized.end ()) {
+	RenderProduct result = renderModule->Render (renderScene, camera, settings);
+
+	return result;
+}
 
-		renderModule->InitModule (settings);
+void RenderManager::WarmUpRenderModule (const std::string& renderMode)
+{
+	_warmUpModules.push_back (renderMode);
+}
 
-		initalized.insert (renderModule);
+void RenderManager::InitRenderModule (RenderModule* renderModule, const RenderSettings& settings)
+{
+	if (_initializedModules.find (renderModule) != _initializedModules.end ()) {
+		return;
 	}
 
-	RenderProduct result = renderModule->Render (_renderScene, camera, settings);
+	/*
+	 * Submit every shader of the module before linking any of them
+	*/
 
-	return result;
+	ShaderCompiler::BeginBatch ();
+
+	renderModule->InitModule (settings);
+
+	ShaderCompiler::EndBatch ();
+
+	_initializedModules.insert (renderModule);
+}
+
+void RenderManager::UpdateWarmUp (const RenderSettings& settings)
+{
+	/*
+	 * One module per frame, so the frame cost stays that of a module
+	 * initialization without waiting on its shaders
+	*/
+
+	while (_warmUpModules.empty () == false) {
+		RenderModule* renderModule = RenderModuleManager::Instance ()->GetRenderModule (_warmUpModules.back ());
+
+		_warmUpModules.pop_back ();
+
+		if (renderModule != nullptr && _initializedModules.find (renderModule) == _initializedModules.end ()) {
+			InitRenderModule (renderModule, settings);
+
+			break;
+		}
+	}
+
+	/*
+	 * Finish the programs the driver is done with
+	*/
+
+	ShaderCompiler::Update ();
 }
 
 void RenderManager::Clear ()
 {
+	delete _snapshotScene;
+	delete _snapshotCamera;
+	delete _snapshotSettings;
+
 	delete _renderScene;
 }
@@ -24,8 +24,14 @@
 #include "RenderProduct.h"
 
 #include "RenderScene.h"
+#include "RenderSceneSnapshot.h"
 #include "Systems/Camera/Camera.h"
 #include "RenderSettings.h"
+#include "RenderModule.h"
+
+#include <set>
+#include <string>
+#include <vector>
 
 class ENGINE_API RenderManager : public Singleton<RenderManager>
 {
@@ -36,11 +42,23 @@ class ENGINE_API RenderManager : public Singleton<RenderManager>
 private:
 	RenderScene* _renderScene;
 
+	RenderSceneSnapshot* _snapshotScene;
+	Camera* _snapshotCamera;
+	RenderSettings* _snapshotSettings;
+
+	std::set<RenderModule*> _initializedModules;
+	std::vector<std::string> _warmUpModules;
+
 public:
 	void Init ();
 
 	RenderProduct Render (const Camera* camera, const RenderSettings&);
 
+	void UpdateSnapshot (const Camera* camera, const RenderSettings&);
+	RenderProduct RenderSnapshot ();
+
+	void WarmUpRenderModule (const std::string& renderMode);
+
 	void SetRenderSkyboxObject (RenderSkyboxObject*);
 
 	void AttachRenderObject (RenderObject*);
@@ -59,6 +77,11 @@ public:
 
 	void Clear ();
 private:
+	RenderProduct Render (const RenderScene* renderScene, const Camera* camera, const RenderSettings&);
+
+	void InitRenderModule (RenderModule* renderModule, const RenderSettings&);
+	void UpdateWarmUp (const RenderSettings&);
+
 	RenderManager ();
 	RenderManager (const RenderManager& other);
 	RenderManager& operator=(const RenderManager& other);
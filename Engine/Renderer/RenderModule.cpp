@@ -1,9 +1,15 @@
 #include "RenderModule.h"
 
+#include "Renderer/Pipeline.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
 #include "Debug/Profiler/Profiler.h"
 
 RenderModule::RenderModule () :
-	_rvc (nullptr)
+	_rvc (nullptr),
+	_frameGraph (nullptr),
+	_gBufferMipRequirements (nullptr)
 {
 
 }
@@ -34,6 +40,22 @@ void RenderModule::InitModule (const RenderSettings& settings)
 	*/
 
 	_rvc = new RenderVolumeCollection ();
+
+	/*
+	 * Initialize GBuffer mip requirements
+	*/
+
+	_gBufferMipRequirements = new GBufferMipRequirements ();
+
+	/*
+	 * Initialize frame graph
+	*/
+
+	if (SettingsManager::Instance ()->GetValue<bool> ("frame_graph", true) == true) {
+		_frameGraph = new FrameGraph ();
+
+		_rvc->SetFrameGraph (_frameGraph);
+	}
 }
 
 RenderProduct RenderModule::Render (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings)
@@ -50,22 +72,63 @@ RenderProduct RenderModule::Render (const RenderScene* renderScene, const Camera
 
 	_rvc->StartScope ();
 
+	/*
+	 * Let the geometry pass know which GBuffer mips are sampled
+	*/
+
+	DeclareGBufferMips (settings);
+
+	static RenderVolumeHandle gBufferMipRequirementsHandle = RenderVolumeCollection::GetHandle ("GBufferMipRequirements");
+
+	_rvc->Insert (gBufferMipRequirementsHandle, _gBufferMipRequirements);
+
+	/*
+	 * Start recording or replaying the frame graph
+	*/
+
+	if (_frameGraph != nullptr) {
+		_frameGraph->BeginFrame ();
+	}
+
+	Pipeline::SetFrameGraph (_frameGraph);
+
 	/*
 	 * Iterate on every pass on associated order to draw scene
 	*/
 
 	for (RenderPassI* renderPass : _renderPasses) {
+
+		/*
+		 * Skip passes culled by the frame graph
+		*/
+
+		if (_frameGraph != nullptr && _frameGraph->BeginPass (renderPass) == false) {
+			continue;
+		}
+
 		PROFILER_LOGGER(renderPass->GetName ())
 		PROFILER_GPU_LOGGER(renderPass->GetName ())
 
 		_rvc = renderPass->Execute (renderScene, camera, settings, _rvc);
+
+		if (_frameGraph != nullptr) {
+			_frameGraph->EndPass ();
+		}
+	}
+
+	Pipeline::SetFrameGraph (nullptr);
+
+	if (_frameGraph != nullptr) {
+		_frameGraph->EndFrame ();
 	}
 
 	/*
 	 * Initialize render product
 	*/
 
-	product.resultVolume = _rvc->GetRenderVolume ("ResultFramebufferRenderVolume");
+	static RenderVolumeHandle resultVolumeHandle = RenderVolumeCollection::GetHandle ("ResultFramebufferRenderVolume");
+
+	product.resultVolume = _rvc->GetRenderVolume (resultVolumeHandle);
 
 	/*
 	 * Release scope
@@ -84,6 +147,22 @@ void RenderModule::ClearModule ()
 
 	delete _rvc;
 
+	/*
+	 * Delete GBuffer mip requirements
+	*/
+
+	delete _gBufferMipRequirements;
+
+	_gBufferMipRequirements = nullptr;
+
+	/*
+	 * Delete frame graph
+	*/
+
+	delete _frameGraph;
+
+	_frameGraph = nullptr;
+
 	/*
 	 * Clear every render pass
 	*/
@@ -102,3 +181,16 @@ void RenderModule::ClearModule ()
 
 	_renderPasses.clear ();
 }
+
+void RenderModule::DeclareGBufferMips (const RenderSettings& settings)
+{
+	/*
+	 * Requirements depend on settings, so they are collected every frame
+	*/
+
+	_gBufferMipRequirements->Reset ();
+
+	for (RenderPassI* renderPass : _renderPasses) {
+		renderPass->DeclareGBufferMips (settings, *_gBufferMipRequirements);
+	}
+}
@@ -6,6 +6,8 @@
 #include <vector>
 
 #include "RenderPassI.h"
+#include "FrameGraph.h"
+#include "GBufferMipRequirements.h"
 
 #include "RenderProduct.h"
 
@@ -17,6 +19,8 @@ class ENGINE_API RenderModule : public Object
 {
 protected:
 	RenderVolumeCollection* _rvc;
+	FrameGraph* _frameGraph;
+	GBufferMipRequirements* _gBufferMipRequirements;
 	std::vector<RenderPassI*> _renderPasses;
 
 public:
@@ -29,6 +33,8 @@ public:
 	virtual void ClearModule ();
 protected:
 	virtual void Init () = 0;
+
+	void DeclareGBufferMips (const RenderSettings& settings);
 };
 
 #endif
\ No newline at end of file
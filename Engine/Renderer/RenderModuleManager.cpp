@@ -36,6 +36,17 @@ RenderModule* RenderModuleManager::GetRenderModule (const std::string& name)
 	return _renderModules [name];
 }
 
+std::vector<std::string> RenderModuleManager::GetRenderModuleNames () const
+{
+	std::vector<std::string> names;
+
+	for (auto renderModule : _renderModules) {
+		names.push_back (renderModule.first);
+	}
+
+	return names;
+}
+
 void RenderModuleManager::Clear ()
 {
 	for (auto renderModule : _renderModules) {
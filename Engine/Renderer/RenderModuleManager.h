@@ -5,6 +5,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Renderer/RenderModule.h"
 
@@ -22,6 +23,7 @@ private:
 public:
 	void RegisterRenderModule (const std::string& name, RenderModule* renderModule);
 	RenderModule* GetRenderModule (const std::string& name);
+	std::vector<std::string> GetRenderModuleNames () const;
 
 	void Clear ();
 private:
@@ -7,6 +7,7 @@
 RenderObject::RenderObject () :
 	_transform (nullptr),
 	_modelView (nullptr),
+	_occluderMesh (nullptr),
 	_renderStage (RenderStage::RENDER_STAGE_DEFERRED),
 	_sceneLayers (0),
 	_priority (0),
@@ -40,6 +41,11 @@ void RenderObject::SetModelView (const Resource<ModelView>& modelView)
 	_modelView = modelView;
 }
 
+void RenderObject::SetOccluderMesh (const Resource<OccluderMesh>& occluderMesh)
+{
+	_occluderMesh = occluderMesh;
+}
+
 void RenderObject::SetBoundingBox (const AABBVolume& boundingBox)
 {
 	_modelSpaceBoundingBox = boundingBox;
@@ -77,11 +83,16 @@ const Transform* RenderObject::GetTransform () const
 	return _transform;
 }
 
-Resource<ModelView> RenderObject::GetModelView () const
+const Resource<ModelView>& RenderObject::GetModelView () const
 {
 	return _modelView;
 }
 
+const Resource<OccluderMesh>& RenderObject::GetOccluderMesh () const
+{
+	return _occluderMesh;
+}
+
 const AABBVolume& RenderObject::GetBoundingBox () const
 {
 	return _worldSpaceBoundingBox;
@@ -107,18 +118,18 @@ bool RenderObject::IsActive () const
 	return _isActive;
 }
 
-void RenderObject::Draw ()
+void RenderObject::Draw (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
-	_modelView->Draw ();
+	_modelView->Draw (levelOfDetail);
 }
 
-void RenderObject::DrawGeometry ()
+void RenderObject::DrawGeometry (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
-	_modelView->DrawGeometry ();
+	_modelView->DrawGeometry (levelOfDetail);
 }
 
 void RenderObject::UpdateBoundingBox ()
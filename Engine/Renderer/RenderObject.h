@@ -7,16 +7,31 @@
 
 #include "Core/Resources/Resource.h"
 #include "RenderViews/ModelView.h"
+#include "Renderer/OccluderMesh.h"
 #include "Core/Intersections/AABBVolume.h"
 #include "Renderer/RenderStage.h"
 
 #include "Renderer/PipelineAttribute.h"
 
+/*
+ * Copies used by the render scene snapshot
+*/
+
+#define DECLARE_RENDER_OBJECT(T) \
+public: \
+	virtual RenderObject* Clone () const { return new T (*this); } \
+	virtual void CopyTo (RenderObject* other) const { *((T*) other) = *this; }
+
 class RenderObject : public Object
 {
+	DECLARE_RENDER_OBJECT(RenderObject)
+
+	friend class RenderSceneSnapshot;
+
 protected:
 	const Transform* _transform;
 	Resource<ModelView> _modelView;
+	Resource<OccluderMesh> _occluderMesh;
 	RenderStage _renderStage;
 	int _sceneLayers;
 	int _priority;
@@ -34,6 +49,7 @@ public:
 
 	void SetTransform (const Transform* transform);
 	void SetModelView (const Resource<ModelView>& modelView);
+	void SetOccluderMesh (const Resource<OccluderMesh>& occluderMesh);
 	void SetBoundingBox (const AABBVolume& boundingBox);
 	void SetRenderStage (RenderStage renderStage);
 	void SetSceneLayers (int sceneLayers);
@@ -42,15 +58,16 @@ public:
 	void SetAttributes (const std::vector<PipelineAttribute>& attributes);
 
 	const Transform* GetTransform () const;
-	Resource<ModelView> GetModelView () const;
+	const Resource<ModelView>& GetModelView () const;
+	const Resource<OccluderMesh>& GetOccluderMesh () const;
 	const AABBVolume& GetBoundingBox () const;
 	RenderStage GetRenderStage () const;
 	int GetSceneLayers () const;
 	int GetPriority () const;
 	bool IsActive () const;
 
-	virtual void Draw ();
-	virtual void DrawGeometry ();
+	virtual void Draw (std::size_t levelOfDetail = 0);
+	virtual void DrawGeometry (std::size_t levelOfDetail = 0);
 protected:
 	void UpdateBoundingBox ();
 };
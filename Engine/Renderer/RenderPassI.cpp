@@ -4,3 +4,10 @@ RenderPassI::~RenderPassI ()
 {
 
 }
+
+void RenderPassI::DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const
+{
+	/*
+	 * Most passes sample only the base level of the GBuffer
+	*/
+}
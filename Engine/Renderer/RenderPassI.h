@@ -8,6 +8,7 @@
 #include "Renderer/RenderScene.h"
 #include "Systems/Camera/Camera.h"
 #include "RenderSettings.h"
+#include "GBufferMipRequirements.h"
 
 #define DECLARE_RENDER_PASS(T) \
 public: \
@@ -24,6 +25,8 @@ public:
 
 	virtual std::string GetName () const = 0;
 
+	virtual void DeclareGBufferMips (const RenderSettings& settings, GBufferMipRequirements& requirements) const;
+
 	virtual void Clear () = 0;
 };
 
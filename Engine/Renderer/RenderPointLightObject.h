@@ -5,6 +5,8 @@
 
 class RenderPointLightObject : public RenderLightObject
 {
+	DECLARE_RENDER_OBJECT(RenderPointLightObject)
+
 protected:
 	float _lightRange;
 
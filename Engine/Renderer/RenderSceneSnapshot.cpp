@@ -0,0 +1,130 @@
+#include "RenderSceneSnapshot.h"
+
+RenderSceneSnapshot::RenderSceneSnapshot () :
+	_entries (),
+	_ambientLightCopy ()
+{
+
+}
+
+RenderSceneSnapshot::~RenderSceneSnapshot ()
+{
+	for (auto& it : _entries) {
+		ReleaseEntry (it.second);
+	}
+}
+
+void RenderSceneSnapshot::Update (const RenderScene* renderScene)
+{
+	for (auto& it : _entries) {
+		it.second.visited = false;
+	}
+
+	/*
+	 * Sets are filled directly, the scene bounding box is taken from
+	 * the original instead of being rebuilt on every attach
+	*/
+
+	_renderObjects.clear ();
+	_renderDirectionalLightObjects.clear ();
+	_renderPointLightObjects.clear ();
+	_renderSpotLightObjects.clear ();
+
+	for (auto it = renderScene->begin<RenderObject*> (); it != renderScene->end<RenderObject*> (); ++ it) {
+		_renderObjects.insert (GetCopy (*it));
+	}
+
+	for (auto it = renderScene->begin<RenderDirectionalLightObject*> (); it != renderScene->end<RenderDirectionalLightObject*> (); ++ it) {
+		_renderDirectionalLightObjects.insert ((RenderDirectionalLightObject*) GetCopy (*it));
+	}
+
+	for (auto it = renderScene->begin<RenderPointLightObject*> (); it != renderScene->end<RenderPointLightObject*> (); ++ it) {
+		_renderPointLightObjects.insert ((RenderPointLightObject*) GetCopy (*it));
+	}
+
+	for (auto it = renderScene->begin<RenderSpotLightObject*> (); it != renderScene->end<RenderSpotLightObject*> (); ++ it) {
+		_renderSpotLightObjects.insert ((RenderSpotLightObject*) GetCopy (*it));
+	}
+
+	_renderSkyboxObject = nullptr;
+
+	if (renderScene->GetRenderSkyboxObject () != nullptr) {
+		_renderSkyboxObject = (RenderSkyboxObject*) GetCopy (renderScene->GetRenderSkyboxObject ());
+	}
+
+	_renderAmbientLightObject = nullptr;
+
+	if (renderScene->GetRenderAmbientLightObject () != nullptr) {
+		_ambientLightCopy = *renderScene->GetRenderAmbientLightObject ();
+		_renderAmbientLightObject = &_ambientLightCopy;
+	}
+
+	_boundingBox = renderScene->GetBoundingBox ();
+
+	/*
+	 * Release copies of objects that left the scene
+	*/
+
+	for (auto it = _entries.begin (); it != _entries.end ();) {
+		if (it->second.visited == true) {
+			++ it;
+			continue;
+		}
+
+		ReleaseEntry (it->second);
+
+		it = _entries.erase (it);
+	}
+}
+
+RenderObject* RenderSceneSnapshot::GetCopy (const RenderObject* renderObject)
+{
+	std::type_index type (typeid (*renderObject));
+
+	auto it = _entries.find (renderObject);
+
+	/*
+	 * Reuse the copy while the original keeps its type, an address may
+	 * be taken by another kind of object after a delete
+	*/
+
+	if (it != _entries.end () && it->second.type != type) {
+		ReleaseEntry (it->second);
+
+		_entries.erase (it);
+
+		it = _entries.end ();
+	}
+
+	if (it == _entries.end ()) {
+		SnapshotEntry entry = { renderObject->Clone (), new Transform (nullptr), type, false };
+
+		it = _entries.insert (std::make_pair (renderObject, entry)).first;
+	} else {
+		renderObject->CopyTo (it->second.copy);
+	}
+
+	SnapshotEntry& entry = it->second;
+
+	entry.visited = true;
+
+	/*
+	 * Copies point to their own transform, the original one keeps
+	 * changing on the update thread
+	*/
+
+	entry.copy->_transform = nullptr;
+
+	if (renderObject->GetTransform () != nullptr) {
+		entry.transform->CopyState (*renderObject->GetTransform ());
+		entry.copy->_transform = entry.transform;
+	}
+
+	return entry.copy;
+}
+
+void RenderSceneSnapshot::ReleaseEntry (SnapshotEntry& entry)
+{
+	delete entry.copy;
+	delete entry.transform;
+}
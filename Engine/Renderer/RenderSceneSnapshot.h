@@ -0,0 +1,43 @@
+#ifndef RENDERSCENESNAPSHOT_H
+#define RENDERSCENESNAPSHOT_H
+
+#include "RenderScene.h"
+
+#include <map>
+#include <typeindex>
+
+/*
+ * Render scene made of copies of another scene's objects. Copies keep
+ * their own transforms, so the scene can be drawn while the update
+ * thread changes the originals. Copies are allocated once and then
+ * overwritten on every update, so passes that keep per object state
+ * between frames see the same pointers. Copies whose originals left
+ * the scene are released on the next update.
+*/
+
+class ENGINE_API RenderSceneSnapshot : public RenderScene
+{
+protected:
+	struct SnapshotEntry
+	{
+		RenderObject* copy;
+		Transform* transform;
+		std::type_index type;
+		bool visited;
+	};
+
+	std::map<const RenderObject*, SnapshotEntry> _entries;
+	RenderAmbientLightObject _ambientLightCopy;
+
+public:
+	RenderSceneSnapshot ();
+	~RenderSceneSnapshot ();
+
+	void Update (const RenderScene* renderScene);
+protected:
+	RenderObject* GetCopy (const RenderObject* renderObject);
+
+	void ReleaseEntry (SnapshotEntry& entry);
+};
+
+#endif
@@ -27,6 +27,34 @@ struct RenderSettings : public Object
 	std::string renderMode;
 	Resolution resolution;
 	Viewport viewport;
+	Viewport window;
+
+	bool dynamic_resolution_enabled;
+	float dynamic_resolution_target;
+	float dynamic_resolution_min_scale;
+
+	bool gbuffer_packed;
+
+	bool occlusion_culling_enabled;
+	std::size_t occlusion_culling_width;
+	std::size_t occlusion_culling_height;
+
+	bool lod_enabled;
+	float lod_threshold_1;
+	float lod_threshold_2;
+	float lod_threshold_3;
+
+	bool clustered_lighting_enabled;
+	std::size_t clustered_lighting_width;
+	std::size_t clustered_lighting_height;
+	std::size_t clustered_lighting_depth;
+
+	bool shadow_cascades_amortized_update;
+	std::size_t shadow_cascades_update_interval;
+
+	bool spot_shadow_atlas_enabled;
+	std::size_t spot_shadow_atlas_size;
+	std::size_t spot_shadow_atlas_update_budget;
 
 	bool ssao_enabled;
 	float ssao_scale;
@@ -46,6 +74,10 @@ struct RenderSettings : public Object
 
 	bool taa_enabled;
 
+	bool blur_compute_enabled;
+	std::size_t blur_radius;
+	std::string blur_format;
+
 	bool bloom_enabled;
 	float bloom_scale;
 	float bloom_threshold;
@@ -60,6 +92,8 @@ struct RenderSettings : public Object
 
 	bool gamma_enabled;
 
+	bool post_process_compositor_enabled;
+
 	float rsm_scale;
 	std::size_t rsm_samples;
 	float rsm_radius;
@@ -71,9 +105,13 @@ struct RenderSettings : public Object
 	float rsm_min_interpolation_distance;
 	float rsm_min_interpolation_angle;
 	bool rsm_debug_interpolation;
+	std::size_t rsm_amortization_interval;
+	bool rsm_amortization_interleaved;
 
 	bool trsm_temporal_filter_enabled;
 	bool trsm_blur_enabled;
+	std::size_t trsm_amortization_interval;
+	bool trsm_amortization_interleaved;
 
 	std::size_t lpv_volume_size;
 	std::size_t lpv_iterations;
@@ -82,9 +120,12 @@ struct RenderSettings : public Object
 	float lpv_indirect_diffuse_intensity;
 	float lpv_indirect_specular_intensity;
 	float lpv_indirect_refractive_intensity;
+	std::size_t lpv_cascades_count;
+	float lpv_cascade_extent;
 
 	std::size_t vct_voxels_size;
 	bool vct_continuous_voxelization;
+	bool vct_incremental_voxelization;
 	bool vct_bordering;
 	std::size_t vct_mipmap_levels;
 	float vct_indirect_diffuse_intensity;
@@ -102,6 +143,8 @@ struct RenderSettings : public Object
 	bool vct_debug_show_voxels;
 	std::size_t vct_debug_volume_mipmap_level;
 	float vct_origin_bias;
+	std::size_t vct_amortization_interval;
+	bool vct_amortization_interleaved;
 
 	bool ssdo_enabled;
 	bool ssdo_temporal_filter_enabled;
@@ -118,6 +161,8 @@ struct RenderSettings : public Object
 	float ssdo_min_interpolation_distance;
 	float ssdo_min_interpolation_angle;
 	bool ssdo_debug_interpolation;
+	std::size_t ssdo_amortization_interval;
+	bool ssdo_amortization_interleaved;
 
 	std::size_t hgi_rsm_samples;
 	float hgi_rsm_radius;
@@ -136,6 +181,8 @@ struct RenderSettings : public Object
 	float hgi_ao_radius;
 	float hgi_ao_bias;
 	float hgi_ao_blend;
+	std::size_t hgi_amortization_interval;
+	bool hgi_amortization_interleaved;
 };
 
 #endif
\ No newline at end of file
@@ -25,7 +25,7 @@ RenderSkyboxObject::~RenderSkyboxObject ()
 
 }
 
-void RenderSkyboxObject::Draw ()
+void RenderSkyboxObject::Draw (std::size_t levelOfDetail)
 {
 	Pipeline::LockShader (_shaderView);
 
@@ -11,6 +11,8 @@
 
 class RenderSkyboxObject : public RenderObject
 {
+	DECLARE_RENDER_OBJECT(RenderSkyboxObject)
+
 protected:
 	Resource<ShaderView> _shaderView;
 	Resource<TextureView> _cubemapView;
@@ -22,7 +24,7 @@ public:
 	RenderSkyboxObject ();
 	~RenderSkyboxObject ();
 
-	void Draw ();
+	void Draw (std::size_t levelOfDetail = 0);
 
 	void SetCubeMap (const Resource<TextureView>& cubeMap);
 
@@ -5,6 +5,8 @@
 
 class RenderSpotLightObject : public RenderPointLightObject
 {
+	DECLARE_RENDER_OBJECT(RenderSpotLightObject)
+
 protected:
 	float _lightSpotCutoff;
 	float _lightSpotOuterCutoff;
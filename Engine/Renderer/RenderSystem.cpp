@@ -1,6 +1,9 @@
 #include "RenderSystem.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/PersistentRingBuffer.h"
+#include "Renderer/RenderThread.h"
+#include "Renderer/ShaderCompiler.h"
 
 #include "Mesh/AnimationModel.h"
 #include "Mesh/LightMapModel.h"
@@ -14,10 +17,18 @@
 #include "RenderViews/TextureLUTView.h"
 
 #include "Core/Console/Console.h"
+#include "Systems/Settings/SettingsManager.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
 #include "Utils/Extensions/MathExtend.h"
+#include "Utils/Simplification/MeshSimplification.h"
+#include "Utils/Optimization/MeshOptimization.h"
+#include "Utils/TangentSpace/TangentSpaceGeneration.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+#include <limits>
 
 VertexData::VertexData ()
 {
@@ -38,7 +49,7 @@ AnimatedVertexData::AnimatedVertexData () : VertexData ()
 
 NormalMapVertexData::NormalMapVertexData () : VertexData ()
 {
-	for (std::size_t i = 0; i < 3; i++) {
+	for (std::size_t i = 0; i < 4; i++) {
 		tangent [i] = 0;
 	}
 }
@@ -50,11 +61,39 @@ LightMapVertexData::LightMapVertexData () : VertexData ()
 	}
 }
 
-TextGUIVertexData::TextGUIVertexData ()
+CompactVertexData::CompactVertexData ()
 {
-	for (std::size_t i = 0; i < 2; i++) {
-		position [i] = texcoord [i] = 0;
+	for (std::size_t i = 0; i < 4; i++) {
+		position [i] = 0;
 	}
+
+	normal = 0;
+	texcoord [0] = texcoord [1] = 0;
+}
+
+CompactAnimatedVertexData::CompactAnimatedVertexData ()
+{
+	for (std::size_t i = 0; i < 3; i++) {
+		position [i] = 0;
+	}
+
+	normal = 0;
+	texcoord [0] = texcoord [1] = 0;
+
+	for (std::size_t i = 0; i < 4; i++) {
+		bones [i] = 0;
+		weights [i] = 0;
+	}
+}
+
+CompactNormalMapVertexData::CompactNormalMapVertexData () : CompactVertexData ()
+{
+	tangent = 0;
+}
+
+CompactLightMapVertexData::CompactLightMapVertexData () : CompactVertexData ()
+{
+	lmTexcoord [0] = lmTexcoord [1] = 0;
 }
 
 // http://szudzik.com/ElegantPairing.pdf
@@ -63,8 +102,103 @@ std::size_t hash (std::size_t a, std::size_t b)
 	return a >= b ? a * a + a + b : a + b * b;
 }
 
+template <class T>
+static std::vector<glm::vec3> GetPositions (const std::vector<T>& vertexBuffer)
+{
+	std::vector<glm::vec3> positions;
+	positions.reserve (vertexBuffer.size ());
+
+	for (const T& vertexData : vertexBuffer) {
+		positions.push_back (glm::vec3 (vertexData.position [0], vertexData.position [1], vertexData.position [2]));
+	}
+
+	return positions;
+}
+
+/*
+ * Map the mesh bounding box onto the unit cube. Inverse of this matrix
+ * quantizes positions, the matrix itself is applied by the pipeline.
+*/
+
+template <class T>
+static glm::mat4 GetDequantizationMatrix (const std::vector<T>& vertexBuffer)
+{
+	if (vertexBuffer.empty ()) {
+		return glm::mat4 (1.0f);
+	}
+
+	glm::vec3 minVertex (std::numeric_limits<float>::max ());
+	glm::vec3 maxVertex (-std::numeric_limits<float>::max ());
+
+	for (const T& vertexData : vertexBuffer) {
+		glm::vec3 position (vertexData.position [0], vertexData.position [1], vertexData.position [2]);
+
+		minVertex = glm::min (minVertex, position);
+		maxVertex = glm::max (maxVertex, position);
+	}
+
+	/*
+	 * Keep the matrix invertible for flat meshes
+	*/
+
+	glm::vec3 extent = glm::max (maxVertex - minVertex, glm::vec3 (1e-5f));
+
+	return glm::translate (glm::mat4 (1.0f), minVertex) * glm::scale (glm::mat4 (1.0f), extent);
+}
+
+static unsigned short PackUnorm16 (float value)
+{
+	return (unsigned short) glm::round (glm::clamp (value, 0.0f, 1.0f) * 65535.0f);
+}
+
+static unsigned int PackDirection (const float* direction)
+{
+	return glm::packSnorm3x10_1x2 (glm::vec4 (direction [0], direction [1], direction [2], 0.0f));
+}
+
+/*
+ * Round weights to 8 bits and give the rounding error to the greatest
+ * one, so they still sum to one
+*/
+
+static void PackWeights (const float* weights, unsigned char* packedWeights)
+{
+	int weightsSum = 0;
+	std::size_t maxIndex = 0;
+
+	for (std::size_t i = 0; i < 4; i++) {
+		packedWeights [i] = (unsigned char) glm::round (glm::clamp (weights [i], 0.0f, 1.0f) * 255.0f);
+		weightsSum += packedWeights [i];
+
+		if (weights [i] > weights [maxIndex]) {
+			maxIndex = i;
+		}
+	}
+
+	if (weightsSum > 0) {
+		packedWeights [maxIndex] = (unsigned char) glm::clamp (packedWeights [maxIndex] + 255 - weightsSum, 0, 255);
+	}
+}
+
+static void CompactVertex (const VertexData& vertexData, const glm::mat4& quantizationMatrix, CompactVertexData& compactVertexData)
+{
+	glm::vec3 position = glm::vec3 (quantizationMatrix * glm::vec4 (vertexData.position [0],
+		vertexData.position [1], vertexData.position [2], 1.0f));
+
+	for (std::size_t i = 0; i < 3; i++) {
+		compactVertexData.position [i] = PackUnorm16 (position [i]);
+	}
+
+	compactVertexData.normal = PackDirection (vertexData.normal);
+
+	compactVertexData.texcoord [0] = glm::packHalf1x16 (vertexData.texcoord [0]);
+	compactVertexData.texcoord [1] = glm::packHalf1x16 (vertexData.texcoord [1]);
+}
+
 Resource<ModelView> RenderSystem::LoadModel (const Resource<Model>& model)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ModelView>, LoadModel (model))
+
 	if (Resource<ModelView>::GetResource (model->GetName ()) != nullptr) {
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
@@ -141,7 +275,13 @@ Resource<ModelView> RenderSystem::LoadModel (const Resource<Model>& model)
 		}
 	}
 
-	ObjectBuffer objectBuffer = BindModelVertexData (vertexBuffer, indexBuffer);
+	std::size_t polygonsCount = indexBuffer.size () / 3;
+
+	OptimizeModelBuffers (model->GetName (), modelView, vertexBuffer, indexBuffer);
+
+	ObjectBuffer objectBuffer = SettingsManager::Instance ()->GetValue<bool> ("compact_vertex_format", false) ?
+		BindCompactModelVertexData (vertexBuffer, indexBuffer) : BindModelVertexData (vertexBuffer, indexBuffer);
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
@@ -150,6 +290,8 @@ Resource<ModelView> RenderSystem::LoadModel (const Resource<Model>& model)
 
 Resource<ModelView> RenderSystem::LoadAnimationModel (const Resource<Model>& model)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ModelView>, LoadAnimationModel (model))
+
 	if (Resource<ModelView>::GetResource (model->GetName ()) != nullptr) {
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
@@ -235,7 +377,13 @@ Resource<ModelView> RenderSystem::LoadAnimationModel (const Resource<Model>& mod
 		}
 	}
 
-	ObjectBuffer objectBuffer = BindAnimationModelVertexData (vertexBuffer, indexBuffer);
+	std::size_t polygonsCount = indexBuffer.size () / 3;
+
+	OptimizeModelBuffers (model->GetName (), modelView, vertexBuffer, indexBuffer);
+
+	ObjectBuffer objectBuffer = SettingsManager::Instance ()->GetValue<bool> ("compact_vertex_format", false) ?
+		BindCompactAnimationModelVertexData (vertexBuffer, indexBuffer) : BindAnimationModelVertexData (vertexBuffer, indexBuffer);
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
@@ -244,6 +392,8 @@ Resource<ModelView> RenderSystem::LoadAnimationModel (const Resource<Model>& mod
 
 Resource<ModelView> RenderSystem::LoadNormalMapModel (const Resource<Model>& model)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ModelView>, LoadNormalMapModel (model))
+
 	if (Resource<ModelView>::GetResource (model->GetName ()) != nullptr) {
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
@@ -297,14 +447,6 @@ Resource<ModelView> RenderSystem::LoadNormalMapModel (const Resource<Model>& mod
 							vertexData.texcoord[1] = texcoord.y;
 						}
 
-						if (model->HaveUV ()) {
-							glm::vec3 tangent = CalculateTangent (model, polygon);
-
-							vertexData.tangent [0] = tangent.x;
-							vertexData.tangent [1] = tangent.y;
-							vertexData.tangent [2] = tangent.z;
-						}
-
 						vertexBuffer.push_back (vertexData);
 
 						index = vertexBuffer.size () - 1;
@@ -328,7 +470,21 @@ Resource<ModelView> RenderSystem::LoadNormalMapModel (const Resource<Model>& mod
 		}
 	}
 
-	ObjectBuffer objectBuffer = BindNormalMapModelVertexData (vertexBuffer, indexBuffer);
+	/*
+	 * Tangents are generated only when texcoords are present
+	*/
+
+	if (model->HaveUV ()) {
+		GenerateTangents (vertexBuffer, indexBuffer);
+	}
+
+	std::size_t polygonsCount = indexBuffer.size () / 3;
+
+	OptimizeModelBuffers (model->GetName (), modelView, vertexBuffer, indexBuffer);
+
+	ObjectBuffer objectBuffer = SettingsManager::Instance ()->GetValue<bool> ("compact_vertex_format", false) ?
+		BindCompactNormalMapModelVertexData (vertexBuffer, indexBuffer) : BindNormalMapModelVertexData (vertexBuffer, indexBuffer);
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
@@ -337,6 +493,8 @@ Resource<ModelView> RenderSystem::LoadNormalMapModel (const Resource<Model>& mod
 
 Resource<ModelView> RenderSystem::LoadLightMapModel (const Resource<Model>& model)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ModelView>, LoadLightMapModel (model))
+
 	if (Resource<ModelView>::GetResource (model->GetName ()) != nullptr) {
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
@@ -421,42 +579,77 @@ Resource<ModelView> RenderSystem::LoadLightMapModel (const Resource<Model>& mode
 		}
 	}
 
-	ObjectBuffer objectBuffer = BindLightMapModelVertexData (vertexBuffer, indexBuffer);
+	std::size_t polygonsCount = indexBuffer.size () / 3;
+
+	OptimizeModelBuffers (model->GetName (), modelView, vertexBuffer, indexBuffer);
+
+	ObjectBuffer objectBuffer = SettingsManager::Instance ()->GetValue<bool> ("compact_vertex_format", false) ?
+		BindCompactLightMapModelVertexData (vertexBuffer, indexBuffer) : BindLightMapModelVertexData (vertexBuffer, indexBuffer);
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
 	return Resource<ModelView> (modelView, model->GetName ());
 }
 
-Resource<ModelView> RenderSystem::LoadTextGUI (const std::string& text, const Resource<Font>& font)
+Resource<OccluderMesh> RenderSystem::LoadOccluderMesh (const Resource<Model>& model)
 {
-	//TODO: Fix this
-	if (Resource<ModelView>::GetResource ("Text" + text) != nullptr) {
-		return Resource<ModelView>::GetResource ("Text" + text);
+	RENDER_THREAD_INVOKE_RESULT(Resource<OccluderMesh>, LoadOccluderMesh (model))
+
+	if (Resource<OccluderMesh>::GetResource (model->GetName ()) != nullptr) {
+		return Resource<OccluderMesh>::GetResource (model->GetName ());
 	}
 
-	ModelView* modelView = new ModelView ();
+	OccluderMesh* occluderMesh = new OccluderMesh ();
 
 	/*
-	 * Create buffer data
+	 * Keep only positions, occluders are rasterized on CPU
 	*/
 
-	ObjectBuffer objectBuffer = ProcessTextGUI (text, font);
+	std::map<std::size_t, std::size_t> indices;
 
-	modelView->SetObjectBuffer (objectBuffer);
+	for_each_type (ObjectModel*, objModel, *model) {
+		for (PolygonGroup* polyGroup : *objModel) {
+			for (Polygon* polygon : *polyGroup) {
+
+				std::vector<unsigned int> polygonIndices;
+
+				for(std::size_t j=0;j<polygon->VertexCount();j++) {
+
+					std::size_t vertexPos = polygon->GetVertex (j);
+
+					auto indexIt = indices.find (vertexPos);
 
-	GroupBuffer groupBuffer;
-	groupBuffer.INDEX_COUNT = objectBuffer.PolygonsCount * 3;
-	groupBuffer.offset = 0;
+					if (indexIt == indices.end ()) {
+						occluderMesh->vertices.push_back (model->GetVertex (vertexPos));
+
+						indexIt = indices.insert (std::make_pair (vertexPos, occluderMesh->vertices.size () - 1)).first;
+					}
 
-	modelView->AddGroupBuffer (groupBuffer);
+					polygonIndices.push_back (indexIt->second);
+				}
+
+				/*
+				 * Triangulate polygon as a fan
+				*/
 
-	return Resource<ModelView> (modelView, "Text" + text);
+				for (std::size_t j = 2; j < polygonIndices.size (); j++) {
+					occluderMesh->indices.push_back (polygonIndices [0]);
+					occluderMesh->indices.push_back (polygonIndices [j - 1]);
+					occluderMesh->indices.push_back (polygonIndices [j]);
+				}
+			}
+		}
+	}
+
+	return Resource<OccluderMesh> (occluderMesh, model->GetName ());
 }
 
 void RenderSystem::CreateInstanceModelView (Resource<ModelView>& modelView,
 	const std::vector<BufferAttribute>& attributes, std::size_t size, unsigned char* buffer)
 {
+	RENDER_THREAD_INVOKE(CreateInstanceModelView (modelView, attributes, size, buffer))
+
 	unsigned int instanceID;
 
 	GL::GenBuffers(1, &instanceID);
@@ -466,32 +659,51 @@ void RenderSystem::CreateInstanceModelView (Resource<ModelView>& modelView,
 	ObjectBuffer& objectBuffer = modelView->GetObjectBuffer ();
 
 	objectBuffer.VBO_INSTANCE_INDEX = instanceID;
+	objectBuffer.InstanceAttributes = attributes;
 
 	GL::BindVertexArray(objectBuffer.VAO_INDEX);
-	GL::BindBuffer(GL_ARRAY_BUFFER, objectBuffer.VBO_INSTANCE_INDEX);
 
 	for (BufferAttribute attr : attributes) {
 		GL::EnableVertexAttribArray (attr.index);
-
-		if (attr.type == BufferAttribute::AttrType::ATTR_F) {
-			GL::VertexAttribPointer (attr.index, attr.size, GL_FLOAT, GL_FALSE, attr.stride, (void*) attr.pointer);
-		}
 		GL::VertexAttribDivisor (attr.index, 1);
 	}
+
+	BindInstanceAttributes (objectBuffer, objectBuffer.VBO_INSTANCE_INDEX, 0);
 }
 
 void RenderSystem::UpdateInstanceModelView (Resource<ModelView>& modelView, std::size_t size, std::size_t instancesCount, unsigned char* buffer)
 {
+	RENDER_THREAD_INVOKE(UpdateInstanceModelView (modelView, size, instancesCount, buffer))
+
 	ObjectBuffer& objectBuffer = modelView->GetObjectBuffer ();
 
+	objectBuffer.INSTANCES_COUNT = instancesCount;
+
+	/*
+	 * Stream instances through the ring buffer so the write never
+	 * waits for draws of previous frames still reading the data
+	*/
+
+	RingBufferAllocation allocation;
+
+	GL::BindVertexArray(objectBuffer.VAO_INDEX);
+
+	if (PersistentRingBuffer::Upload (GL_ARRAY_BUFFER, buffer, size, allocation) == true) {
+		BindInstanceAttributes (objectBuffer, allocation.buffer, allocation.offset);
+
+		return;
+	}
+
 	GL::BindBuffer(GL_ARRAY_BUFFER, objectBuffer.VBO_INSTANCE_INDEX);
 	GL::BufferSubData(GL_ARRAY_BUFFER, 0, size, buffer);
 
-	objectBuffer.INSTANCES_COUNT = instancesCount;
+	BindInstanceAttributes (objectBuffer, objectBuffer.VBO_INSTANCE_INDEX, 0);
 }
 
 Resource<MaterialView> RenderSystem::LoadMaterial (const Resource<Material>& material)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<MaterialView>, LoadMaterial (material))
+
 	if (material == nullptr) {
 		return nullptr;
 	}
@@ -509,6 +721,8 @@ Resource<MaterialView> RenderSystem::LoadMaterial (const Resource<Material>& mat
 
 Resource<TextureView> RenderSystem::LoadTexture (const Resource<Texture>& texture)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<TextureView>, LoadTexture (texture))
+
 	if (texture.GetPath () != std::string () &&
 		Resource<TextureView>::GetResource (texture.GetPath ()) != nullptr) {
 		return Resource<TextureView>::GetResource (texture.GetPath ());
@@ -528,6 +742,8 @@ Resource<TextureView> RenderSystem::LoadTexture (const Resource<Texture>& textur
 
 Resource<TextureView> RenderSystem::LoadCubeMap (const Resource<Texture>& texture)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<TextureView>, LoadCubeMap (texture))
+
 	if (Resource<TextureView>::GetResource (texture->GetName ()) != nullptr) {
 		return Resource<TextureView>::GetResource (texture->GetName ());
 	}
@@ -545,6 +761,8 @@ Resource<TextureView> RenderSystem::LoadCubeMap (const Resource<Texture>& textur
 
 Resource<TextureView> RenderSystem::LoadTextureLUT (const Resource<Texture>& texture)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<TextureView>, LoadTextureLUT (texture))
+
 	if (Resource<TextureView>::GetResource (texture->GetName ()) != nullptr) {
 		return Resource<TextureView>::GetResource (texture->GetName ());
 	}
@@ -562,6 +780,8 @@ Resource<TextureView> RenderSystem::LoadTextureLUT (const Resource<Texture>& tex
 
 Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ShaderView>, LoadShader (shader))
+
 	if (Resource<ShaderView>::GetResource (shader->GetName ()) != nullptr) {
 		return Resource<ShaderView>::GetResource (shader->GetName ());
 	}
@@ -574,10 +794,16 @@ Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 	 * Compile and attach vertex shader
 	*/
 
+	std::vector<unsigned int> shaderIDs;
+	std::vector<std::string> filenames;
+
 	GLuint vertexShaderID = BuildShaderContent (drawingShader->GetVertexShaderContent (), GL_VERTEX_SHADER);
 
 	GL::AttachShader (program, vertexShaderID);
 
+	shaderIDs.push_back (vertexShaderID);
+	filenames.push_back (drawingShader->GetVertexShaderContent ()->GetFilename ());
+
 	/*
 	 * Compile and attach fragment shader
 	*/
@@ -586,6 +812,9 @@ Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 
 	GL::AttachShader (program, fragmentShaderID);
 
+	shaderIDs.push_back (fragmentShaderID);
+	filenames.push_back (drawingShader->GetFragmentShaderContent ()->GetFilename ());
+
 	/*
 	 * Compile and attach geometry shader if exists
 	*/
@@ -594,9 +823,16 @@ Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 		unsigned int geometryShaderID = BuildShaderContent (drawingShader->GetGeometryShaderContent (), GL_GEOMETRY_SHADER);
 
 		GL::AttachShader (program, geometryShaderID);
+
+		shaderIDs.push_back (geometryShaderID);
+		filenames.push_back (drawingShader->GetGeometryShaderContent ()->GetFilename ());
 	}
 
-	GL::LinkProgram (program);
+	/*
+	 * Link now, or with the rest of the batch being warmed up
+	*/
+
+	ShaderCompiler::SubmitProgram (program, shaderIDs, filenames);
 
 	ShaderView* shaderView = new ShaderView (program);
 
@@ -605,6 +841,8 @@ Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 
 Resource<ShaderView> RenderSystem::LoadComputeShader (const Resource<Shader>& shader)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<ShaderView>, LoadComputeShader (shader))
+
 	const ComputeShader* computeShader = dynamic_cast<const ComputeShader*> (&*shader);
 
 	unsigned int program = GL::CreateProgram();
@@ -617,7 +855,8 @@ Resource<ShaderView> RenderSystem::LoadComputeShader (const Resource<Shader>& sh
 
 	GL::AttachShader (program, computeShaderID);
 
-	GL::LinkProgram(program);
+	ShaderCompiler::SubmitProgram (program, { computeShaderID },
+		{ computeShader->GetComputeShaderContent ()->GetFilename () });
 
 	ShaderView* shaderView = new ShaderView (program);
 
@@ -626,6 +865,8 @@ Resource<ShaderView> RenderSystem::LoadComputeShader (const Resource<Shader>& sh
 
 Resource<FramebufferView> RenderSystem::LoadFramebuffer (const Resource<Framebuffer>& framebuffer)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<FramebufferView>, LoadFramebuffer (framebuffer))
+
 	unsigned int gpuIndex = 0;
 	std::vector<Resource<TextureView>> textureViews;
 	Resource<TextureView> depthTextureView = nullptr;
@@ -700,6 +941,8 @@ Resource<FramebufferView> RenderSystem::LoadFramebuffer (const Resource<Framebuf
 
 Resource<Texture> RenderSystem::SaveTexture (const Resource<TextureView>& textureView)
 {
+	RENDER_THREAD_INVOKE_RESULT(Resource<Texture>, SaveTexture (textureView))
+
 	//TODO: Extend this
 	Texture* texture = new Texture ("temp");
 
@@ -742,7 +985,7 @@ ObjectBuffer RenderSystem::BindModelVertexData (const std::vector<VertexData>& v
 	//creeaza ibo
 	GL::GenBuffers(1, &IBO);
 	GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int)*iBuf.size(), iBuf.data(), GL_STATIC_DRAW);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
 	
 	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
 	// metoda cea mai buna, specificare explicita prin qualificator layout)
@@ -757,6 +1000,7 @@ ObjectBuffer RenderSystem::BindModelVertexData (const std::vector<VertexData>& v
 	objectBuffer.VAO_INDEX = VAO;
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
@@ -781,7 +1025,7 @@ ObjectBuffer RenderSystem::BindAnimationModelVertexData (const std::vector<Anima
 	//creeaza ibo
 	GL::GenBuffers(1, &IBO);
 	GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int)*iBuf.size(), &iBuf[0], GL_STATIC_DRAW);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
 	
 	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
 	// metoda cea mai buna, specificare explicita prin qualificator layout)
@@ -800,6 +1044,7 @@ ObjectBuffer RenderSystem::BindAnimationModelVertexData (const std::vector<Anima
 	objectBuffer.VAO_INDEX = VAO;
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
@@ -824,7 +1069,7 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
 	//creeaza ibo
 	GL::GenBuffers (1, &IBO);
 	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned int)*iBuf.size (), &iBuf [0], GL_STATIC_DRAW);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
 
 	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
 	// metoda cea mai buna, specificare explicita prin qualificator layout)
@@ -835,12 +1080,13 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
 	GL::EnableVertexAttribArray (2);																			//activare pipe 2
 	GL::VertexAttribPointer (2, 2, GL_FLOAT, GL_FALSE, sizeof (NormalMapVertexData), (void*) (sizeof (float) * 6));	//trimite texcoorduri pe pipe 2
 	GL::EnableVertexAttribArray (3);																			//activare pipe 2
-	GL::VertexAttribPointer (3, 3, GL_FLOAT, GL_FALSE, sizeof (NormalMapVertexData), (void*) (sizeof (float) * 8));	//trimite texcoorduri pe pipe 2
+	GL::VertexAttribPointer (3, 4, GL_FLOAT, GL_FALSE, sizeof (NormalMapVertexData), (void*) (sizeof (float) * 8));	//trimite texcoorduri pe pipe 2
 
 	ObjectBuffer objectBuffer;
 	objectBuffer.VAO_INDEX = VAO;
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
@@ -849,71 +1095,177 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
 	return objectBuffer;
 }
 
-/*
- * Thanks to: http://www.opengl-tutorial.org/intermediate-tutorials/tutorial-13-normal-mapping/
- *
- * Calculate vertex tangent based on explanation from the link above;
-*/
-
-glm::vec3 RenderSystem::CalculateTangent (const Resource<Model>& model, Polygon* poly)
+template <class T>
+void RenderSystem::OptimizeModelBuffers (const std::string& name, ModelView* modelView, std::vector<T>& vertexBuffer, std::vector<unsigned int>& indexBuffer)
 {
-	/*
-	 * Tangents are generated only when texcoords are present
-	*/
+	std::vector<glm::vec3> positions = GetPositions (vertexBuffer);
 
-	if (!model->HaveUV ()) {
-		return glm::vec3 (0.0f);
-	}
+	float lastACMR = MeshOptimization::GetACMR (indexBuffer, vertexBuffer.size ());
+	float lastATVR = MeshOptimization::GetATVR (indexBuffer, vertexBuffer.size ());
 
 	/*
-	 * Get vertices
+	 * Reorder triangles of every group for vertex cache and overdraw
 	*/
 
-	glm::vec3 v0 = model->GetVertex(poly->GetVertex (0));
-	glm::vec3 v1 = model->GetVertex(poly->GetVertex (1));
-	glm::vec3 v2 = model->GetVertex(poly->GetVertex (2));
+	OptimizeGroupBuffers (std::vector<GroupBuffer> (modelView->begin (), modelView->end ()), positions, indexBuffer);
 
-	/*
-	 * Get texcoords
-	*/
+	float ACMR = MeshOptimization::GetACMR (indexBuffer, vertexBuffer.size ());
+	float ATVR = MeshOptimization::GetATVR (indexBuffer, vertexBuffer.size ());
 
-	glm::vec2 uv0 = model->GetTexcoord(poly->GetTexcoord (0));
-	glm::vec2 uv1 = model->GetTexcoord (poly->GetTexcoord (1));
-	glm::vec2 uv2 = model->GetTexcoord (poly->GetTexcoord (2));
+	Console::Log ("Optimized \"" + name + "\" ACMR: " + std::to_string (lastACMR) + " -> " + std::to_string (ACMR) +
+		", ATVR: " + std::to_string (lastATVR) + " -> " + std::to_string (ATVR));
 
 	/*
-	 * Edges of the triangle : postion delta
+	 * Simplify the optimized model
 	*/
 
-	glm::vec3 deltaPos1 = v1 - v0;
-	glm::vec3 deltaPos2 = v2 - v0;
+	GenerateLevelsOfDetail (modelView, positions, indexBuffer);
 
 	/*
-	 * UV delta
+	 * Reorder vertices in order of first use for vertex fetch locality
 	*/
 
-	glm::vec2 deltaUV1 = uv1 - uv0;
-	glm::vec2 deltaUV2 = uv2 - uv0;
+	std::vector<unsigned int> remap = MeshOptimization::OptimizeVertexFetch (indexBuffer, vertexBuffer.size ());
 
+	std::vector<T> remappedVertexBuffer (vertexBuffer.size ());
+
+	for (std::size_t index = 0; index < vertexBuffer.size (); index ++) {
+		remappedVertexBuffer [remap [index]] = vertexBuffer [index];
+	}
+
+	vertexBuffer.swap (remappedVertexBuffer);
+}
+
+void RenderSystem::OptimizeGroupBuffers (const std::vector<GroupBuffer>& groupBuffers, const std::vector<glm::vec3>& positions, std::vector<unsigned int>& indexBuffer)
+{
+	for (const GroupBuffer& groupBuffer : groupBuffers) {
+		std::vector<unsigned int> groupIndices (indexBuffer.begin () + groupBuffer.offset,
+			indexBuffer.begin () + groupBuffer.offset + groupBuffer.INDEX_COUNT);
+
+		groupIndices = MeshOptimization::OptimizeVertexCache (groupIndices, positions.size ());
+		groupIndices = MeshOptimization::OptimizeOverdraw (groupIndices, positions, 1.05f);
+
+		std::copy (groupIndices.begin (), groupIndices.end (), indexBuffer.begin () + groupBuffer.offset);
+	}
+}
+
+void RenderSystem::GenerateLevelsOfDetail (ModelView* modelView, const std::vector<glm::vec3>& positions, std::vector<unsigned int>& indexBuffer)
+{
 	/*
-	 * "Here is the algorithm : if we note deltaPos1 and deltaPos2 two edges of
-	 * our triangle, and deltaUV1 and deltaUV2 the corresponding differences in
-	 * UVs, we can express our problem with the following equation :
-	 *
-	 * deltaPos1 = deltaUV1.x * T + deltaUV1.y * B
-	 * deltaPos2 = deltaUV2.x * T + deltaUV2.y * B
-	 *
-	 * Just solve this system for T and B, and you have your vectors !
+	 * Each level halves the triangles of the previous one. Simplified
+	 * indices are appended to the same index buffer.
 	*/
 
-	float r = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x);
-	glm::vec3 tangent = (deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y) * r;
+	std::vector<GroupBuffer> groupBuffers (modelView->begin (), modelView->end ());
+
+	std::size_t lastIndicesCount = indexBuffer.size ();
+
+	for (std::size_t level = 1; level < MAX_LEVELS_OF_DETAIL; level ++) {
+		LevelOfDetail levelOfDetail;
+
+		std::size_t startIndex = indexBuffer.size ();
+
+		for (const GroupBuffer& groupBuffer : groupBuffers) {
+			std::vector<unsigned int> groupIndices (indexBuffer.begin () + groupBuffer.offset,
+				indexBuffer.begin () + groupBuffer.offset + groupBuffer.INDEX_COUNT);
+
+			std::vector<unsigned int> simplifiedIndices = MeshSimplification::Simplify (positions,
+				groupIndices, groupIndices.size () / 6 * 3);
+
+			GroupBuffer levelGroupBuffer;
+
+			levelGroupBuffer.materialView = groupBuffer.materialView;
+			levelGroupBuffer.offset = indexBuffer.size ();
+			levelGroupBuffer.INDEX_COUNT = simplifiedIndices.size ();
+
+			indexBuffer.insert (indexBuffer.end (), simplifiedIndices.begin (), simplifiedIndices.end ());
+
+			levelOfDetail.groupBuffers.push_back (levelGroupBuffer);
+		}
+
+		std::size_t indicesCount = indexBuffer.size () - startIndex;
+
+		/*
+		 * Stop when mesh cannot be simplified further, mostly because
+		 * of locked borders
+		*/
+
+		if (indicesCount > lastIndicesCount * 0.9f) {
+			indexBuffer.resize (startIndex);
+			break;
+		}
+
+		levelOfDetail.PolygonsCount = indicesCount / 3;
+
+		OptimizeGroupBuffers (levelOfDetail.groupBuffers, positions, indexBuffer);
 
+		modelView->AddLevelOfDetail (levelOfDetail);
+
+		groupBuffers = levelOfDetail.groupBuffers;
+		lastIndicesCount = indicesCount;
+	}
+}
+
+/*
+ * Upload indices as 16 bits when every vertex can be addressed
+*/
+
+unsigned int RenderSystem::BindIndexData (const std::vector<unsigned int>& iBuf, std::size_t verticesCount)
+{
+	if (verticesCount <= 0xFFFF) {
+		std::vector<unsigned short> shortIndices (iBuf.begin (), iBuf.end ());
+
+		GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned short) * shortIndices.size (), shortIndices.data (), GL_STATIC_DRAW);
+
+		return GL_UNSIGNED_SHORT;
+	}
+
+	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned int) * iBuf.size (), iBuf.data (), GL_STATIC_DRAW);
+
+	return GL_UNSIGNED_INT;
+}
+
+void RenderSystem::BindInstanceAttributes (const ObjectBuffer& objectBuffer, unsigned int buffer, std::size_t offset)
+{
 	/*
-	 * Return the tangent
+	 * Vertex array has to be bound already
 	*/
 
-	return glm::normalize (tangent);
+	GL::BindBuffer(GL_ARRAY_BUFFER, buffer);
+
+	for (const BufferAttribute& attr : objectBuffer.InstanceAttributes) {
+		if (attr.type == BufferAttribute::AttrType::ATTR_F) {
+			GL::VertexAttribPointer (attr.index, attr.size, GL_FLOAT, GL_FALSE, attr.stride, (void*) (offset + attr.pointer));
+		}
+	}
+}
+
+/*
+ * Accumulate tangents over the shared vertices, so every vertex gets the
+ * same tangent whatever the order of its triangles
+*/
+
+void RenderSystem::GenerateTangents (std::vector<NormalMapVertexData>& vertexBuffer, const std::vector<unsigned int>& indexBuffer)
+{
+	std::vector<glm::vec3> positions = GetPositions (vertexBuffer);
+	std::vector<glm::vec3> normals;
+	std::vector<glm::vec2> texcoords;
+
+	normals.reserve (vertexBuffer.size ());
+	texcoords.reserve (vertexBuffer.size ());
+
+	for (const NormalMapVertexData& vertexData : vertexBuffer) {
+		normals.push_back (glm::vec3 (vertexData.normal [0], vertexData.normal [1], vertexData.normal [2]));
+		texcoords.push_back (glm::vec2 (vertexData.texcoord [0], vertexData.texcoord [1]));
+	}
+
+	std::vector<glm::vec4> tangents = TangentSpaceGeneration::Generate (positions, normals, texcoords, indexBuffer);
+
+	for (std::size_t index = 0; index < vertexBuffer.size (); index ++) {
+		for (std::size_t i = 0; i < 4; i++) {
+			vertexBuffer [index].tangent [i] = tangents [index] [i];
+		}
+	}
 }
 
 ObjectBuffer RenderSystem::BindLightMapModelVertexData (const std::vector<LightMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
@@ -932,7 +1284,7 @@ ObjectBuffer RenderSystem::BindLightMapModelVertexData (const std::vector<LightM
 	//creeaza ibo
 	GL::GenBuffers (1, &IBO);
 	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned int)*iBuf.size (), &iBuf [0], GL_STATIC_DRAW);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
 
 	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
 	// metoda cea mai buna, specificare explicita prin qualificator layout)
@@ -949,6 +1301,7 @@ ObjectBuffer RenderSystem::BindLightMapModelVertexData (const std::vector<LightM
 	objectBuffer.VAO_INDEX = VAO;
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
@@ -957,100 +1310,215 @@ ObjectBuffer RenderSystem::BindLightMapModelVertexData (const std::vector<LightM
 	return objectBuffer;
 }
 
-ObjectBuffer RenderSystem::ProcessTextGUI (const std::string& text, const Resource<Font>& font)
+/*
+ * Compact layouts are decoded by the vertex fetch, so the shaders
+ * receive the same attributes as for the float layouts
+*/
+
+ObjectBuffer RenderSystem::BindCompactModelVertexData (const std::vector<VertexData>& vBuf, const std::vector<unsigned int>& iBuf)
 {
-	std::vector<TextGUIVertexData> vertexBuffer;
-	std::vector<unsigned int> indexBuffer;
+	glm::mat4 dequantizationMatrix = GetDequantizationMatrix (vBuf);
+	glm::mat4 quantizationMatrix = glm::inverse (dequantizationMatrix);
 
-	glm::vec2 screenPos (0.0f);
+	std::vector<CompactVertexData> compactBuffer (vBuf.size ());
 
-	Resource<Texture> texture = font->GetTexture (0);
+	for (std::size_t i = 0; i < vBuf.size (); i++) {
+		CompactVertex (vBuf [i], quantizationMatrix, compactBuffer [i]);
+	}
 
-	for (std::size_t i=0;i<text.size ();i++) {
-		TextGUIVertexData vertexData;
+	unsigned int VAO, VBO, IBO;
 
-		FontChar* ch = font->GetChar (text [i]);
+	GL::GenVertexArrays (1, &VAO);
+	GL::BindVertexArray (VAO);
 
-		glm::vec2 texSize (texture->GetSize ().width, texture->GetSize ().height);
-		glm::vec2 scale = (glm::vec2) ch->GetSize ();
-		glm::vec2 offset = glm::vec2(ch->GetOffset ().x, -ch->GetOffset ().y);
+	GL::GenBuffers (1, &VBO);
+	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
+	GL::BufferData (GL_ARRAY_BUFFER, sizeof (CompactVertexData) * compactBuffer.size (), compactBuffer.data (), GL_STATIC_DRAW);
 
-		glm::vec2 upLeft = screenPos + offset;
-		glm::vec2 tUpLeft = ((glm::vec2) ch->GetPosition ()) / texSize;
+	GL::GenBuffers (1, &IBO);
+	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
 
-		vertexData.position [0] = upLeft.x; vertexData.position [1] = upLeft.y;
-		vertexData.texcoord [0] = tUpLeft.x; vertexData.texcoord [1] = tUpLeft.y;
+	GL::EnableVertexAttribArray (0);
+	GL::VertexAttribPointer (0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof (CompactVertexData), (void*) 0);
+	GL::EnableVertexAttribArray (1);
+	GL::VertexAttribPointer (1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof (CompactVertexData), (void*) (sizeof (unsigned short) * 4));
+	GL::EnableVertexAttribArray (2);
+	GL::VertexAttribPointer (2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof (CompactVertexData), (void*) (sizeof (unsigned short) * 4 + sizeof (unsigned int)));
 
-		vertexBuffer.push_back (vertexData);
+	ObjectBuffer objectBuffer;
+	objectBuffer.VAO_INDEX = VAO;
+	objectBuffer.VBO_INDEX = VBO;
+	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
+	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.DequantizationMatrix = dequantizationMatrix;
 
-		glm::vec2 upRight = screenPos + glm::vec2 (scale.x, 0) + offset;
-		glm::vec2 tUpRight = tUpLeft + (glm::vec2 (ch->GetSize ().x, 0)) / texSize;
+	objectBuffer.VerticesCount = vBuf.size ();
+	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
-		vertexData.position [0] = upRight.x; vertexData.position [1] = upRight.y;
-		vertexData.texcoord [0] = tUpRight.x; vertexData.texcoord [1] = tUpRight.y;
+	return objectBuffer;
+}
 
-		vertexBuffer.push_back (vertexData);
+ObjectBuffer RenderSystem::BindCompactAnimationModelVertexData (const std::vector<AnimatedVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
+{
+	std::vector<CompactAnimatedVertexData> compactBuffer (vBuf.size ());
 
-		glm::vec2 downLeft = screenPos + glm::vec2 (0, -scale.y) + offset;
-		glm::vec2 tDownLeft = tUpLeft + (glm::vec2 (0, ch->GetSize ().y)) / texSize;
+	for (std::size_t i = 0; i < vBuf.size (); i++) {
+		for (std::size_t j = 0; j < 3; j++) {
+			compactBuffer [i].position [j] = vBuf [i].position [j];
+		}
 
-		vertexData.position [0] = downLeft.x; vertexData.position [1] = downLeft.y;
-		vertexData.texcoord [0] = tDownLeft.x; vertexData.texcoord [1] = tDownLeft.y;
+		compactBuffer [i].normal = PackDirection (vBuf [i].normal);
 
-		vertexBuffer.push_back (vertexData);
+		compactBuffer [i].texcoord [0] = glm::packHalf1x16 (vBuf [i].texcoord [0]);
+		compactBuffer [i].texcoord [1] = glm::packHalf1x16 (vBuf [i].texcoord [1]);
 
-		glm::vec2 downRight = screenPos + glm::vec2 (scale.x, -scale.y) + offset;
-		glm::vec2 tDownRight = tDownLeft + (glm::vec2 (ch->GetSize ().x, 0)) / texSize;
+		/*
+		 * Shaders address at most 253 bones
+		*/
 
-		vertexData.position [0] = downRight.x; vertexData.position [1] = downRight.y;
-		vertexData.texcoord [0] = tDownRight.x; vertexData.texcoord [1] = tDownRight.y;
+		for (std::size_t j = 0; j < 4; j++) {
+			compactBuffer [i].bones [j] = (unsigned char) glm::clamp (vBuf [i].bones [j], 0, 255);
+		}
 
-		vertexBuffer.push_back (vertexData);
+		PackWeights (vBuf [i].weights, compactBuffer [i].weights);
+	}
 
-		unsigned int iUpLeft = (unsigned int) i * 4, iUpRight = (unsigned int) i * 4 + 1,
-			iDownLeft = (unsigned int) i * 4 + 2, iDownRight = (unsigned int) i * 4 + 3;
+	unsigned int VAO, VBO, IBO;
 
-		indexBuffer.push_back (iUpLeft); indexBuffer.push_back (iDownLeft); indexBuffer.push_back (iUpRight);
-		indexBuffer.push_back (iUpRight); indexBuffer.push_back (iDownLeft); indexBuffer.push_back (iDownRight);
+	GL::GenVertexArrays (1, &VAO);
+	GL::BindVertexArray (VAO);
 
-		screenPos.x += ch->GetXAdvance ();
-	}	
+	GL::GenBuffers (1, &VBO);
+	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
+	GL::BufferData (GL_ARRAY_BUFFER, sizeof (CompactAnimatedVertexData) * compactBuffer.size (), compactBuffer.data (), GL_STATIC_DRAW);
 
-	ObjectBuffer objectBuffer = BindTextGUIVertexData (vertexBuffer, indexBuffer);
+	GL::GenBuffers (1, &IBO);
+	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
+
+	GL::EnableVertexAttribArray (0);
+	GL::VertexAttribPointer (0, 3, GL_FLOAT, GL_FALSE, sizeof (CompactAnimatedVertexData), (void*) 0);
+	GL::EnableVertexAttribArray (1);
+	GL::VertexAttribPointer (1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof (CompactAnimatedVertexData), (void*) (sizeof (float) * 3));
+	GL::EnableVertexAttribArray (2);
+	GL::VertexAttribPointer (2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof (CompactAnimatedVertexData), (void*) (sizeof (float) * 3 + sizeof (unsigned int)));
+	GL::EnableVertexAttribArray (3);
+	GL::VertexAttribIPointer (3, 4, GL_UNSIGNED_BYTE, sizeof (CompactAnimatedVertexData), (void*) (sizeof (float) * 3 + sizeof (unsigned int) * 2));
+	GL::EnableVertexAttribArray (4);
+	GL::VertexAttribPointer (4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof (CompactAnimatedVertexData), (void*) (sizeof (float) * 3 + sizeof (unsigned int) * 3));
+
+	ObjectBuffer objectBuffer;
+	objectBuffer.VAO_INDEX = VAO;
+	objectBuffer.VBO_INDEX = VBO;
+	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
+	objectBuffer.VBO_INSTANCE_INDEX = 0;
+
+	objectBuffer.VerticesCount = vBuf.size ();
+	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
 	return objectBuffer;
 }
 
-ObjectBuffer RenderSystem::BindTextGUIVertexData (const std::vector<TextGUIVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
+ObjectBuffer RenderSystem::BindCompactNormalMapModelVertexData (const std::vector<NormalMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
 {
+	glm::mat4 dequantizationMatrix = GetDequantizationMatrix (vBuf);
+	glm::mat4 quantizationMatrix = glm::inverse (dequantizationMatrix);
+
+	std::vector<CompactNormalMapVertexData> compactBuffer (vBuf.size ());
+
+	for (std::size_t i = 0; i < vBuf.size (); i++) {
+		CompactVertex (vBuf [i], quantizationMatrix, compactBuffer [i]);
+
+		compactBuffer [i].tangent = glm::packSnorm3x10_1x2 (glm::vec4 (vBuf [i].tangent [0],
+			vBuf [i].tangent [1], vBuf [i].tangent [2], vBuf [i].tangent [3]));
+	}
+
 	unsigned int VAO, VBO, IBO;
 
-	//creaza vao
-	GL::GenVertexArrays(1 , &VAO);
-	GL::BindVertexArray(VAO);
+	GL::GenVertexArrays (1, &VAO);
+	GL::BindVertexArray (VAO);
 
-	//creeaza vbo
-	GL::GenBuffers(1, &VBO);
-	GL::BindBuffer(GL_ARRAY_BUFFER, VBO);
-	GL::BufferData(GL_ARRAY_BUFFER, sizeof(TextGUIVertexData)*vBuf.size(), vBuf.data(), GL_STATIC_DRAW);
-	
-	//creeaza ibo
-	GL::GenBuffers(1, &IBO);
-	GL::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int)*iBuf.size(), iBuf.data(), GL_STATIC_DRAW);
-	
-	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
-	// metoda cea mai buna, specificare explicita prin qualificator layout)
-	GL::EnableVertexAttribArray(0);																	//activare pipe 0
-	GL::VertexAttribPointer(0,2,GL_FLOAT,GL_FALSE,sizeof(TextGUIVertexData),(void*)0);						//trimite pozitii pe pipe 0
-	GL::EnableVertexAttribArray(1);																	//activare pipe 1
-	GL::VertexAttribPointer(1,2,GL_FLOAT,GL_FALSE,sizeof(TextGUIVertexData),(void*)(sizeof(float) * 2));		//trimite normale pe pipe 1
+	GL::GenBuffers (1, &VBO);
+	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
+	GL::BufferData (GL_ARRAY_BUFFER, sizeof (CompactNormalMapVertexData) * compactBuffer.size (), compactBuffer.data (), GL_STATIC_DRAW);
+
+	GL::GenBuffers (1, &IBO);
+	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
+
+	GL::EnableVertexAttribArray (0);
+	GL::VertexAttribPointer (0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof (CompactNormalMapVertexData), (void*) 0);
+	GL::EnableVertexAttribArray (1);
+	GL::VertexAttribPointer (1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof (CompactNormalMapVertexData), (void*) (sizeof (unsigned short) * 4));
+	GL::EnableVertexAttribArray (2);
+	GL::VertexAttribPointer (2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof (CompactNormalMapVertexData), (void*) (sizeof (unsigned short) * 4 + sizeof (unsigned int)));
+	GL::EnableVertexAttribArray (3);
+	GL::VertexAttribPointer (3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof (CompactNormalMapVertexData), (void*) sizeof (CompactVertexData));
 
 	ObjectBuffer objectBuffer;
 	objectBuffer.VAO_INDEX = VAO;
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.DequantizationMatrix = dequantizationMatrix;
+
+	objectBuffer.VerticesCount = vBuf.size ();
+	objectBuffer.PolygonsCount = iBuf.size () / 3;
+
+	return objectBuffer;
+}
+
+ObjectBuffer RenderSystem::BindCompactLightMapModelVertexData (const std::vector<LightMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
+{
+	glm::mat4 dequantizationMatrix = GetDequantizationMatrix (vBuf);
+	glm::mat4 quantizationMatrix = glm::inverse (dequantizationMatrix);
+
+	std::vector<CompactLightMapVertexData> compactBuffer (vBuf.size ());
+
+	for (std::size_t i = 0; i < vBuf.size (); i++) {
+		CompactVertex (vBuf [i], quantizationMatrix, compactBuffer [i]);
+
+		/*
+		 * Light map texcoords are always in unit range
+		*/
+
+		compactBuffer [i].lmTexcoord [0] = PackUnorm16 (vBuf [i].lmTexcoord [0]);
+		compactBuffer [i].lmTexcoord [1] = PackUnorm16 (vBuf [i].lmTexcoord [1]);
+	}
+
+	unsigned int VAO, VBO, IBO;
+
+	GL::GenVertexArrays (1, &VAO);
+	GL::BindVertexArray (VAO);
+
+	GL::GenBuffers (1, &VBO);
+	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
+	GL::BufferData (GL_ARRAY_BUFFER, sizeof (CompactLightMapVertexData) * compactBuffer.size (), compactBuffer.data (), GL_STATIC_DRAW);
+
+	GL::GenBuffers (1, &IBO);
+	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
+	unsigned int indexType = BindIndexData (iBuf, vBuf.size ());
+
+	GL::EnableVertexAttribArray (0);
+	GL::VertexAttribPointer (0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof (CompactLightMapVertexData), (void*) 0);
+	GL::EnableVertexAttribArray (1);
+	GL::VertexAttribPointer (1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof (CompactLightMapVertexData), (void*) (sizeof (unsigned short) * 4));
+	GL::EnableVertexAttribArray (2);
+	GL::VertexAttribPointer (2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof (CompactLightMapVertexData), (void*) (sizeof (unsigned short) * 4 + sizeof (unsigned int)));
+	GL::EnableVertexAttribArray (3);
+	GL::VertexAttribPointer (3, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof (CompactLightMapVertexData), (void*) sizeof (CompactVertexData));
+
+	ObjectBuffer objectBuffer;
+	objectBuffer.VAO_INDEX = VAO;
+	objectBuffer.VBO_INDEX = VBO;
+	objectBuffer.IBO_INDEX = IBO;
+	objectBuffer.INDEX_TYPE = indexType;
+	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.DequantizationMatrix = dequantizationMatrix;
 
 	objectBuffer.VerticesCount = vBuf.size ();
 	objectBuffer.PolygonsCount = iBuf.size () / 3;
@@ -1158,9 +1626,15 @@ unsigned int RenderSystem::LoadTextureGPU (const Resource<Texture>& texture)
 		case FORMAT_RGBA8:
 			sizedInternalFormat = GL_RGBA8;
 			break;
+		case FORMAT_RGBA16:
+			sizedInternalFormat = GL_RGBA16F;
+			break;
 		case FORMAT_RGBA32:
 			sizedInternalFormat = GL_RGBA32F;
 			break;
+		case FORMAT_R11G11B10F:
+			sizedInternalFormat = GL_R11F_G11F_B10F;
+			break;
 		case FORMAT_DEPTH16:
 			sizedInternalFormat = GL_DEPTH_COMPONENT16;
 			break;
@@ -1416,31 +1890,5 @@ unsigned int RenderSystem::BuildShaderContent (const Resource<ShaderContent>& sh
 	GL::ShaderSource (shaderID, 1, &csource, NULL);
 	GL::CompileShader (shaderID);
 
-	ShaderErrorCheck (shaderID);
-
 	return shaderID;
 }
-
-bool RenderSystem::ShaderErrorCheck (unsigned int shader)
-{
-	int isCompiled;
-	GL::GetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-
-	if(isCompiled == GL_FALSE) {
-		int maxLength = 0;
-		GL::GetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-
-		// The maxLength includes the NULL character
-		std::vector<GLchar> errorLog(maxLength);
-		GL::GetShaderInfoLog(shader, maxLength, &maxLength, &errorLog[0]);
-
-		std::string error(errorLog.begin(), errorLog.end());
-		Console::LogError (error);
-
-		GL::DeleteShader(shader); // Don't leak the shader.
-
-		return false;
-	}
-
-	return true;
-}
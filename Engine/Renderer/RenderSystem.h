@@ -20,6 +20,7 @@
 #include "Fonts/Font.h"
 
 #include "Renderer/BufferAttribute.h"
+#include "Renderer/OccluderMesh.h"
 
 struct VertexData
 {
@@ -40,7 +41,7 @@ struct AnimatedVertexData : VertexData
 
 struct NormalMapVertexData : VertexData
 {
-	float tangent [3];
+	float tangent [4];
 
 	NormalMapVertexData ();
 };
@@ -52,12 +53,48 @@ struct LightMapVertexData : VertexData
 	LightMapVertexData ();
 };
 
-struct TextGUIVertexData
+/*
+ * Compact vertex layouts. Positions are quantized against the mesh
+ * bounding box, normals and tangents are packed as signed 10:10:10:2
+ * and texcoords are stored as half floats.
+*/
+
+struct CompactVertexData
 {
-	float position[2];
-	float texcoord[2];
+	unsigned short position[4];
+	unsigned int normal;
+	unsigned short texcoord[2];
+
+	CompactVertexData ();
+};
+
+/*
+ * Skinning is done in model space, so positions stay as floats
+*/
+
+struct CompactAnimatedVertexData
+{
+	float position[3];
+	unsigned int normal;
+	unsigned short texcoord[2];
+	unsigned char bones[4];
+	unsigned char weights[4];
+
+	CompactAnimatedVertexData ();
+};
 
-	TextGUIVertexData ();
+struct CompactNormalMapVertexData : CompactVertexData
+{
+	unsigned int tangent;
+
+	CompactNormalMapVertexData ();
+};
+
+struct CompactLightMapVertexData : CompactVertexData
+{
+	unsigned short lmTexcoord[2];
+
+	CompactLightMapVertexData ();
 };
 
 class ENGINE_API RenderSystem
@@ -67,7 +104,7 @@ public:
 	static Resource<ModelView> LoadAnimationModel (const Resource<Model>& model);
 	static Resource<ModelView> LoadNormalMapModel (const Resource<Model>& model);
 	static Resource<ModelView> LoadLightMapModel (const Resource<Model>& model);
-	static Resource<ModelView> LoadTextGUI (const std::string& text, const Resource<Font>& font);
+	static Resource<OccluderMesh> LoadOccluderMesh (const Resource<Model>& model);
 
 	static void CreateInstanceModelView (Resource<ModelView>& modelView, const std::vector<BufferAttribute>& attributes, std::size_t size, unsigned char* buffer = nullptr);
 	static void UpdateInstanceModelView (Resource<ModelView>& modelView, std::size_t size, std::size_t instancesCount, unsigned char* buffer);
@@ -90,10 +127,22 @@ private:
 	static ObjectBuffer BindNormalMapModelVertexData (const std::vector<NormalMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
 	static ObjectBuffer BindLightMapModelVertexData (const std::vector<LightMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
 
-	static glm::vec3 CalculateTangent (const Resource<Model>& model, Polygon* poly);
+	static ObjectBuffer BindCompactModelVertexData (const std::vector<VertexData>& vBuf, const std::vector<unsigned int>& iBuf);
+	static ObjectBuffer BindCompactAnimationModelVertexData (const std::vector<AnimatedVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
+	static ObjectBuffer BindCompactNormalMapModelVertexData (const std::vector<NormalMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
+	static ObjectBuffer BindCompactLightMapModelVertexData (const std::vector<LightMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
+
+	static void GenerateTangents (std::vector<NormalMapVertexData>& vertexBuffer, const std::vector<unsigned int>& indexBuffer);
+
+	template <class T>
+	static void OptimizeModelBuffers (const std::string& name, ModelView* modelView, std::vector<T>& vertexBuffer, std::vector<unsigned int>& indexBuffer);
+	static void OptimizeGroupBuffers (const std::vector<GroupBuffer>& groupBuffers, const std::vector<glm::vec3>& positions, std::vector<unsigned int>& indexBuffer);
+	static void GenerateLevelsOfDetail (ModelView* modelView, const std::vector<glm::vec3>& positions, std::vector<unsigned int>& indexBuffer);
+
+	static unsigned int BindIndexData (const std::vector<unsigned int>& iBuf, std::size_t verticesCount);
+
+	static void BindInstanceAttributes (const ObjectBuffer& objectBuffer, unsigned int buffer, std::size_t offset);
 
-	static ObjectBuffer ProcessTextGUI (const std::string& text, const Resource<Font>& font);
-	static ObjectBuffer BindTextGUIVertexData (const std::vector<TextGUIVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
 
 	static void ProcessMaterial (const Resource<Material>& material, MaterialView* materialView);
 
@@ -102,7 +151,6 @@ private:
 	static unsigned int LoadTextureLUTGPU (const Resource<Texture>& texture);
 
 	static unsigned int BuildShaderContent (const Resource<ShaderContent>& shaderContent, int shaderType);
-	static bool ShaderErrorCheck (unsigned int shader);
 };
 
 #endif
\ No newline at end of file
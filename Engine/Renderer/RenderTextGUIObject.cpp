@@ -1,34 +1,19 @@
 #include "RenderTextGUIObject.h"
 
-#include "Renderer/RenderSystem.h"
-
-#include "Renderer/Pipeline.h"
-
-#include "Resources/Resources.h"
-#include "Renderer/RenderSystem.h"
-
-//TODO: Fix this
-#include "Wrappers/OpenGL/GL.h"
-
 RenderTextGUIObject::RenderTextGUIObject () :
 	_font (nullptr),
-	_fontTextureView (nullptr)
+	_fontTextureView (nullptr),
+	_text (),
+	_glyphVertices ()
 {
-	/*
-	 * Shader for text GUI render pass
-	*/
 
-	Resource<Shader> shader = Resources::LoadShader ({
-		"Assets/Shaders/fontVertex.glsl",
-		"Assets/Shaders/fontFragment.glsl"
-	});
-
-	_shaderView = RenderSystem::LoadShader (shader);
 }
 
 void RenderTextGUIObject::SetFont (const Resource<Font>& font)
 {
 	_font = font;
+
+	UpdateGlyphVertices ();
 }
 
 void RenderTextGUIObject::SetFontTextureView (const Resource<TextureView>& fontTextureView)
@@ -38,47 +23,87 @@ void RenderTextGUIObject::SetFontTextureView (const Resource<TextureView>& fontT
 
 void RenderTextGUIObject::SetText (const std::string& text)
 {
-	_modelView = RenderSystem::LoadTextGUI (text, _font);
+	if (_text == text && _glyphVertices.empty () == false) {
+		return;
+	}
+
+	_text = text;
+
+	UpdateGlyphVertices ();
+}
+
+const Resource<TextureView>& RenderTextGUIObject::GetFontTextureView () const
+{
+	return _fontTextureView;
 }
 
-void RenderTextGUIObject::Draw ()
+const std::vector<TextGUIVertexData>& RenderTextGUIObject::GetGlyphVertices () const
 {
-	if (_modelView == nullptr) {
+	return _glyphVertices;
+}
+
+void RenderTextGUIObject::Draw (std::size_t levelOfDetail)
+{
+	/*
+	 * Drawn on its own, a text is a batch of one
+	*/
+
+	TextGUIBatcher::Add (this);
+	TextGUIBatcher::Flush ();
+}
+
+void RenderTextGUIObject::UpdateGlyphVertices ()
+{
+	_glyphVertices.clear ();
+
+	if (_font == nullptr) {
 		return;
 	}
 
-	GL::Disable (GL_CULL_FACE);
-	GL::Disable (GL_DEPTH_TEST);
+	/*
+	 * Lay out two triangles per glyph in object space, the batcher
+	 * only transforms them
+	*/
 
-	GL::Enable (GL_BLEND);
-	GL::BlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	Resource<Texture> texture = _font->GetTexture (0);
 
-	Pipeline::LockShader (_shaderView);
+	glm::vec2 texSize (texture->GetSize ().width, texture->GetSize ().height);
+	glm::vec2 screenPos (0.0f);
 
-	Pipeline::SetObjectTransform (_transform);
-	Pipeline::UpdateMatrices (_shaderView);
+	_glyphVertices.reserve (_text.size () * 6);
 
-	Pipeline::SendCustomAttributes (_shaderView, GetUniformAttributes ());
+	for (std::size_t i = 0; i < _text.size (); i++) {
+		FontChar* ch = _font->GetChar (_text [i]);
 
-	_modelView->DrawGeometry ();
+		if (ch == nullptr) {
+			continue;
+		}
 
-	Pipeline::UnlockShader ();
-}
+		glm::vec2 scale = (glm::vec2) ch->GetSize ();
+		glm::vec2 offset = glm::vec2 (ch->GetOffset ().x, -ch->GetOffset ().y);
 
-std::vector<PipelineAttribute> RenderTextGUIObject::GetUniformAttributes ()
-{
-	// Create attribute
-	std::vector<PipelineAttribute> attributes;
+		glm::vec2 upLeft = screenPos + offset;
+		glm::vec2 upRight = upLeft + glm::vec2 (scale.x, 0);
+		glm::vec2 downLeft = upLeft + glm::vec2 (0, -scale.y);
+		glm::vec2 downRight = upLeft + glm::vec2 (scale.x, -scale.y);
 
-	PipelineAttribute fontTexture;
+		glm::vec2 tUpLeft = ((glm::vec2) ch->GetPosition ()) / texSize;
+		glm::vec2 tUpRight = tUpLeft + glm::vec2 (scale.x, 0) / texSize;
+		glm::vec2 tDownLeft = tUpLeft + glm::vec2 (0, scale.y) / texSize;
+		glm::vec2 tDownRight = tUpLeft + scale / texSize;
 
-	fontTexture.type = PipelineAttribute::AttrType::ATTR_TEXTURE_2D;
+		glm::vec2 positions [6] = { upLeft, downLeft, upRight, upRight, downLeft, downRight };
+		glm::vec2 texcoords [6] = { tUpLeft, tDownLeft, tUpRight, tUpRight, tDownLeft, tDownRight };
 
-	fontTexture.name = "FontTexture";
+		for (std::size_t index = 0; index < 6; index ++) {
+			TextGUIVertexData vertexData;
 
-	fontTexture.value.x = _fontTextureView->GetGPUIndex ();
+			vertexData.position [0] = positions [index].x; vertexData.position [1] = positions [index].y;
+			vertexData.texcoord [0] = texcoords [index].x; vertexData.texcoord [1] = texcoords [index].y;
 
-	attributes.push_back (fontTexture);
+			_glyphVertices.push_back (vertexData);
+		}
 
-	return attributes;
+		screenPos.x += ch->GetXAdvance ();
+	}
 }
@@ -3,18 +3,20 @@
 
 #include "Renderer/RenderObject.h"
 
-#include "Renderer/RenderViews/ShaderView.h"
-
-#include "Renderer/PipelineAttribute.h"
+#include "Renderer/RenderViews/TextureView.h"
+#include "Renderer/TextGUIBatcher.h"
 
 #include "Fonts/Font.h"
 
 class RenderTextGUIObject : public RenderObject
 {
+	DECLARE_RENDER_OBJECT(RenderTextGUIObject)
+
 protected:
-	Resource<ShaderView> _shaderView;
 	Resource<Font> _font;
 	Resource<TextureView> _fontTextureView;
+	std::string _text;
+	std::vector<TextGUIVertexData> _glyphVertices;
 
 public:
 	RenderTextGUIObject ();
@@ -24,9 +26,12 @@ public:
 
 	void SetText (const std::string& text);
 
-	void Draw ();
+	const Resource<TextureView>& GetFontTextureView () const;
+	const std::vector<TextGUIVertexData>& GetGlyphVertices () const;
+
+	void Draw (std::size_t levelOfDetail = 0);
 protected:
-	std::vector<PipelineAttribute> GetUniformAttributes ();
+	void UpdateGlyphVertices ();
 };
 
-#endif
\ No newline at end of file
+#endif
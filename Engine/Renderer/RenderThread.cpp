@@ -0,0 +1,116 @@
+#include "RenderThread.h"
+
+std::thread::id RenderThread::_threadId;
+
+std::mutex RenderThread::_mutex;
+std::condition_variable RenderThread::_condition;
+
+std::vector<const std::function<void ()>*> RenderThread::_tasks;
+std::size_t RenderThread::_submittedTasks (0);
+std::size_t RenderThread::_completedTasks (0);
+
+void RenderThread::Init ()
+{
+	_threadId = std::this_thread::get_id ();
+}
+
+bool RenderThread::IsCurrent ()
+{
+	/*
+	 * Before initialization everything runs on a single thread
+	*/
+
+	if (_threadId == std::thread::id ()) {
+		return true;
+	}
+
+	return std::this_thread::get_id () == _threadId;
+}
+
+void RenderThread::Invoke (const std::function<void ()>& task)
+{
+	if (IsCurrent () == true) {
+		task ();
+
+		return;
+	}
+
+	/*
+	 * Tasks complete in the order they are submitted, the caller keeps
+	 * the task alive until its ticket is reached
+	*/
+
+	std::unique_lock<std::mutex> lock (_mutex);
+
+	_tasks.push_back (&task);
+
+	std::size_t ticket = ++ _submittedTasks;
+
+	_condition.notify_all ();
+
+	_condition.wait (lock, [ticket] { return _completedTasks >= ticket; });
+}
+
+void RenderThread::ProcessTasks ()
+{
+	std::vector<const std::function<void ()>*> tasks;
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		tasks.swap (_tasks);
+	}
+
+	if (tasks.empty ()) {
+		return;
+	}
+
+	for (auto task : tasks) {
+		(*task) ();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		_completedTasks += tasks.size ();
+	}
+
+	_condition.notify_all ();
+}
+
+void RenderThread::Wait (const std::function<bool ()>& predicate)
+{
+	/*
+	 * Serve GL work while waiting, the other thread may be blocked on it
+	*/
+
+	std::unique_lock<std::mutex> lock (_mutex);
+
+	while (predicate () == false) {
+		if (_tasks.empty () == false) {
+			lock.unlock ();
+
+			ProcessTasks ();
+
+			lock.lock ();
+
+			continue;
+		}
+
+		_condition.wait (lock);
+	}
+}
+
+void RenderThread::Notify ()
+{
+	/*
+	 * Taking the lock orders the state change before a waiter checks
+	 * its predicate
+	*/
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+	}
+
+	_condition.notify_all ();
+}
@@ -0,0 +1,60 @@
+#ifndef RENDERTHREAD_H
+#define RENDERTHREAD_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Thread that owns the GL context. Other threads hand GL work over with
+ * Invoke and block until the render thread runs it, which happens when
+ * the render thread waits on them. On the render thread itself, the
+ * work runs in place.
+*/
+
+class ENGINE_API RenderThread
+{
+private:
+	static std::thread::id _threadId;
+
+	static std::mutex _mutex;
+	static std::condition_variable _condition;
+
+	static std::vector<const std::function<void ()>*> _tasks;
+	static std::size_t _submittedTasks;
+	static std::size_t _completedTasks;
+
+public:
+	static void Init ();
+
+	static bool IsCurrent ();
+
+	static void Invoke (const std::function<void ()>& task);
+
+	static void ProcessTasks ();
+	static void Wait (const std::function<bool ()>& predicate);
+	static void Notify ();
+};
+
+/*
+ * Prologue for methods that touch the GL context
+*/
+
+#define RENDER_THREAD_INVOKE(call) \
+	if (RenderThread::IsCurrent () == false) { \
+		RenderThread::Invoke ([&] () { call; }); \
+		return; \
+	}
+
+#define RENDER_THREAD_INVOKE_RESULT(type, call) \
+	if (RenderThread::IsCurrent () == false) { \
+		type result; \
+		RenderThread::Invoke ([&] () { result = call; }); \
+		return result; \
+	}
+
+#endif
@@ -1,6 +1,8 @@
 #include "FramebufferView.h"
 #include "FramebufferView.h"
 
+#include "Renderer/Pipeline.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 FramebufferView::FramebufferView (unsigned int gpuIndex,
@@ -78,6 +80,18 @@ void FramebufferView::ActivateSource ()
 
 	GL::BindFramebuffer (GL_READ_FRAMEBUFFER, _gpuIndex);
 
+	/*
+	 * Blits read the attachments of the source framebuffer
+	*/
+
+	for (auto& textureView : _textureViews) {
+		Pipeline::ReadTexture (textureView->GetGPUIndex ());
+	}
+
+	if (_depthTextureView != nullptr) {
+		Pipeline::ReadTexture (_depthTextureView->GetGPUIndex ());
+	}
+
 	/*
 	 * Enable all color attachments correspunding with color textures
 	*/
@@ -1,54 +1,84 @@
 #include "ModelView.h"
 
+#include <algorithm>
+
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderThread.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
+ObjectBuffer::ObjectBuffer () :
+	VAO_INDEX (0),
+	VBO_INDEX (0),
+	VBO_INSTANCE_INDEX (0),
+	IBO_INDEX (0),
+	INDEX_TYPE (GL_UNSIGNED_INT),
+	INSTANCES_COUNT (0),
+	VerticesCount (0),
+	PolygonsCount (0),
+	DequantizationMatrix (1.0f)
+{
+
+}
+
 ModelView::~ModelView ()
 {
-	GL::DeleteBuffers(1, &_objectBuffer.VBO_INDEX);
-	GL::DeleteBuffers(1, &_objectBuffer.VBO_INSTANCE_INDEX);
-	GL::DeleteBuffers(1, &_objectBuffer.IBO_INDEX);
-	GL::DeleteVertexArrays(1, &_objectBuffer.VAO_INDEX);
+	/*
+	 * Last reference may be dropped on the update thread
+	*/
+
+	RenderThread::Invoke ([this] () {
+		GL::DeleteBuffers(1, &_objectBuffer.VBO_INDEX);
+		GL::DeleteBuffers(1, &_objectBuffer.VBO_INSTANCE_INDEX);
+		GL::DeleteBuffers(1, &_objectBuffer.IBO_INDEX);
+		GL::DeleteVertexArrays(1, &_objectBuffer.VAO_INDEX);
+	});
 }
 
-void ModelView::Draw ()
+void ModelView::Draw (std::size_t levelOfDetail)
 {
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
+	Pipeline::SetObjectDequantization (_objectBuffer.DequantizationMatrix);
+
 	//bind pe containerul de stare de geometrie (vertex array object)
 	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
 
-	for (std::size_t i=0;i<_groupBuffers.size ();i++) {
-		Pipeline::SendMaterial (_groupBuffers [i].materialView);
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
+		Pipeline::SendMaterial (groupBuffers [i].materialView);
 
 		//comanda desenare
 		if (_objectBuffer.VBO_INSTANCE_INDEX == 0) {
-			GL::DrawElements (GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset));
+			GL::DrawElements (GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, _objectBuffer.INDEX_TYPE,
+				(void*) (GetIndexSize () * groupBuffers [i].offset));
 		}
 
 		if (_objectBuffer.VBO_INSTANCE_INDEX != 0) {
-			GL::DrawElementsInstanced(GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
+			GL::DrawElementsInstanced(GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, _objectBuffer.INDEX_TYPE,
+				(void*) (GetIndexSize () * groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
 		}
 	}
 }
 
-void ModelView::DrawGeometry ()
+void ModelView::DrawGeometry (std::size_t levelOfDetail)
 {
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
+	Pipeline::SetObjectDequantization (_objectBuffer.DequantizationMatrix);
 	Pipeline::UpdateMatrices (nullptr);
 	//bind pe containerul de stare de geometrie (vertex array object)
 	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
 
-	for (std::size_t i=0;i<_groupBuffers.size ();i++) {
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
 		//comanda desenare
 		if (_objectBuffer.VBO_INSTANCE_INDEX == 0) {
-			GL::DrawElements (GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset));
+			GL::DrawElements (GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, _objectBuffer.INDEX_TYPE,
+				(void*) (GetIndexSize () * groupBuffers [i].offset));
 		}
 
 		if (_objectBuffer.VBO_INSTANCE_INDEX != 0) {
-			GL::DrawElementsInstanced(GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
+			GL::DrawElementsInstanced(GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, _objectBuffer.INDEX_TYPE,
+				(void*) (GetIndexSize () * groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
 		}
 	}
 }
@@ -63,6 +93,11 @@ void ModelView::AddGroupBuffer (const GroupBuffer& groupBuffer)
 	_groupBuffers.push_back (groupBuffer);
 }
 
+void ModelView::AddLevelOfDetail (const LevelOfDetail& levelOfDetail)
+{
+	_levelsOfDetail.push_back (levelOfDetail);
+}
+
 ObjectBuffer& ModelView::GetObjectBuffer ()
 {
 	return _objectBuffer;
@@ -73,9 +108,20 @@ std::size_t ModelView::GetVerticesCount () const
 	return _objectBuffer.VerticesCount;
 }
 
-std::size_t ModelView::GetPolygonsCount () const
+std::size_t ModelView::GetPolygonsCount (std::size_t levelOfDetail) const
 {
-	return _objectBuffer.PolygonsCount;
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return _objectBuffer.PolygonsCount;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1].PolygonsCount;
+}
+
+std::size_t ModelView::GetLevelsOfDetailCount () const
+{
+	return _levelsOfDetail.size () + 1;
 }
 
 std::vector<GroupBuffer>::iterator ModelView::begin ()
@@ -87,3 +133,37 @@ std::vector<GroupBuffer>::iterator ModelView::end ()
 {
 	return _groupBuffers.end ();
 }
+
+std::vector<GroupBuffer>::const_iterator ModelView::begin () const
+{
+	return _groupBuffers.begin ();
+}
+
+std::vector<GroupBuffer>::const_iterator ModelView::end () const
+{
+	return _groupBuffers.end ();
+}
+
+const std::vector<GroupBuffer>& ModelView::GetGroupBuffers (std::size_t levelOfDetail) const
+{
+	/*
+	 * Level zero is the original model
+	*/
+
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return _groupBuffers;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1].groupBuffers;
+}
+
+std::size_t ModelView::GetIndexSize () const
+{
+	if (_objectBuffer.INDEX_TYPE == GL_UNSIGNED_SHORT) {
+		return sizeof (unsigned short);
+	}
+
+	return sizeof (unsigned int);
+}
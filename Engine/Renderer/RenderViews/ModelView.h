@@ -3,11 +3,15 @@
 
 #include "Core/Interfaces/Object.h"
 
+#include <glm/glm.hpp>
 #include <vector>
 #include <string>
 
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/MaterialView.h"
+#include "Renderer/BufferAttribute.h"
+
+#define MAX_LEVELS_OF_DETAIL 4
 
 struct ObjectBuffer
 {
@@ -15,10 +19,25 @@ struct ObjectBuffer
 	unsigned int VBO_INDEX;
 	unsigned int VBO_INSTANCE_INDEX;
 	unsigned int IBO_INDEX;
+	unsigned int INDEX_TYPE;
 	std::size_t INSTANCES_COUNT;
 
 	std::size_t VerticesCount;
 	std::size_t PolygonsCount;
+
+	/*
+	 * Expands quantized positions back to model space
+	*/
+
+	glm::mat4 DequantizationMatrix;
+
+	/*
+	 * Per instance layout, re-pointed whenever instances are streamed
+	*/
+
+	std::vector<BufferAttribute> InstanceAttributes;
+
+	ObjectBuffer ();
 };
 
 struct GroupBuffer
@@ -28,29 +47,47 @@ struct GroupBuffer
 	std::size_t offset;
 };
 
+/*
+ * Simplified index ranges of the same object buffer
+*/
+
+struct LevelOfDetail
+{
+	std::vector<GroupBuffer> groupBuffers;
+	std::size_t PolygonsCount;
+};
+
 class ModelView : public Object
 {
 protected:
 	ObjectBuffer _objectBuffer;
 	std::vector<GroupBuffer> _groupBuffers;
+	std::vector<LevelOfDetail> _levelsOfDetail;
 
 public:
 	~ModelView ();
 
-	virtual void Draw ();
-	virtual void DrawGeometry ();
+	virtual void Draw (std::size_t levelOfDetail = 0);
+	virtual void DrawGeometry (std::size_t levelOfDetail = 0);
 
 	void SetObjectBuffer (const ObjectBuffer& objectBuffer);
 
 	void AddGroupBuffer (const GroupBuffer& groupBuffer);
+	void AddLevelOfDetail (const LevelOfDetail& levelOfDetail);
 
 	ObjectBuffer& GetObjectBuffer ();
 
 	std::size_t GetVerticesCount () const;
-	std::size_t GetPolygonsCount () const;
+	std::size_t GetPolygonsCount (std::size_t levelOfDetail = 0) const;
+	std::size_t GetLevelsOfDetailCount () const;
 
 	std::vector<GroupBuffer>::iterator begin ();
 	std::vector<GroupBuffer>::iterator end ();
+	std::vector<GroupBuffer>::const_iterator begin () const;
+	std::vector<GroupBuffer>::const_iterator end () const;
+protected:
+	const std::vector<GroupBuffer>& GetGroupBuffers (std::size_t levelOfDetail) const;
+	std::size_t GetIndexSize () const;
 };
 
 #endif
\ No newline at end of file
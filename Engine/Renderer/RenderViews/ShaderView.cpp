@@ -1,5 +1,8 @@
 #include "ShaderView.h"
 
+#include "Renderer/RenderThread.h"
+#include "Renderer/ShaderCompiler.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 ShaderView::ShaderView (unsigned int program) :
@@ -15,7 +18,11 @@ ShaderView::~ShaderView ()
 	 * Delete shader
 	*/
 
-	GL::DeleteProgram (_program);
+	RenderThread::Invoke ([this] () {
+		ShaderCompiler::DiscardProgram (_program);
+
+		GL::DeleteProgram (_program);
+	});
 }
 
 unsigned int ShaderView::GetProgram () const
@@ -1,5 +1,8 @@
 #include "TextureView.h"
 
+#include "Renderer/RenderThread.h"
+#include "Renderer/Pipeline.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 TextureView::TextureView () :
@@ -11,7 +14,9 @@ TextureView::TextureView () :
 
 TextureView::~TextureView ()
 {
-	GL::DeleteTextures (1, &_gpuIndex);
+	RenderThread::Invoke ([this] () {
+		GL::DeleteTextures (1, &_gpuIndex);
+	});
 }
 
 void TextureView::Activate (std::size_t textureUnit)
@@ -24,6 +29,8 @@ void TextureView::Activate (std::size_t textureUnit)
 
 	GL::ActiveTexture (GL_TEXTURE0 + textureUnit);
 	GL::BindTexture (textureType, _gpuIndex);
+
+	Pipeline::ReadTexture (_gpuIndex);
 }
 
 void TextureView::SetGPUIndex (unsigned int gpuIndex)
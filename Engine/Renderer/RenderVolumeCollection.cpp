@@ -1,32 +1,40 @@
 #include "RenderVolumeCollection.h"
 
+#include "Renderer/FrameGraph.h"
+
+std::map<std::string, RenderVolumeHandle> RenderVolumeCollection::_handles;
+
 RenderVolumeCollection::RenderVolumeCollection () :
 	_currentLevel (0),
-	_lastRenderVolumeName ()
+	_lastRenderVolumeHandle (GetHandle ("")),
+	_frameGraph (nullptr)
 {
 
 }
 
 RenderVolumeCollection* RenderVolumeCollection::Insert (const std::string& name, RenderVolumeI* volume, bool external)
 {
-	_scopedVolumes.push (std::pair<std::string, std::size_t> (name, _currentLevel));
+	return Insert (GetHandle (name), volume, external);
+}
 
-	auto it = _nestedRenderVolumes.find (name);
+RenderVolumeCollection* RenderVolumeCollection::Insert (RenderVolumeHandle handle, RenderVolumeI* volume, bool external)
+{
+	_scopedVolumes.push (std::pair<RenderVolumeHandle, std::size_t> (handle, _currentLevel));
 
-	if (it == _nestedRenderVolumes.end ()) {
-		_nestedRenderVolumes [name] = std::stack<std::pair<RenderVolumeI*, std::size_t>> ();
+	if (handle >= _nestedRenderVolumes.size ()) {
+		_nestedRenderVolumes.resize (handle + 1);
 	}
 
-	it = _nestedRenderVolumes.find (name);
+	auto& volumes = _nestedRenderVolumes [handle];
 
-	if (it->second.empty () == false && it->second.top ().second == _currentLevel) {
-		it->second.pop ();
+	if (volumes.empty () == false && volumes.top ().second == _currentLevel) {
+		volumes.pop ();
 	}
 
-	it->second.push (std::pair<RenderVolumeI*, std::size_t> (volume, _currentLevel));
+	volumes.push (std::pair<RenderVolumeI*, std::size_t> (volume, _currentLevel));
 
 	if (external == true) {
-		_lastRenderVolumeName = name;
+		_lastRenderVolumeHandle = handle;
 	}
 
 	return this;
@@ -41,23 +49,15 @@ RenderVolumeCollection* RenderVolumeCollection::StartScope ()
 
 RenderVolumeCollection* RenderVolumeCollection::ReleaseScope ()
 {
-	RenderVolumeI* lastRenderVolume = GetRenderVolume (_lastRenderVolumeName);
+	RenderVolumeI* lastRenderVolume = GetTopVolume (_lastRenderVolumeHandle);
 
 	while (_scopedVolumes.empty () == false &&
 		_scopedVolumes.top ().second == _currentLevel) {
 
-		std::string volumeName = _scopedVolumes.top ().first;
-
-		auto it = _nestedRenderVolumes.find (volumeName);
+		auto& volumes = _nestedRenderVolumes [_scopedVolumes.top ().first];
 
-		if (it != _nestedRenderVolumes.end ()) {
-			if (it->second.top ().second == _currentLevel) {
-				it->second.pop ();
-			}
-
-			if (it->second.empty () == true) {
-				_nestedRenderVolumes.erase (it);
-			}
+		if (volumes.empty () == false && volumes.top ().second == _currentLevel) {
+			volumes.pop ();
 		}
 
 		_scopedVolumes.pop ();
@@ -65,37 +65,86 @@ RenderVolumeCollection* RenderVolumeCollection::ReleaseScope ()
 
 	-- _currentLevel;
 
-	Insert (_lastRenderVolumeName, lastRenderVolume);
+	Insert (_lastRenderVolumeHandle, lastRenderVolume);
 
 	return this;
 }
 
 RenderVolumeI* RenderVolumeCollection::GetRenderVolume (const std::string& name) const
 {
-	auto it = _nestedRenderVolumes.find (name);
+	auto it = _handles.find (name);
 
-	if (it == _nestedRenderVolumes.end ()) {
+	if (it == _handles.end ()) {
 		return nullptr;
 	}
 
-	return it->second.top ().first;
+	return GetRenderVolume (it->second);
+}
+
+RenderVolumeI* RenderVolumeCollection::GetRenderVolume (RenderVolumeHandle handle) const
+{
+	RenderVolumeI* volume = GetTopVolume (handle);
+
+	/*
+	 * Keep track of the volumes read by the current pass
+	*/
+
+	if (_frameGraph != nullptr && volume != nullptr) {
+		_frameGraph->ReadVolume (volume);
+	}
+
+	return volume;
 }
 
 RenderVolumeI* RenderVolumeCollection::GetPreviousVolume () const
 {
-	return GetRenderVolume (_lastRenderVolumeName);
+	return GetRenderVolume (_lastRenderVolumeHandle);
+}
+
+void RenderVolumeCollection::SetFrameGraph (FrameGraph* frameGraph)
+{
+	_frameGraph = frameGraph;
+}
+
+FrameGraph* RenderVolumeCollection::GetFrameGraph () const
+{
+	return _frameGraph;
+}
+
+RenderVolumeHandle RenderVolumeCollection::GetHandle (const std::string& name)
+{
+	/*
+	 * Volume names are resolved once to a dense index
+	*/
+
+	auto it = _handles.find (name);
+
+	if (it == _handles.end ()) {
+		it = _handles.insert (std::make_pair (name, _handles.size ())).first;
+	}
+
+	return it->second;
+}
+
+RenderVolumeI* RenderVolumeCollection::GetTopVolume (RenderVolumeHandle handle) const
+{
+	if (handle >= _nestedRenderVolumes.size () || _nestedRenderVolumes [handle].empty ()) {
+		return nullptr;
+	}
+
+	return _nestedRenderVolumes [handle].top ().first;
 }
 
 RenderVolumeCollectionIterator RenderVolumeCollection::begin ()
 {
-	RenderVolumeCollectionIterator rvcIt (_nestedRenderVolumes.begin ());
+	RenderVolumeCollectionIterator rvcIt (this, _handles.begin ());
 
 	return rvcIt;
 }
 
 RenderVolumeCollectionIterator RenderVolumeCollection::end ()
 {
-	RenderVolumeCollectionIterator rvcIt (_nestedRenderVolumes.end ());
+	RenderVolumeCollectionIterator rvcIt (this, _handles.end ());
 
 	return rvcIt;
 }
@@ -108,6 +157,8 @@ RenderVolumeCollectionIterator& RenderVolumeCollectionIterator::operator++ ()
 {
 	_it++;
 
+	SkipEmptyVolumes ();
+
 	return *this;
 }
 
@@ -118,11 +169,27 @@ bool RenderVolumeCollectionIterator::operator != (const RenderVolumeCollectionIt
 
 RenderVolumeI* RenderVolumeCollectionIterator::operator* ()
 {
-	return _it->second.top ().first;
+	return _rvc->GetTopVolume (_it->second);
 }
 
-RenderVolumeCollectionIterator::RenderVolumeCollectionIterator (std::map<std::string, std::stack<std::pair<RenderVolumeI*, std::size_t>>>::iterator it) :
+RenderVolumeCollectionIterator::RenderVolumeCollectionIterator (const RenderVolumeCollection* rvc,
+	std::map<std::string, RenderVolumeHandle>::const_iterator it) :
+	_rvc (rvc),
 	_it (it)
 {
+	SkipEmptyVolumes ();
+}
 
-}
\ No newline at end of file
+void RenderVolumeCollectionIterator::SkipEmptyVolumes ()
+{
+	/*
+	 * Names are registered globally, skip the ones without volumes
+	 * in this collection
+	*/
+
+	while (_it != RenderVolumeCollection::_handles.end () &&
+		(_it->second >= _rvc->_nestedRenderVolumes.size () ||
+		_rvc->_nestedRenderVolumes [_it->second].empty ())) {
+		_it ++;
+	}
+}
@@ -6,32 +6,51 @@
 #include <map>
 #include <stack>
 #include <string>
+#include <vector>
 
 #include "RenderVolumeI.h"
 
+typedef std::size_t RenderVolumeHandle;
+
+class FrameGraph;
 class RenderVolumeCollectionIterator;
 
 class RenderVolumeCollection : public Object
 {
+	friend RenderVolumeCollectionIterator;
+
 protected:
-	std::map<std::string, std::stack<std::pair<RenderVolumeI*, std::size_t>>> _nestedRenderVolumes;
-	std::stack<std::pair<std::string, std::size_t>> _scopedVolumes;
+	static std::map<std::string, RenderVolumeHandle> _handles;
+
+	std::vector<std::stack<std::pair<RenderVolumeI*, std::size_t>>> _nestedRenderVolumes;
+	std::stack<std::pair<RenderVolumeHandle, std::size_t>> _scopedVolumes;
 	std::size_t _currentLevel;
-	std::string _lastRenderVolumeName;
+	RenderVolumeHandle _lastRenderVolumeHandle;
+
+	FrameGraph* _frameGraph;
 
 public:
 	RenderVolumeCollection ();
 
 	RenderVolumeCollection* Insert (const std::string& name, RenderVolumeI* volume, bool external = true);
+	RenderVolumeCollection* Insert (RenderVolumeHandle handle, RenderVolumeI* volume, bool external = true);
 
 	RenderVolumeCollection* StartScope ();
 	RenderVolumeCollection* ReleaseScope ();
 
 	RenderVolumeI* GetRenderVolume (const std::string& name) const;
+	RenderVolumeI* GetRenderVolume (RenderVolumeHandle handle) const;
 	RenderVolumeI* GetPreviousVolume () const;
 
+	void SetFrameGraph (FrameGraph* frameGraph);
+	FrameGraph* GetFrameGraph () const;
+
+	static RenderVolumeHandle GetHandle (const std::string& name);
+
 	RenderVolumeCollectionIterator begin ();
 	RenderVolumeCollectionIterator end ();
+protected:
+	RenderVolumeI* GetTopVolume (RenderVolumeHandle handle) const;
 };
 
 class RenderVolumeCollectionIterator
@@ -39,14 +58,17 @@ class RenderVolumeCollectionIterator
 	friend RenderVolumeCollection;
 
 protected:
-	std::map<std::string, std::stack<std::pair<RenderVolumeI*, std::size_t>>>::iterator _it;
+	const RenderVolumeCollection* _rvc;
+	std::map<std::string, RenderVolumeHandle>::const_iterator _it;
 
 public:
 	RenderVolumeCollectionIterator& operator++ ();
 	bool operator != (const RenderVolumeCollectionIterator& other);
 	RenderVolumeI* operator* ();
 protected:
-	RenderVolumeCollectionIterator (std::map<std::string, std::stack<std::pair<RenderVolumeI*, std::size_t>>>::iterator it);
+	RenderVolumeCollectionIterator (const RenderVolumeCollection* rvc, std::map<std::string, RenderVolumeHandle>::const_iterator it);
+
+	void SkipEmptyVolumes ();
 };
 
-#endif
\ No newline at end of file
+#endif
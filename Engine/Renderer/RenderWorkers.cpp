@@ -0,0 +1,176 @@
+#include "RenderWorkers.h"
+
+#include <algorithm>
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Core/Console/Console.h"
+
+#define RENDER_WORKERS_MAX_THREADS 16
+#define RENDER_WORKERS_TASKS_PER_THREAD 4
+
+std::vector<std::thread> RenderWorkers::_threads;
+
+std::mutex RenderWorkers::_mutex;
+std::condition_variable RenderWorkers::_wakeCondition;
+std::condition_variable RenderWorkers::_doneCondition;
+
+std::size_t RenderWorkers::_generation (0);
+std::size_t RenderWorkers::_activeWorkers (0);
+bool RenderWorkers::_stop (false);
+
+const std::function<void (std::size_t)>* RenderWorkers::_task (nullptr);
+std::atomic<std::size_t> RenderWorkers::_tasksCount (0);
+std::atomic<std::size_t> RenderWorkers::_nextTask (0);
+std::atomic<std::size_t> RenderWorkers::_pendingTasks (0);
+
+void RenderWorkers::Init ()
+{
+	int threadsCount = SettingsManager::Instance ()->GetValue<int> ("render_worker_threads", -1);
+
+	if (threadsCount < 0) {
+		threadsCount = std::max ((int) std::thread::hardware_concurrency () - 1, 0);
+	}
+
+	threadsCount = std::min (threadsCount, RENDER_WORKERS_MAX_THREADS);
+
+	_stop = false;
+
+	for (int index = 0; index < threadsCount; index ++) {
+		_threads.push_back (std::thread (WorkerLoop));
+	}
+
+	Console::Log ("Render workers: " + std::to_string (threadsCount));
+}
+
+void RenderWorkers::Clear ()
+{
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		_stop = true;
+	}
+
+	_wakeCondition.notify_all ();
+
+	for (auto& thread : _threads) {
+		thread.join ();
+	}
+
+	_threads.clear ();
+}
+
+std::size_t RenderWorkers::GetThreadsCount ()
+{
+	/*
+	 * Calling thread works as well
+	*/
+
+	return _threads.size () + 1;
+}
+
+std::size_t RenderWorkers::GetTasksCount (std::size_t itemsCount, std::size_t minItemsPerTask)
+{
+	/*
+	 * A few tasks per thread balance uneven work, while small inputs
+	 * are not worth waking the workers
+	*/
+
+	std::size_t tasksCount = (itemsCount + minItemsPerTask - 1) / minItemsPerTask;
+
+	tasksCount = std::min (tasksCount, GetThreadsCount () * RENDER_WORKERS_TASKS_PER_THREAD);
+
+	return std::max<std::size_t> (tasksCount, 1);
+}
+
+void RenderWorkers::Execute (std::size_t tasksCount, const std::function<void (std::size_t)>& task)
+{
+	if (_threads.empty () || tasksCount < 2) {
+		for (std::size_t index = 0; index < tasksCount; index ++) {
+			task (index);
+		}
+
+		return;
+	}
+
+	/*
+	 * Publish the tasks once no worker is still walking the previous
+	 * ones. Next task index is reset last, so a worker that gets a
+	 * valid index also sees the task and its count.
+	*/
+
+	{
+		std::unique_lock<std::mutex> lock (_mutex);
+
+		_doneCondition.wait (lock, [] { return _activeWorkers == 0; });
+
+		_task = &task;
+		_tasksCount = tasksCount;
+		_pendingTasks = tasksCount;
+		_nextTask = 0;
+
+		_generation ++;
+	}
+
+	_wakeCondition.notify_all ();
+
+	RunTasks ();
+
+	/*
+	 * Wait for the tasks taken by workers
+	*/
+
+	std::unique_lock<std::mutex> lock (_mutex);
+
+	_doneCondition.wait (lock, [] { return _pendingTasks == 0; });
+
+	_task = nullptr;
+}
+
+void RenderWorkers::WorkerLoop ()
+{
+	std::size_t generation = 0;
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock (_mutex);
+
+			_wakeCondition.wait (lock, [&generation] { return _stop || _generation != generation; });
+
+			if (_stop == true) {
+				return;
+			}
+
+			generation = _generation;
+
+			_activeWorkers ++;
+		}
+
+		RunTasks ();
+
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+
+			_activeWorkers --;
+		}
+
+		_doneCondition.notify_all ();
+	}
+}
+
+void RenderWorkers::RunTasks ()
+{
+	std::size_t index = _nextTask.fetch_add (1);
+
+	while (index < _tasksCount) {
+		(*_task) (index);
+
+		if (_pendingTasks.fetch_sub (1) == 1) {
+			std::lock_guard<std::mutex> lock (_mutex);
+
+			_doneCondition.notify_all ();
+		}
+
+		index = _nextTask.fetch_add (1);
+	}
+}
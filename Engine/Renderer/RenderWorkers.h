@@ -0,0 +1,55 @@
+#ifndef RENDERWORKERS_H
+#define RENDERWORKERS_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Worker threads for the CPU side of rendering. Passes split their
+ * per object work (culling, level of detail selection, command
+ * recording) in tasks that never touch the GL context; the calling
+ * thread takes part in the work and returns when every task is done,
+ * so GL calls stay on the thread that owns the context.
+ *
+ * Number of workers is read from render_worker_threads, a negative
+ * value uses one worker less than the available cores.
+*/
+
+class ENGINE_API RenderWorkers
+{
+private:
+	static std::vector<std::thread> _threads;
+
+	static std::mutex _mutex;
+	static std::condition_variable _wakeCondition;
+	static std::condition_variable _doneCondition;
+
+	static std::size_t _generation;
+	static std::size_t _activeWorkers;
+	static bool _stop;
+
+	static const std::function<void (std::size_t)>* _task;
+	static std::atomic<std::size_t> _tasksCount;
+	static std::atomic<std::size_t> _nextTask;
+	static std::atomic<std::size_t> _pendingTasks;
+
+public:
+	static void Init ();
+	static void Clear ();
+
+	static std::size_t GetThreadsCount ();
+	static std::size_t GetTasksCount (std::size_t itemsCount, std::size_t minItemsPerTask);
+
+	static void Execute (std::size_t tasksCount, const std::function<void (std::size_t)>& task);
+private:
+	static void WorkerLoop ();
+	static void RunTasks ();
+};
+
+#endif
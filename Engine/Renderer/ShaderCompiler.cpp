@@ -0,0 +1,242 @@
+#include "ShaderCompiler.h"
+
+#include <algorithm>
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Wrappers/OpenGL/GL.h"
+
+#include "Core/Console/Console.h"
+
+std::map<unsigned int, ShaderCompiler::PendingProgram> ShaderCompiler::_pendingPrograms;
+std::size_t ShaderCompiler::_batchDepth (0);
+bool ShaderCompiler::_parallelCompile (false);
+
+void ShaderCompiler::Init ()
+{
+	/*
+	 * Without parallel shader compile, batches still submit every
+	 * stage before linking, but completion can't be queried
+	*/
+
+	bool parallelCompile = SettingsManager::Instance ()->GetValue<bool> ("parallel_shader_compile", true);
+
+	if (parallelCompile == true && !GLEW_ARB_parallel_shader_compile) {
+		Console::LogWarning ("Parallel shader compile is not supported, shaders will be compiled on first use");
+		parallelCompile = false;
+	}
+
+	_parallelCompile = parallelCompile;
+
+	if (_parallelCompile == true) {
+
+		/*
+		 * Let the driver use as many threads as it wants
+		*/
+
+		GL::MaxShaderCompilerThreads (0xFFFFFFFF);
+	}
+}
+
+void ShaderCompiler::BeginBatch ()
+{
+	_batchDepth ++;
+}
+
+void ShaderCompiler::EndBatch ()
+{
+	if (_batchDepth == 0) {
+		return;
+	}
+
+	_batchDepth --;
+
+	/*
+	 * Link once every stage of the batch is submitted
+	*/
+
+	if (_batchDepth == 0) {
+		LinkPrograms ();
+	}
+}
+
+void ShaderCompiler::SubmitProgram (unsigned int program, const std::vector<unsigned int>& shaders,
+	const std::vector<std::string>& filenames)
+{
+	PendingProgram& pendingProgram = _pendingPrograms [program];
+
+	pendingProgram.shaders = shaders;
+	pendingProgram.filenames = filenames;
+	pendingProgram.linked = false;
+
+	/*
+	 * Outside of a batch the program is ready when returned
+	*/
+
+	if (_batchDepth == 0) {
+		Complete (program);
+	}
+}
+
+void ShaderCompiler::DiscardProgram (unsigned int program)
+{
+	auto it = _pendingPrograms.find (program);
+
+	if (it == _pendingPrograms.end ()) {
+		return;
+	}
+
+	/*
+	 * Stages are released in the same order as on completion
+	*/
+
+	for (unsigned int shader : it->second.shaders) {
+		GL::DetachShader (program, shader);
+		GL::DeleteShader (shader);
+	}
+
+	_pendingPrograms.erase (it);
+}
+
+bool ShaderCompiler::IsCompleted (unsigned int program)
+{
+	auto it = _pendingPrograms.find (program);
+
+	if (it == _pendingPrograms.end ()) {
+		return true;
+	}
+
+	if (it->second.linked == false || _parallelCompile == false) {
+		return false;
+	}
+
+	GLint completed = GL_FALSE;
+	GL::GetProgramiv (program, GL_COMPLETION_STATUS_ARB, &completed);
+
+	return completed == GL_TRUE;
+}
+
+void ShaderCompiler::Complete (unsigned int program)
+{
+	if (_pendingPrograms.empty ()) {
+		return;
+	}
+
+	auto it = _pendingPrograms.find (program);
+
+	if (it == _pendingPrograms.end ()) {
+		return;
+	}
+
+	PendingProgram& pendingProgram = it->second;
+
+	if (pendingProgram.linked == false) {
+		GL::LinkProgram (program);
+	}
+
+	/*
+	 * Status queries wait for the driver if it is still at work
+	*/
+
+	for (std::size_t index = 0; index < pendingProgram.shaders.size (); index ++) {
+		CheckShader (pendingProgram.shaders [index], pendingProgram.filenames [index]);
+	}
+
+	CheckProgram (program);
+
+	/*
+	 * Stages are no longer needed once the program is linked
+	*/
+
+	for (unsigned int shader : pendingProgram.shaders) {
+		GL::DetachShader (program, shader);
+		GL::DeleteShader (shader);
+	}
+
+	_pendingPrograms.erase (it);
+}
+
+void ShaderCompiler::Update ()
+{
+	if (_parallelCompile == false) {
+		return;
+	}
+
+	/*
+	 * Finish the programs the driver is done with, so their errors
+	 * show up without anyone waiting on them
+	*/
+
+	std::vector<unsigned int> completedPrograms;
+
+	for (auto& pendingProgram : _pendingPrograms) {
+		if (IsCompleted (pendingProgram.first) == true) {
+			completedPrograms.push_back (pendingProgram.first);
+		}
+	}
+
+	for (unsigned int program : completedPrograms) {
+		Complete (program);
+	}
+}
+
+std::size_t ShaderCompiler::GetPendingProgramsCount ()
+{
+	return _pendingPrograms.size ();
+}
+
+void ShaderCompiler::LinkPrograms ()
+{
+	for (auto& pendingProgram : _pendingPrograms) {
+		if (pendingProgram.second.linked == true) {
+			continue;
+		}
+
+		GL::LinkProgram (pendingProgram.first);
+
+		pendingProgram.second.linked = true;
+	}
+}
+
+bool ShaderCompiler::CheckShader (unsigned int shader, const std::string& filename)
+{
+	int isCompiled;
+	GL::GetShaderiv (shader, GL_COMPILE_STATUS, &isCompiled);
+
+	if (isCompiled == GL_FALSE) {
+		int maxLength = 0;
+		GL::GetShaderiv (shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+		// The maxLength includes the NULL character
+		std::vector<GLchar> errorLog (std::max (maxLength, 1));
+		GL::GetShaderInfoLog (shader, maxLength, &maxLength, &errorLog [0]);
+
+		std::string error (errorLog.begin (), errorLog.end ());
+		Console::LogError ("Unable to compile \"" + filename + "\" !\n" + error);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool ShaderCompiler::CheckProgram (unsigned int program)
+{
+	int isLinked;
+	GL::GetProgramiv (program, GL_LINK_STATUS, &isLinked);
+
+	if (isLinked == GL_FALSE) {
+		int maxLength = 0;
+		GL::GetProgramiv (program, GL_INFO_LOG_LENGTH, &maxLength);
+
+		std::vector<GLchar> errorLog (std::max (maxLength, 1));
+		GL::GetProgramInfoLog (program, maxLength, &maxLength, &errorLog [0]);
+
+		std::string error (errorLog.begin (), errorLog.end ());
+		Console::LogError (error);
+
+		return false;
+	}
+
+	return true;
+}
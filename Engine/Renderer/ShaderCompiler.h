@@ -0,0 +1,56 @@
+#ifndef SHADERCOMPILER_H
+#define SHADERCOMPILER_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+ * Builds shader programs without waiting on the driver. Inside a batch
+ * every stage is compiled before any program is linked, and the status
+ * of a program is read only when it is first used. With parallel shader
+ * compile the driver works on the batch in its own threads, and Update
+ * picks up the programs already done, so no frame waits on a program
+ * it does not draw with.
+*/
+
+class ENGINE_API ShaderCompiler
+{
+private:
+	struct PendingProgram
+	{
+		std::vector<unsigned int> shaders;
+		std::vector<std::string> filenames;
+		bool linked;
+	};
+
+	static std::map<unsigned int, PendingProgram> _pendingPrograms;
+	static std::size_t _batchDepth;
+	static bool _parallelCompile;
+
+public:
+	static void Init ();
+
+	static void BeginBatch ();
+	static void EndBatch ();
+
+	static void SubmitProgram (unsigned int program, const std::vector<unsigned int>& shaders,
+		const std::vector<std::string>& filenames);
+	static void DiscardProgram (unsigned int program);
+
+	static bool IsCompleted (unsigned int program);
+	static void Complete (unsigned int program);
+
+	static void Update ();
+
+	static std::size_t GetPendingProgramsCount ();
+private:
+	static void LinkPrograms ();
+
+	static bool CheckShader (unsigned int shader, const std::string& filename);
+	static bool CheckProgram (unsigned int program);
+};
+
+#endif
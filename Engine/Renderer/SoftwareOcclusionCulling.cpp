@@ -0,0 +1,467 @@
+#include "SoftwareOcclusionCulling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define OCCLUSION_CULLING_SSE
+	#include <emmintrin.h>
+#endif
+
+/*
+ * Vertices closer than this to the camera plane are not projected
+*/
+
+static const float MIN_CLIP_W = 1e-5f;
+
+SoftwareOcclusionCulling::SoftwareOcclusionCulling () :
+	_width (0),
+	_height (0),
+	_tilesX (0),
+	_tilesY (0),
+	_viewProjectionMatrix (1.0f)
+{
+
+}
+
+void SoftwareOcclusionCulling::SetResolution (std::size_t width, std::size_t height)
+{
+	/*
+	 * Keep resolution a multiple of tile size, so every tile
+	 * row can be processed four pixels at a time
+	*/
+
+	_tilesX = std::max<std::size_t> (1, (width + TILE_SIZE - 1) / TILE_SIZE);
+	_tilesY = std::max<std::size_t> (1, (height + TILE_SIZE - 1) / TILE_SIZE);
+
+	_width = _tilesX * TILE_SIZE;
+	_height = _tilesY * TILE_SIZE;
+
+	_depthBuffer.assign (_width * _height, 1.0f);
+	_tilesMaxDepth.assign (_tilesX * _tilesY, 1.0f);
+
+	_tileBins.clear ();
+	_tileBins.resize (_tilesX * _tilesY);
+}
+
+void SoftwareOcclusionCulling::Begin (const glm::mat4& viewProjectionMatrix)
+{
+	_viewProjectionMatrix = viewProjectionMatrix;
+
+	/*
+	 * Clear depth buffer to far plane
+	*/
+
+	std::fill (_depthBuffer.begin (), _depthBuffer.end (), 1.0f);
+	std::fill (_tilesMaxDepth.begin (), _tilesMaxDepth.end (), 1.0f);
+
+	/*
+	 * Clear binned triangles
+	*/
+
+	_triangles.clear ();
+
+	for (auto& tileBin : _tileBins) {
+		tileBin.clear ();
+	}
+}
+
+void SoftwareOcclusionCulling::AttachOccluder (const OccluderMesh& occluderMesh, const glm::mat4& modelMatrix)
+{
+	glm::mat4 mvpMatrix = _viewProjectionMatrix * modelMatrix;
+
+	for (std::size_t index = 0; index + 2 < occluderMesh.indices.size (); index += 3) {
+
+		ScreenTriangle triangle;
+
+		bool isProjected = true;
+
+		for (std::size_t k = 0; k < 3; k++) {
+			const glm::vec3& vertex = occluderMesh.vertices [occluderMesh.indices [index + k]];
+
+			glm::vec4 clipPos = mvpMatrix * glm::vec4 (vertex, 1.0f);
+
+			/*
+			 * Skip triangles crossing the camera plane. Dropping occluder
+			 * triangles is always conservative.
+			*/
+
+			if (clipPos.w < MIN_CLIP_W) {
+				isProjected = false;
+				break;
+			}
+
+			glm::vec3 ndcPos = glm::vec3 (clipPos) / clipPos.w;
+
+			/*
+			 * Depth is only clamped at the near plane, which moves it away.
+			 * Depth beyond the far plane is kept, so the plane of the
+			 * triangle is not tilted toward the camera, and it never passes
+			 * the depth test against the cleared buffer.
+			*/
+
+			triangle.vertices [k] = glm::vec3 (
+				(ndcPos.x * 0.5f + 0.5f) * _width,
+				(ndcPos.y * 0.5f + 0.5f) * _height,
+				std::max (ndcPos.z * 0.5f + 0.5f, 0.0f)
+			);
+		}
+
+		if (isProjected == false) {
+			continue;
+		}
+
+		BinTriangle (triangle);
+	}
+}
+
+void SoftwareOcclusionCulling::Rasterize ()
+{
+	/*
+	 * Tiles are independent, each one owns its part of depth buffer
+	*/
+
+	for (std::size_t tileY = 0; tileY < _tilesY; tileY ++) {
+		for (std::size_t tileX = 0; tileX < _tilesX; tileX ++) {
+			RasterizeTile (tileX, tileY);
+		}
+	}
+}
+
+bool SoftwareOcclusionCulling::IsVisible (const AABBVolume& boundingBox) const
+{
+	glm::vec2 screenMin = glm::vec2 (std::numeric_limits<float>::infinity ());
+	glm::vec2 screenMax = glm::vec2 (-std::numeric_limits<float>::infinity ());
+	float minDepth = std::numeric_limits<float>::infinity ();
+
+	/*
+	 * Project bounding box corners on screen
+	*/
+
+	for (std::size_t i = 0; i < 8; i++) {
+		glm::vec3 corner = glm::vec3 (
+			(i & 1) ? boundingBox.maxVertex.x : boundingBox.minVertex.x,
+			(i & 2) ? boundingBox.maxVertex.y : boundingBox.minVertex.y,
+			(i & 4) ? boundingBox.maxVertex.z : boundingBox.minVertex.z
+		);
+
+		glm::vec4 clipPos = _viewProjectionMatrix * glm::vec4 (corner, 1.0f);
+
+		/*
+		 * Bounding box crosses the camera plane
+		*/
+
+		if (clipPos.w < MIN_CLIP_W) {
+			return true;
+		}
+
+		glm::vec3 ndcPos = glm::vec3 (clipPos) / clipPos.w;
+
+		glm::vec2 screenPos = glm::vec2 (
+			(ndcPos.x * 0.5f + 0.5f) * _width,
+			(ndcPos.y * 0.5f + 0.5f) * _height
+		);
+
+		screenMin = glm::min (screenMin, screenPos);
+		screenMax = glm::max (screenMax, screenPos);
+		minDepth = std::min (minDepth, ndcPos.z * 0.5f + 0.5f);
+	}
+
+	/*
+	 * Bounding box is in front of near plane
+	*/
+
+	if (minDepth <= 0.0f) {
+		return true;
+	}
+
+	/*
+	 * Clamp screen rectangle
+	*/
+
+	int minX = std::max ((int) std::floor (screenMin.x), 0);
+	int minY = std::max ((int) std::floor (screenMin.y), 0);
+	int maxX = std::min ((int) std::ceil (screenMax.x), (int) _width);
+	int maxY = std::min ((int) std::ceil (screenMax.y), (int) _height);
+
+	if (minX >= maxX || minY >= maxY) {
+		return false;
+	}
+
+	/*
+	 * Test every covered tile
+	*/
+
+	for (std::size_t tileY = minY / TILE_SIZE; tileY * TILE_SIZE < (std::size_t) maxY; tileY ++) {
+		for (std::size_t tileX = minX / TILE_SIZE; tileX * TILE_SIZE < (std::size_t) maxX; tileX ++) {
+
+			/*
+			 * Whole tile is covered by nearer occluders
+			*/
+
+			if (minDepth > _tilesMaxDepth [tileY * _tilesX + tileX]) {
+				continue;
+			}
+
+			std::size_t startX = std::max<std::size_t> (tileX * TILE_SIZE, minX) & ~((std::size_t) 3);
+			std::size_t endX = std::min<std::size_t> ((tileX + 1) * TILE_SIZE, maxX);
+			std::size_t startY = std::max<std::size_t> (tileY * TILE_SIZE, minY);
+			std::size_t endY = std::min<std::size_t> ((tileY + 1) * TILE_SIZE, maxY);
+
+			for (std::size_t y = startY; y < endY; y++) {
+				const float* depthRow = _depthBuffer.data () + y * _width;
+
+#ifdef OCCLUSION_CULLING_SSE
+				__m128 depth = _mm_set1_ps (minDepth);
+
+				for (std::size_t x = startX; x < endX; x += 4) {
+					__m128 occluderDepth = _mm_loadu_ps (depthRow + x);
+
+					if (_mm_movemask_ps (_mm_cmpge_ps (occluderDepth, depth)) != 0) {
+						return true;
+					}
+				}
+#else
+				for (std::size_t x = startX; x < endX; x++) {
+					if (depthRow [x] >= minDepth) {
+						return true;
+					}
+				}
+#endif
+			}
+		}
+	}
+
+	return false;
+}
+
+std::size_t SoftwareOcclusionCulling::GetWidth () const
+{
+	return _width;
+}
+
+std::size_t SoftwareOcclusionCulling::GetHeight () const
+{
+	return _height;
+}
+
+float SoftwareOcclusionCulling::GetDepth (std::size_t x, std::size_t y) const
+{
+	return _depthBuffer [y * _width + x];
+}
+
+std::size_t SoftwareOcclusionCulling::GetTrianglesCount () const
+{
+	return _triangles.size ();
+}
+
+void SoftwareOcclusionCulling::BinTriangle (const ScreenTriangle& triangle)
+{
+	const glm::vec3* v = triangle.vertices;
+
+	/*
+	 * Skip degenerated triangles
+	*/
+
+	float area = (v [1].x - v [0].x) * (v [2].y - v [0].y) - (v [1].y - v [0].y) * (v [2].x - v [0].x);
+
+	if (std::abs (area) < 1e-6f) {
+		return;
+	}
+
+	/*
+	 * Compute triangle screen rectangle
+	*/
+
+	float minX = std::min (v [0].x, std::min (v [1].x, v [2].x));
+	float minY = std::min (v [0].y, std::min (v [1].y, v [2].y));
+	float maxX = std::max (v [0].x, std::max (v [1].x, v [2].x));
+	float maxY = std::max (v [0].y, std::max (v [1].y, v [2].y));
+
+	if (maxX < 0.0f || maxY < 0.0f || minX >= _width || minY >= _height) {
+		return;
+	}
+
+	std::size_t startTileX = (std::size_t) std::max (minX, 0.0f) / TILE_SIZE;
+	std::size_t startTileY = (std::size_t) std::max (minY, 0.0f) / TILE_SIZE;
+	std::size_t endTileX = std::min ((std::size_t) maxX / TILE_SIZE, _tilesX - 1);
+	std::size_t endTileY = std::min ((std::size_t) maxY / TILE_SIZE, _tilesY - 1);
+
+	/*
+	 * Attach triangle to every overlapped tile
+	*/
+
+	_triangles.push_back (triangle);
+
+	std::size_t triangleIndex = _triangles.size () - 1;
+
+	for (std::size_t tileY = startTileY; tileY <= endTileY; tileY ++) {
+		for (std::size_t tileX = startTileX; tileX <= endTileX; tileX ++) {
+			_tileBins [tileY * _tilesX + tileX].push_back (triangleIndex);
+		}
+	}
+}
+
+void SoftwareOcclusionCulling::RasterizeTile (std::size_t tileX, std::size_t tileY)
+{
+	std::size_t tileIndex = tileY * _tilesX + tileX;
+
+	if (_tileBins [tileIndex].empty ()) {
+		return;
+	}
+
+	std::size_t minX = tileX * TILE_SIZE;
+	std::size_t minY = tileY * TILE_SIZE;
+	std::size_t maxX = minX + TILE_SIZE;
+	std::size_t maxY = minY + TILE_SIZE;
+
+	for (std::size_t triangleIndex : _tileBins [tileIndex]) {
+		RasterizeTriangle (_triangles [triangleIndex], minX, minY, maxX, maxY);
+	}
+
+	/*
+	 * Update farthest depth of tile
+	*/
+
+	float tileMaxDepth = 0.0f;
+
+	for (std::size_t y = minY; y < maxY; y++) {
+		for (std::size_t x = minX; x < maxX; x++) {
+			tileMaxDepth = std::max (tileMaxDepth, _depthBuffer [y * _width + x]);
+		}
+	}
+
+	_tilesMaxDepth [tileIndex] = tileMaxDepth;
+}
+
+/*
+ * Half-space rasterization with edge functions evaluated at pixel centers.
+ * Thanks to: https://fgiesen.wordpress.com/2013/02/08/triangle-rasterization-in-practice/
+*/
+
+void SoftwareOcclusionCulling::RasterizeTriangle (const ScreenTriangle& triangle,
+	std::size_t minX, std::size_t minY, std::size_t maxX, std::size_t maxY)
+{
+	glm::vec3 v0 = triangle.vertices [0];
+	glm::vec3 v1 = triangle.vertices [1];
+	glm::vec3 v2 = triangle.vertices [2];
+
+	/*
+	 * Make triangle counter clockwise, occluders are rasterized two sided
+	*/
+
+	float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+
+	if (area < 0.0f) {
+		std::swap (v1, v2);
+		area = -area;
+	}
+
+	/*
+	 * Edge functions E(x, y) = A * x + B * y + C, positive inside
+	*/
+
+	float a0 = v1.y - v2.y, b0 = v2.x - v1.x, c0 = v1.x * v2.y - v1.y * v2.x;
+	float a1 = v2.y - v0.y, b1 = v0.x - v2.x, c1 = v2.x * v0.y - v2.y * v0.x;
+	float a2 = v0.y - v1.y, b2 = v1.x - v0.x, c2 = v0.x * v1.y - v0.y * v1.x;
+
+	/*
+	 * Fill rule, pixel centers lying on an edge belong to only one of
+	 * the triangles sharing it, so the quads of occluders have no holes
+	 * along their diagonal
+	*/
+
+	bool owned0 = a0 < 0.0f || (a0 == 0.0f && b0 < 0.0f);
+	bool owned1 = a1 < 0.0f || (a1 == 0.0f && b1 < 0.0f);
+	bool owned2 = a2 < 0.0f || (a2 == 0.0f && b2 < 0.0f);
+
+	/*
+	 * Depth plane from barycentric weights
+	*/
+
+	float invArea = 1.0f / area;
+
+	float za = (a0 * v0.z + a1 * v1.z + a2 * v2.z) * invArea;
+	float zb = (b0 * v0.z + b1 * v1.z + b2 * v2.z) * invArea;
+	float zc = (c0 * v0.z + c1 * v1.z + c2 * v2.z) * invArea;
+
+	/*
+	 * Clamp triangle rectangle to tile
+	*/
+
+	float triMinX = std::min (v0.x, std::min (v1.x, v2.x));
+	float triMinY = std::min (v0.y, std::min (v1.y, v2.y));
+	float triMaxX = std::max (v0.x, std::max (v1.x, v2.x));
+	float triMaxY = std::max (v0.y, std::max (v1.y, v2.y));
+
+	std::size_t startX = std::max<std::size_t> (minX, (std::size_t) std::max (triMinX, 0.0f)) & ~((std::size_t) 3);
+	std::size_t startY = std::max<std::size_t> (minY, (std::size_t) std::max (triMinY, 0.0f));
+	std::size_t endX = std::min<std::size_t> (maxX, (std::size_t) std::max (triMaxX + 1.0f, 0.0f));
+	std::size_t endY = std::min<std::size_t> (maxY, (std::size_t) std::max (triMaxY + 1.0f, 0.0f));
+
+	for (std::size_t y = startY; y < endY; y++) {
+		float py = y + 0.5f;
+
+		float* depthRow = _depthBuffer.data () + y * _width;
+
+#ifdef OCCLUSION_CULLING_SSE
+		__m128 rowE0 = _mm_set1_ps (b0 * py + c0);
+		__m128 rowE1 = _mm_set1_ps (b1 * py + c1);
+		__m128 rowE2 = _mm_set1_ps (b2 * py + c2);
+		__m128 rowZ = _mm_set1_ps (zb * py + zc);
+
+		__m128 stepA0 = _mm_set1_ps (a0);
+		__m128 stepA1 = _mm_set1_ps (a1);
+		__m128 stepA2 = _mm_set1_ps (a2);
+		__m128 stepZ = _mm_set1_ps (za);
+
+		__m128 zero = _mm_setzero_ps ();
+
+		__m128 ownedEdge0 = _mm_castsi128_ps (_mm_set1_epi32 (owned0 ? -1 : 0));
+		__m128 ownedEdge1 = _mm_castsi128_ps (_mm_set1_epi32 (owned1 ? -1 : 0));
+		__m128 ownedEdge2 = _mm_castsi128_ps (_mm_set1_epi32 (owned2 ? -1 : 0));
+
+		for (std::size_t x = startX; x < endX; x += 4) {
+			__m128 px = _mm_add_ps (_mm_set1_ps (x + 0.5f), _mm_setr_ps (0.0f, 1.0f, 2.0f, 3.0f));
+
+			__m128 e0 = _mm_add_ps (_mm_mul_ps (stepA0, px), rowE0);
+			__m128 e1 = _mm_add_ps (_mm_mul_ps (stepA1, px), rowE1);
+			__m128 e2 = _mm_add_ps (_mm_mul_ps (stepA2, px), rowE2);
+
+			__m128 inside0 = _mm_or_ps (_mm_cmpgt_ps (e0, zero), _mm_and_ps (_mm_cmpeq_ps (e0, zero), ownedEdge0));
+			__m128 inside1 = _mm_or_ps (_mm_cmpgt_ps (e1, zero), _mm_and_ps (_mm_cmpeq_ps (e1, zero), ownedEdge1));
+			__m128 inside2 = _mm_or_ps (_mm_cmpgt_ps (e2, zero), _mm_and_ps (_mm_cmpeq_ps (e2, zero), ownedEdge2));
+
+			__m128 inside = _mm_and_ps (inside0, _mm_and_ps (inside1, inside2));
+
+			if (_mm_movemask_ps (inside) == 0) {
+				continue;
+			}
+
+			__m128 depth = _mm_add_ps (_mm_mul_ps (stepZ, px), rowZ);
+			__m128 currentDepth = _mm_loadu_ps (depthRow + x);
+			__m128 nearestDepth = _mm_min_ps (currentDepth, depth);
+
+			_mm_storeu_ps (depthRow + x, _mm_or_ps (_mm_and_ps (inside, nearestDepth),
+				_mm_andnot_ps (inside, currentDepth)));
+		}
+#else
+		for (std::size_t x = startX; x < endX; x++) {
+			float px = x + 0.5f;
+
+			float e0 = a0 * px + b0 * py + c0;
+			float e1 = a1 * px + b1 * py + c1;
+			float e2 = a2 * px + b2 * py + c2;
+
+			if (e0 < 0.0f || (e0 == 0.0f && !owned0) ||
+				e1 < 0.0f || (e1 == 0.0f && !owned1) ||
+				e2 < 0.0f || (e2 == 0.0f && !owned2)) {
+				continue;
+			}
+
+			depthRow [x] = std::min (depthRow [x], za * px + zb * py + zc);
+		}
+#endif
+	}
+}
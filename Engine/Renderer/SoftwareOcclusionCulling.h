@@ -0,0 +1,69 @@
+#ifndef SOFTWAREOCCLUSIONCULLING_H
+#define SOFTWAREOCCLUSIONCULLING_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+
+#include "Core/Intersections/AABBVolume.h"
+#include "Renderer/OccluderMesh.h"
+
+/*
+ * CPU occlusion culling on a low resolution depth buffer.
+ *
+ * Occluder triangles are transformed and binned into screen tiles,
+ * then every tile is rasterized independently, four pixels at a time.
+ * Candidates are tested by the screen space rectangle and nearest depth
+ * of their projected bounding box. Depth is stored as window depth in
+ * [0, 1], where 1 is the far plane.
+*/
+
+class ENGINE_API SoftwareOcclusionCulling : public Object
+{
+public:
+	static const std::size_t TILE_SIZE = 16;
+
+protected:
+	struct ScreenTriangle
+	{
+		glm::vec3 vertices [3];
+	};
+
+	std::size_t _width;
+	std::size_t _height;
+	std::size_t _tilesX;
+	std::size_t _tilesY;
+
+	glm::mat4 _viewProjectionMatrix;
+
+	std::vector<float> _depthBuffer;
+	std::vector<float> _tilesMaxDepth;
+
+	std::vector<ScreenTriangle> _triangles;
+	std::vector<std::vector<std::size_t>> _tileBins;
+
+public:
+	SoftwareOcclusionCulling ();
+
+	void SetResolution (std::size_t width, std::size_t height);
+
+	void Begin (const glm::mat4& viewProjectionMatrix);
+	void AttachOccluder (const OccluderMesh& occluderMesh, const glm::mat4& modelMatrix);
+	void Rasterize ();
+
+	bool IsVisible (const AABBVolume& boundingBox) const;
+
+	std::size_t GetWidth () const;
+	std::size_t GetHeight () const;
+	float GetDepth (std::size_t x, std::size_t y) const;
+	std::size_t GetTrianglesCount () const;
+protected:
+	void BinTriangle (const ScreenTriangle& triangle);
+	void RasterizeTile (std::size_t tileX, std::size_t tileY);
+	void RasterizeTriangle (const ScreenTriangle& triangle,
+		std::size_t minX, std::size_t minY, std::size_t maxX, std::size_t maxY);
+};
+
+#endif
@@ -0,0 +1,172 @@
+#include "TextGUIBatcher.h"
+
+#include <glm/vec4.hpp>
+
+#include "Renderer/RenderTextGUIObject.h"
+
+#include "Resources/Resources.h"
+#include "Renderer/RenderSystem.h"
+
+#include "Renderer/Pipeline.h"
+#include "Renderer/PersistentRingBuffer.h"
+
+#include "Wrappers/OpenGL/GL.h"
+
+TextGUIVertexData::TextGUIVertexData ()
+{
+	for (std::size_t i = 0; i < 2; i++) {
+		position [i] = texcoord [i] = 0;
+	}
+}
+
+Resource<ShaderView> TextGUIBatcher::_shaderView (nullptr);
+Resource<TextureView> TextGUIBatcher::_fontTextureView (nullptr);
+
+unsigned int TextGUIBatcher::_VAO_ID (0);
+unsigned int TextGUIBatcher::_VBO_ID (0);
+
+std::vector<TextGUIVertexData> TextGUIBatcher::_vertices;
+
+void TextGUIBatcher::Init ()
+{
+	/*
+	 * Shader for text GUI objects
+	*/
+
+	Resource<Shader> shader = Resources::LoadShader ({
+		"Assets/Shaders/fontVertex.glsl",
+		"Assets/Shaders/fontFragment.glsl"
+	});
+
+	_shaderView = RenderSystem::LoadShader (shader);
+
+	/*
+	 * Vertex buffer used when the ring buffer is not available
+	*/
+
+	GL::GenVertexArrays (1, &_VAO_ID);
+	GL::BindVertexArray (_VAO_ID);
+
+	GL::GenBuffers (1, &_VBO_ID);
+
+	GL::EnableVertexAttribArray (0);
+	GL::EnableVertexAttribArray (1);
+
+	BindVertexBuffer (_VBO_ID, 0);
+
+	GL::BindVertexArray (0);
+}
+
+void TextGUIBatcher::Clear ()
+{
+	_shaderView = nullptr;
+	_fontTextureView = nullptr;
+
+	_vertices.clear ();
+
+	/*
+	 * Delete buffers
+	*/
+
+	GL::DeleteBuffers (1, &_VBO_ID);
+	GL::DeleteVertexArrays (1, &_VAO_ID);
+}
+
+void TextGUIBatcher::Add (const RenderTextGUIObject* renderObject)
+{
+	if (renderObject->GetFontTextureView () == nullptr) {
+		return;
+	}
+
+	/*
+	 * Only text sharing the font texture goes in the same batch
+	*/
+
+	if (renderObject->GetFontTextureView () != _fontTextureView) {
+		Flush ();
+
+		_fontTextureView = renderObject->GetFontTextureView ();
+	}
+
+	/*
+	 * Move glyph quads in the space of the batch
+	*/
+
+	const glm::mat4& modelMatrix = renderObject->GetTransform ()->GetModelMatrix ();
+
+	for (const TextGUIVertexData& glyphVertex : renderObject->GetGlyphVertices ()) {
+		TextGUIVertexData vertex = glyphVertex;
+
+		glm::vec4 position = modelMatrix * glm::vec4 (glyphVertex.position [0], glyphVertex.position [1], 0.0f, 1.0f);
+
+		vertex.position [0] = position.x;
+		vertex.position [1] = position.y;
+
+		_vertices.push_back (vertex);
+	}
+}
+
+void TextGUIBatcher::Flush ()
+{
+	if (_vertices.empty ()) {
+		return;
+	}
+
+	GL::Disable (GL_CULL_FACE);
+	GL::Disable (GL_DEPTH_TEST);
+
+	GL::Enable (GL_BLEND);
+	GL::BlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	Pipeline::LockShader (_shaderView);
+
+	/*
+	 * Vertices are already transformed
+	*/
+
+	Pipeline::SetObjectTransform (Transform::Default ());
+	Pipeline::UpdateMatrices (_shaderView);
+
+	PipelineAttribute fontTexture;
+
+	fontTexture.type = PipelineAttribute::AttrType::ATTR_TEXTURE_2D;
+	fontTexture.name = "FontTexture";
+	fontTexture.value.x = _fontTextureView->GetGPUIndex ();
+
+	Pipeline::SendCustomAttributes (_shaderView, { fontTexture });
+
+	/*
+	 * Stream the batch through the ring buffer, fall back to
+	 * respecifying own buffer when it is not available
+	*/
+
+	GL::BindVertexArray (_VAO_ID);
+
+	std::size_t size = _vertices.size () * sizeof (TextGUIVertexData);
+
+	RingBufferAllocation allocation;
+
+	if (PersistentRingBuffer::Upload (GL_ARRAY_BUFFER, _vertices.data (), size, allocation) == true) {
+		BindVertexBuffer (allocation.buffer, allocation.offset);
+	} else {
+		BindVertexBuffer (_VBO_ID, 0);
+
+		GL::BufferData (GL_ARRAY_BUFFER, (GLsizeiptr) size, _vertices.data (), GL_STREAM_DRAW);
+	}
+
+	GL::DrawArrays (GL_TRIANGLES, 0, (GLsizei) _vertices.size ());
+
+	GL::BindVertexArray (0);
+
+	Pipeline::UnlockShader ();
+
+	_vertices.clear ();
+}
+
+void TextGUIBatcher::BindVertexBuffer (unsigned int buffer, std::size_t offset)
+{
+	GL::BindBuffer (GL_ARRAY_BUFFER, buffer);
+
+	GL::VertexAttribPointer (0, 2, GL_FLOAT, GL_FALSE, sizeof (TextGUIVertexData), (GLvoid*)(offset));
+	GL::VertexAttribPointer (1, 2, GL_FLOAT, GL_FALSE, sizeof (TextGUIVertexData), (GLvoid*)(offset + sizeof (float) * 2));
+}
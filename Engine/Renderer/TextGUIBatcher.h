@@ -0,0 +1,50 @@
+#ifndef TEXTGUIBATCHER_H
+#define TEXTGUIBATCHER_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/RenderViews/ShaderView.h"
+#include "Renderer/RenderViews/TextureView.h"
+
+struct TextGUIVertexData
+{
+	float position[2];
+	float texcoord[2];
+
+	TextGUIVertexData ();
+};
+
+class RenderTextGUIObject;
+
+/*
+ * Draws consecutive text GUI objects that share a font with a single
+ * call. Glyph quads are moved to screen space on the CPU and streamed
+ * through the ring buffer, so text that changes every frame never
+ * creates buffers of its own.
+*/
+
+class ENGINE_API TextGUIBatcher
+{
+private:
+	static Resource<ShaderView> _shaderView;
+	static Resource<TextureView> _fontTextureView;
+
+	static unsigned int _VAO_ID;
+	static unsigned int _VBO_ID;
+
+	static std::vector<TextGUIVertexData> _vertices;
+
+public:
+	static void Init ();
+	static void Clear ();
+
+	static void Add (const RenderTextGUIObject* renderObject);
+	static void Flush ();
+private:
+	static void BindVertexBuffer (unsigned int buffer, std::size_t offset);
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include "TransientFramebufferPool.h"
+
+#include "Renderer/RenderSystem.h"
+
+#define TRANSIENT_FRAMEBUFFER_MAX_UNUSED_FRAMES 3
+
+TransientFramebufferPool::TransientFramebufferPool () :
+	_frameIndex (0)
+{
+
+}
+
+void TransientFramebufferPool::Acquire (FramebufferRenderVolume* volume)
+{
+	PoolEntry* poolEntry = nullptr;
+
+	/*
+	 * Prefer the oldest free compatible framebuffer, it is the one
+	 * most likely to be shared with other targets
+	*/
+
+	for (auto& entry : _entries) {
+		if (entry.inUse == false && IsCompatible (entry.framebuffer, volume->GetFramebuffer ())) {
+			poolEntry = &entry;
+			break;
+		}
+	}
+
+	if (poolEntry == nullptr) {
+
+		/*
+		 * Hand over the framebuffer created with the volume if the
+		 * pool does not own it yet, otherwise create a new one
+		*/
+
+		bool isPooled = false;
+
+		for (const auto& entry : _entries) {
+			isPooled = isPooled || entry.framebufferView == volume->GetFramebufferView ();
+		}
+
+		PoolEntry entry;
+
+		entry.framebuffer = volume->GetFramebuffer ();
+		entry.framebufferView = isPooled ? RenderSystem::LoadFramebuffer (volume->GetFramebuffer ()) :
+			volume->GetFramebufferView ();
+
+		_entries.push_back (entry);
+
+		poolEntry = &_entries.back ();
+	}
+
+	poolEntry->inUse = true;
+	poolEntry->lastUsedFrame = _frameIndex;
+
+	if (poolEntry->framebufferView != volume->GetFramebufferView ()) {
+		volume->SetFramebufferView (poolEntry->framebufferView);
+	}
+}
+
+void TransientFramebufferPool::Release (FramebufferRenderVolume* volume)
+{
+	for (auto& entry : _entries) {
+		if (entry.framebufferView == volume->GetFramebufferView ()) {
+			entry.inUse = false;
+		}
+	}
+}
+
+void TransientFramebufferPool::EndFrame ()
+{
+	/*
+	 * Release framebuffers not used recently. Volumes still pointing
+	 * to them keep them alive until they acquire another one.
+	*/
+
+	for (std::size_t index = 0; index < _entries.size (); ) {
+		_entries [index].inUse = false;
+
+		if (_frameIndex - _entries [index].lastUsedFrame > TRANSIENT_FRAMEBUFFER_MAX_UNUSED_FRAMES) {
+			_entries.erase (_entries.begin () + index);
+			continue;
+		}
+
+		index ++;
+	}
+
+	_frameIndex ++;
+}
+
+void TransientFramebufferPool::Clear ()
+{
+	_entries.clear ();
+}
+
+bool TransientFramebufferPool::IsCompatible (const Resource<Framebuffer>& first, const Resource<Framebuffer>& second)
+{
+	if (first->GetTextureCount () != second->GetTextureCount ()) {
+		return false;
+	}
+
+	for (std::size_t index = 0; index < first->GetTextureCount (); index ++) {
+		if (IsCompatible (first->GetTexture (index), second->GetTexture (index)) == false) {
+			return false;
+		}
+	}
+
+	if ((first->GetDepthTexture () == nullptr) != (second->GetDepthTexture () == nullptr)) {
+		return false;
+	}
+
+	return first->GetDepthTexture () == nullptr ||
+		IsCompatible (first->GetDepthTexture (), second->GetDepthTexture ());
+}
+
+bool TransientFramebufferPool::IsCompatible (const Resource<Texture>& first, const Resource<Texture>& second)
+{
+	/*
+	 * Everything but the name, which is only used as attribute name
+	*/
+
+	Size firstSize = first->GetSize ();
+	Size secondSize = second->GetSize ();
+
+	return first->GetType () == second->GetType () &&
+		firstSize.width == secondSize.width &&
+		firstSize.height == secondSize.height &&
+		firstSize.depth == secondSize.depth &&
+		first->GenerateMipmap () == second->GenerateMipmap () &&
+		first->GetSizedInternalFormat () == second->GetSizedInternalFormat () &&
+		first->GetInternalFormat () == second->GetInternalFormat () &&
+		first->GetChannelType () == second->GetChannelType () &&
+		first->GetWrapMode () == second->GetWrapMode () &&
+		first->GetMinFilter () == second->GetMinFilter () &&
+		first->GetMagFilter () == second->GetMagFilter () &&
+		first->HasAnisotropicFiltering () == second->HasAnisotropicFiltering ();
+}
@@ -0,0 +1,45 @@
+#ifndef TRANSIENTFRAMEBUFFERPOOL_H
+#define TRANSIENTFRAMEBUFFERPOOL_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+
+#include "RenderPasses/FramebufferRenderVolume.h"
+
+/*
+ * Pool of GPU framebuffers shared by transient render targets. A volume
+ * acquires the first free framebuffer compatible with its description,
+ * so targets with disjoint lifetimes end up on the same memory.
+ * Framebuffers nobody acquired for a few frames are released.
+*/
+
+class ENGINE_API TransientFramebufferPool : public Object
+{
+protected:
+	struct PoolEntry
+	{
+		Resource<Framebuffer> framebuffer;
+		Resource<FramebufferView> framebufferView;
+		bool inUse;
+		std::size_t lastUsedFrame;
+	};
+
+	std::vector<PoolEntry> _entries;
+	std::size_t _frameIndex;
+
+public:
+	TransientFramebufferPool ();
+
+	void Acquire (FramebufferRenderVolume* volume);
+	void Release (FramebufferRenderVolume* volume);
+
+	void EndFrame ();
+
+	void Clear ();
+protected:
+	static bool IsCompatible (const Resource<Framebuffer>& first, const Resource<Framebuffer>& second);
+	static bool IsCompatible (const Resource<Texture>& first, const Resource<Texture>& second);
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef UPLOADSTATISTICSOBJECT_H
+#define UPLOADSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API UploadStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(UploadStatisticsObject)
+
+	std::size_t UploadedBytesCount;
+	std::size_t StallsCount;
+	std::size_t OverflowsCount;
+};
+
+#endif
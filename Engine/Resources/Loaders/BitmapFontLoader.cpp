@@ -39,6 +39,8 @@ Object* BitmapFontLoader::Load (const std::string& filename)
 
 	f.close ();
 
+	font->BuildGlyphs ();
+
 	return font;
 }
 
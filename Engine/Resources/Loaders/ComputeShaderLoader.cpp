@@ -8,7 +8,7 @@ Object* ComputeShaderLoader::Load(const std::string& filename)
 {
 	ComputeShader* shader = new ComputeShader (filename);
 
-	Resource<ShaderContent> shaderContent = Resources::LoadShaderContent (filename);
+	Resource<ShaderContent> shaderContent = LoadShaderContent (_filenames.empty () ? filename : _filenames [0]);
 
 	shader->SetComputeShaderContent (shaderContent);
 
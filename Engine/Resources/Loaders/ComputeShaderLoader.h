@@ -1,9 +1,9 @@
 #ifndef COMPUTESHADERLOADER_H
 #define COMPUTESHADERLOADER_H
 
-#include "Resources/ResourceLoader.h"
+#include "ShaderLoader.h"
 
-class ComputeShaderLoader : public ResourceLoader
+class ComputeShaderLoader : public ShaderLoader
 {
 public:
 	Object* Load(const std::string& filename);
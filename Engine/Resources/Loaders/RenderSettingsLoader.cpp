@@ -28,6 +28,27 @@ Object* RenderSettingsLoader::Load (const std::string& filename)
 		if (name == "RenderMode") {
 			ProcessRenderMode (content, settings);
 		}
+		else if (name == "DynamicResolution") {
+			ProcessDynamicResolution (content, settings);
+		}
+		else if (name == "GBuffer") {
+			ProcessGBuffer (content, settings);
+		}
+		else if (name == "OcclusionCulling") {
+			ProcessOcclusionCulling (content, settings);
+		}
+		else if (name == "LOD") {
+			ProcessLOD (content, settings);
+		}
+		else if (name == "ClusteredLighting") {
+			ProcessClusteredLighting (content, settings);
+		}
+		else if (name == "ShadowCascades") {
+			ProcessShadowCascades (content, settings);
+		}
+		else if (name == "SpotLightShadowAtlas") {
+			ProcessSpotLightShadowAtlas (content, settings);
+		}
 		else if (name == "SSAO") {
 			ProcessSSAO (content, settings);
 		}
@@ -40,6 +61,9 @@ Object* RenderSettingsLoader::Load (const std::string& filename)
 		else if (name == "TAA") {
 			ProcessTAA (content, settings);
 		}
+		else if (name == "Blur") {
+			ProcessBlur (content, settings);
+		}
 		else if (name == "Bloom") {
 			ProcessBloom (content, settings);
 		}
@@ -52,6 +76,9 @@ Object* RenderSettingsLoader::Load (const std::string& filename)
 		else if (name == "Gamma") {
 			ProcessGamma (content, settings);
 		}
+		else if (name == "PostProcessCompositor") {
+			ProcessPostProcessCompositor (content, settings);
+		}
 		else if (name == "RSM") {
 			ProcessRSM (content, settings);
 		}
@@ -85,6 +112,81 @@ void RenderSettingsLoader::ProcessRenderMode (TiXmlElement* xmlElem, RenderSetti
 	settings->renderMode = renderMode;
 }
 
+void RenderSettingsLoader::ProcessDynamicResolution (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string target = xmlElem->Attribute ("targetFrameTime");
+	std::string minScale = xmlElem->Attribute ("minScale");
+
+	settings->dynamic_resolution_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->dynamic_resolution_target = std::stof (target);
+	settings->dynamic_resolution_min_scale = std::stof (minScale);
+}
+
+void RenderSettingsLoader::ProcessGBuffer (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string packed = xmlElem->Attribute ("packed");
+
+	settings->gbuffer_packed = Extensions::StringExtend::ToBool (packed);
+}
+
+void RenderSettingsLoader::ProcessOcclusionCulling (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string width = xmlElem->Attribute ("width");
+	std::string height = xmlElem->Attribute ("height");
+
+	settings->occlusion_culling_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->occlusion_culling_width = std::stoul (width);
+	settings->occlusion_culling_height = std::stoul (height);
+}
+
+void RenderSettingsLoader::ProcessLOD (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string threshold1 = xmlElem->Attribute ("threshold1");
+	std::string threshold2 = xmlElem->Attribute ("threshold2");
+	std::string threshold3 = xmlElem->Attribute ("threshold3");
+
+	settings->lod_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->lod_threshold_1 = std::stof (threshold1);
+	settings->lod_threshold_2 = std::stof (threshold2);
+	settings->lod_threshold_3 = std::stof (threshold3);
+}
+
+void RenderSettingsLoader::ProcessClusteredLighting (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string width = xmlElem->Attribute ("width");
+	std::string height = xmlElem->Attribute ("height");
+	std::string depth = xmlElem->Attribute ("depth");
+
+	settings->clustered_lighting_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->clustered_lighting_width = std::stoul (width);
+	settings->clustered_lighting_height = std::stoul (height);
+	settings->clustered_lighting_depth = std::stoul (depth);
+}
+
+void RenderSettingsLoader::ProcessShadowCascades (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string amortizedUpdate = xmlElem->Attribute ("amortizedUpdate");
+	std::string updateInterval = xmlElem->Attribute ("updateInterval");
+
+	settings->shadow_cascades_amortized_update = Extensions::StringExtend::ToBool (amortizedUpdate);
+	settings->shadow_cascades_update_interval = std::stoul (updateInterval);
+}
+
+void RenderSettingsLoader::ProcessSpotLightShadowAtlas (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string size = xmlElem->Attribute ("size");
+	std::string updateBudget = xmlElem->Attribute ("updateBudget");
+
+	settings->spot_shadow_atlas_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->spot_shadow_atlas_size = std::stoul (size);
+	settings->spot_shadow_atlas_update_budget = std::stoul (updateBudget);
+}
+
 void RenderSettingsLoader::ProcessSSAO (TiXmlElement* xmlElem, RenderSettings* settings)
 {
 	std::string enabled = xmlElem->Attribute ("enabled");
@@ -120,6 +222,8 @@ void RenderSettingsLoader::ProcessSSDO (TiXmlElement* xmlElem, RenderSettings* s
 	std::string interpolationScale = xmlElem->Attribute ("interpolationScale");
 	std::string minInterpolationDistance = xmlElem->Attribute ("minInterpolationDistance");
 	std::string minInterpolationAngle = xmlElem->Attribute ("minInterpolationAngle");
+	std::string amortizationInterval = xmlElem->Attribute ("amortizationInterval");
+	std::string amortizationInterleaved = xmlElem->Attribute ("amortizationInterleaved");
 
 	settings->ssdo_enabled = Extensions::StringExtend::ToBool (enabled);
 	settings->ssdo_temporal_filter_enabled = Extensions::StringExtend::ToBool (temporalFilterEnabled);
@@ -135,6 +239,8 @@ void RenderSettingsLoader::ProcessSSDO (TiXmlElement* xmlElem, RenderSettings* s
 	settings->ssdo_interpolation_scale = std::stof (interpolationScale);
 	settings->ssdo_min_interpolation_distance = std::stof (minInterpolationDistance);
 	settings->ssdo_min_interpolation_angle = std::stof (minInterpolationAngle);
+	settings->ssdo_amortization_interval = std::stoul (amortizationInterval);
+	settings->ssdo_amortization_interleaved = Extensions::StringExtend::ToBool (amortizationInterleaved);
 }
 
 void RenderSettingsLoader::ProcessSSR (TiXmlElement* xmlElem, RenderSettings* settings)
@@ -163,6 +269,17 @@ void RenderSettingsLoader::ProcessTAA (TiXmlElement* xmlElem, RenderSettings* se
 	settings->taa_enabled = Extensions::StringExtend::ToBool (enabled);
 }
 
+void RenderSettingsLoader::ProcessBlur (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string computeEnabled = xmlElem->Attribute ("computeEnabled");
+	std::string radius = xmlElem->Attribute ("radius");
+	std::string format = xmlElem->Attribute ("format");
+
+	settings->blur_compute_enabled = Extensions::StringExtend::ToBool (computeEnabled);
+	settings->blur_radius = std::stoul (radius);
+	settings->blur_format = format;
+}
+
 void RenderSettingsLoader::ProcessBloom (TiXmlElement* xmlElem, RenderSettings* settings)
 {
 	std::string enabled = xmlElem->Attribute ("enabled");
@@ -203,6 +320,13 @@ void RenderSettingsLoader::ProcessGamma (TiXmlElement* xmlElem, RenderSettings*
 	settings->gamma_enabled = Extensions::StringExtend::ToBool (enabled);
 }
 
+void RenderSettingsLoader::ProcessPostProcessCompositor (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+
+	settings->post_process_compositor_enabled = Extensions::StringExtend::ToBool (enabled);
+}
+
 void RenderSettingsLoader::ProcessRSM (TiXmlElement* xmlElem, RenderSettings* settings)
 {
 	std::string scale = xmlElem->Attribute ("scale");
@@ -215,6 +339,8 @@ void RenderSettingsLoader::ProcessRSM (TiXmlElement* xmlElem, RenderSettings* se
 	std::string interpolationScale = xmlElem->Attribute ("interpolationScale");
 	std::string minInterpolationDistance = xmlElem->Attribute ("minInterpolationDistance");
 	std::string minInterpolationAngle = xmlElem->Attribute ("minInterpolationAngle");
+	std::string amortizationInterval = xmlElem->Attribute ("amortizationInterval");
+	std::string amortizationInterleaved = xmlElem->Attribute ("amortizationInterleaved");
 
 	settings->rsm_scale = std::stof (scale);
 	settings->rsm_samples = std::stoi (samples);
@@ -226,15 +352,21 @@ void RenderSettingsLoader::ProcessRSM (TiXmlElement* xmlElem, RenderSettings* se
 	settings->rsm_interpolation_scale = std::stof (interpolationScale);
 	settings->rsm_min_interpolation_distance = std::stof (minInterpolationDistance);
 	settings->rsm_min_interpolation_angle = std::stof (minInterpolationAngle);
+	settings->rsm_amortization_interval = std::stoul (amortizationInterval);
+	settings->rsm_amortization_interleaved = Extensions::StringExtend::ToBool (amortizationInterleaved);
 }
 
 void RenderSettingsLoader::ProcessTRSM (TiXmlElement* xmlElem, RenderSettings* settings)
 {
 	std::string temporalFilterEnabled = xmlElem->Attribute ("temporalFilterEnabled");
 	std::string blurEnabled = xmlElem->Attribute ("blurEnabled");
+	std::string amortizationInterval = xmlElem->Attribute ("amortizationInterval");
+	std::string amortizationInterleaved = xmlElem->Attribute ("amortizationInterleaved");
 
 	settings->trsm_temporal_filter_enabled = Extensions::StringExtend::ToBool (temporalFilterEnabled);
 	settings->trsm_blur_enabled = Extensions::StringExtend::ToBool (blurEnabled);
+	settings->trsm_amortization_interval = std::stoul (amortizationInterval);
+	settings->trsm_amortization_interleaved = Extensions::StringExtend::ToBool (amortizationInterleaved);
 }
 
 void RenderSettingsLoader::ProcessLPV (TiXmlElement* xmlElem, RenderSettings* settings)
@@ -246,6 +378,8 @@ void RenderSettingsLoader::ProcessLPV (TiXmlElement* xmlElem, RenderSettings* se
 	std::string indirectDiffuseIntensity = xmlElem->Attribute ("indirectDiffuseIntensity");
 	std::string indirectSpecularIntensity = xmlElem->Attribute ("indirectSpecularIntensity");
 	std::string indirectRefractiveIntensity = xmlElem->Attribute ("indirectRefractiveIntensity");
+	std::string cascadesCount = xmlElem->Attribute ("cascadesCount");
+	std::string cascadeExtent = xmlElem->Attribute ("cascadeExtent");
 
 	settings->lpv_volume_size = std::stoi (volumeSize);
 	settings->lpv_iterations = std::stoi (iterations);
@@ -254,12 +388,15 @@ void RenderSettingsLoader::ProcessLPV (TiXmlElement* xmlElem, RenderSettings* se
 	settings->lpv_indirect_diffuse_intensity = std::stof (indirectDiffuseIntensity);
 	settings->lpv_indirect_specular_intensity = std::stof (indirectSpecularIntensity);
 	settings->lpv_indirect_refractive_intensity = std::stof (indirectRefractiveIntensity);
+	settings->lpv_cascades_count = std::stoi (cascadesCount);
+	settings->lpv_cascade_extent = std::stof (cascadeExtent);
 }
 
 void RenderSettingsLoader::ProcessVCT (TiXmlElement* xmlElem, RenderSettings* settings)
 {
 	std::string voxelsSize = xmlElem->Attribute ("voxelsSize");
 	std::string continuousVoxelization = xmlElem->Attribute ("continuousVoxelization");
+	std::string incrementalVoxelization = xmlElem->Attribute ("incrementalVoxelization");
 	std::string bordering = xmlElem->Attribute ("bordering");
 	std::string mipmapLevels = xmlElem->Attribute ("mipmapLevels");
 	std::string indirectDiffuseIntensity = xmlElem->Attribute ("indirectDiffuseIntensity");
@@ -275,9 +412,12 @@ void RenderSettingsLoader::ProcessVCT (TiXmlElement* xmlElem, RenderSettings* se
 	std::string shadowConeRatio = xmlElem->Attribute ("shadowConeRatio");
 	std::string shadowConeDistance = xmlElem->Attribute ("shadowConeDistance");
 	std::string originBias = xmlElem->Attribute ("originBias");
+	std::string amortizationInterval = xmlElem->Attribute ("amortizationInterval");
+	std::string amortizationInterleaved = xmlElem->Attribute ("amortizationInterleaved");
 
 	settings->vct_voxels_size = std::stoi (voxelsSize);
 	settings->vct_continuous_voxelization = Extensions::StringExtend::ToBool (continuousVoxelization);
+	settings->vct_incremental_voxelization = Extensions::StringExtend::ToBool (incrementalVoxelization);
 	settings->vct_bordering = Extensions::StringExtend::ToBool (bordering);
 	settings->vct_mipmap_levels = std::stoi (mipmapLevels);
 	settings->vct_indirect_diffuse_intensity = std::stof (indirectDiffuseIntensity);
@@ -293,6 +433,8 @@ void RenderSettingsLoader::ProcessVCT (TiXmlElement* xmlElem, RenderSettings* se
 	settings->vct_shadow_cone_ratio = std::stof (shadowConeRatio);
 	settings->vct_shadow_cone_distance = std::stof (shadowConeDistance);
 	settings->vct_origin_bias = std::stof (originBias);
+	settings->vct_amortization_interval = std::stoul (amortizationInterval);
+	settings->vct_amortization_interleaved = Extensions::StringExtend::ToBool (amortizationInterleaved);
 }
 
 void RenderSettingsLoader::ProcessHGI (TiXmlElement* xmlElem, RenderSettings* settings)
@@ -313,6 +455,8 @@ void RenderSettingsLoader::ProcessHGI (TiXmlElement* xmlElem, RenderSettings* se
 	std::string aoRadius = xmlElem->Attribute ("aoRadius");
 	std::string aoBias = xmlElem->Attribute ("aoBias");
 	std::string aoBlend = xmlElem->Attribute ("aoBlend");
+	std::string amortizationInterval = xmlElem->Attribute ("amortizationInterval");
+	std::string amortizationInterleaved = xmlElem->Attribute ("amortizationInterleaved");
 
 	settings->hgi_rsm_samples = std::stoi (rsmSamples);
 	settings->hgi_rsm_radius = std::stof (rsmRadius);
@@ -330,4 +474,6 @@ void RenderSettingsLoader::ProcessHGI (TiXmlElement* xmlElem, RenderSettings* se
 	settings->hgi_ao_radius = std::stof (aoRadius);
 	settings->hgi_ao_bias = std::stof (aoBias);
 	settings->hgi_ao_blend = std::stof (aoBlend);
+	settings->hgi_amortization_interval = std::stoul (amortizationInterval);
+	settings->hgi_amortization_interleaved = Extensions::StringExtend::ToBool (amortizationInterleaved);
 }
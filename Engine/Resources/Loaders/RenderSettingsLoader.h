@@ -13,14 +13,23 @@ public:
 	Object* Load(const std::string& fileName);
 protected:
 	void ProcessRenderMode (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessDynamicResolution (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessGBuffer (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessOcclusionCulling (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessLOD (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessClusteredLighting (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessShadowCascades (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessSpotLightShadowAtlas (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSAO (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSDO (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSR (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessTAA (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessBlur (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessBloom (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessHDR (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessLUT (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessGamma (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessPostProcessCompositor (TiXmlElement* xmlElem, RenderSettings* settings);
 
 	void ProcessRSM (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessTRSM (TiXmlElement* xmlElem, RenderSettings* settings);
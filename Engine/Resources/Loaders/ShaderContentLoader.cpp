@@ -1,6 +1,7 @@
 #include "ShaderContentLoader.h"
 
 #include <fstream>
+#include <sstream>
 
 #include "Shader/ShaderContent.h"
 
@@ -29,7 +30,9 @@ Object* ShaderContentLoader::Load (const std::string& filename)
 
 		//TODO: Check comments
 		if (line.find ("#include") != std::string::npos) {
-			ProcessInclude (line, content, filename);
+			ProcessInclude (line, content, shaderContent);
+		} else if (line.find ("#pragma keywords") != std::string::npos) {
+			ProcessKeywords (line, shaderContent);
 		} else {
 			content += line + '\n';
 		}
@@ -40,14 +43,36 @@ Object* ShaderContentLoader::Load (const std::string& filename)
 	return shaderContent;
 }
 
-void ShaderContentLoader::ProcessInclude (const std::string& line, std::string& content, const std::string& filename)
+void ShaderContentLoader::ProcessInclude (const std::string& line, std::string& content, ShaderContent* shaderContent)
 {
 	std::string shadersDirectory = "Assets/Shaders/";
 
 	std::string includeFilename = line.substr (line.find ('\"') + 1, line.rfind ('\"') - line.find ('\"') - 1);
 	std::string includeFilePath = shadersDirectory + includeFilename;
 
-	Resource<ShaderContent> shaderContent = Resources::LoadShaderContent (includeFilePath);
+	Resource<ShaderContent> includeContent = Resources::LoadShaderContent (includeFilePath);
 
-	content += shaderContent->GetContent ();
+	content += includeContent->GetContent ();
+
+	/*
+	 * Keywords of the included file are keywords of the shader as well
+	*/
+
+	for (const std::string& keyword : includeContent->GetKeywords ()) {
+		shaderContent->AddKeyword (keyword);
+	}
+}
+
+void ShaderContentLoader::ProcessKeywords (const std::string& line, ShaderContent* shaderContent)
+{
+	/*
+	 * Feature keywords a variant may define, the line itself is left out
+	*/
+
+	std::istringstream stream (line.substr (line.find ("#pragma keywords") + std::string ("#pragma keywords").size ()));
+	std::string keyword;
+
+	while (stream >> keyword) {
+		shaderContent->AddKeyword (keyword);
+	}
 }
@@ -3,12 +3,15 @@
 
 #include "Resources/ResourceLoader.h"
 
+#include "Shader/ShaderContent.h"
+
 class ShaderContentLoader : public ResourceLoader
 {
 public:
 	Object* Load(const std::string& filename);
 protected:
-	void ProcessInclude (const std::string& line, std::string& content, const std::string& filename);
+	void ProcessInclude (const std::string& line, std::string& content, ShaderContent* shaderContent);
+	void ProcessKeywords (const std::string& line, ShaderContent* shaderContent);
 };
 
 #endif
\ No newline at end of file
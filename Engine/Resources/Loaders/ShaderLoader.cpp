@@ -8,14 +8,14 @@ Object* ShaderLoader::Load(const std::string& filename)
 {
 	DrawingShader* shader = new DrawingShader (filename);
 
-	Resource<ShaderContent> vertexShaderContent = Resources::LoadShaderContent (_filenames [0]);
-	Resource<ShaderContent> fragmentShaderContent = Resources::LoadShaderContent (_filenames [1]);
+	Resource<ShaderContent> vertexShaderContent = LoadShaderContent (_filenames [0]);
+	Resource<ShaderContent> fragmentShaderContent = LoadShaderContent (_filenames [1]);
 
 	shader->SetVertexShaderContent (vertexShaderContent);
 	shader->SetFragmentShaderContent (fragmentShaderContent);
 
 	if (_filenames.size () > 2) {
-		Resource<ShaderContent> geometryShaderContent = Resources::LoadShaderContent (_filenames [2]);
+		Resource<ShaderContent> geometryShaderContent = LoadShaderContent (_filenames [2]);
 
 		shader->SetGeometryShaderContent (geometryShaderContent);
 	}
@@ -26,4 +26,62 @@ Object* ShaderLoader::Load(const std::string& filename)
 void ShaderLoader::SetFilenames(const std::vector<std::string>& filenames)
 {
 	_filenames = filenames;
-}
\ No newline at end of file
+}
+
+void ShaderLoader::SetDefines (const std::vector<std::string>& defines)
+{
+	_defines = defines;
+}
+
+Resource<ShaderContent> ShaderLoader::LoadShaderContent (const std::string& filename)
+{
+	Resource<ShaderContent> shaderContent = Resources::LoadShaderContent (filename);
+
+	if (_defines.empty ()) {
+		return shaderContent;
+	}
+
+	/*
+	 * Variants share the source, with their defines right after the
+	 * version directive. Only the keywords the stage declares are
+	 * defined, so stages that don't depend on them are shared as well.
+	*/
+
+	std::string variantFilename = filename;
+	std::string defines;
+
+	for (const std::string& define : _defines) {
+		if (shaderContent->HasKeyword (define.substr (0, define.find (' '))) == false) {
+			continue;
+		}
+
+		variantFilename += "#" + define;
+		defines += "#define " + define + "\n";
+	}
+
+	if (defines.empty ()) {
+		return shaderContent;
+	}
+
+	if (Resource<ShaderContent>::GetResource (variantFilename) != nullptr) {
+		return Resource<ShaderContent>::GetResource (variantFilename);
+	}
+
+	std::string content = shaderContent->GetContent ();
+
+	std::size_t versionEnd = content.find ("#version") != std::string::npos ?
+		content.find ('\n', content.find ("#version")) + 1 : 0;
+
+	content.insert (versionEnd, defines);
+
+	ShaderContent* variantContent = new ShaderContent ();
+
+	variantContent->SetFilename (filename);
+	variantContent->SetContent (content);
+
+	for (const std::string& keyword : shaderContent->GetKeywords ()) {
+		variantContent->AddKeyword (keyword);
+	}
+
+	return Resource<ShaderContent> (variantContent, variantFilename);
+}
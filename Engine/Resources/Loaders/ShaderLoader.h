@@ -5,15 +5,22 @@
 
 #include <vector>
 
+#include "Core/Resources/Resource.h"
+#include "Shader/ShaderContent.h"
+
 class ShaderLoader : public ResourceLoader
 {
 protected:
 	std::vector<std::string> _filenames;
+	std::vector<std::string> _defines;
 
 public:
 	Object* Load(const std::string& filename);
 
 	void SetFilenames(const std::vector<std::string>& filenames);
+	void SetDefines (const std::vector<std::string>& defines);
+protected:
+	Resource<ShaderContent> LoadShaderContent (const std::string& filename);
 };
 
 #endif
\ No newline at end of file
@@ -201,6 +201,53 @@ Resource<Shader> Resources::LoadShader (const std::vector<std::string>& filename
 	return Resource<Shader> (shader, filename);
 }
 
+Resource<Shader> Resources::LoadShader (const std::vector<std::string>& filenames, const std::vector<std::string>& defines)
+{
+	/*
+	 * Every set of defines is a distinct shader variant. Defines are
+	 * kept only when a stage declares their keyword, so variants that
+	 * differ by unused features are not compiled twice.
+	*/
+
+	std::vector<std::string> variantDefines;
+
+	for (const std::string& define : defines) {
+		std::string keyword = define.substr (0, define.find (' '));
+
+		for (const std::string& shaderFilename : filenames) {
+			if (LoadShaderContent (shaderFilename)->HasKeyword (keyword) == true) {
+				variantDefines.push_back (define);
+				break;
+			}
+		}
+	}
+
+	if (variantDefines.empty ()) {
+		return LoadShader (filenames);
+	}
+
+	std::string filename = filenames [0] + filenames [1] + (filenames.size () > 2 ? filenames [2] : "");
+
+	for (const std::string& define : variantDefines) {
+		filename += "#" + define;
+	}
+
+	if (Resource<Shader>::GetResource (filename) != nullptr) {
+		return Resource<Shader>::GetResource (filename);
+	}
+
+	ShaderLoader* shaderLoader = new ShaderLoader ();
+
+	shaderLoader->SetFilenames (filenames);
+	shaderLoader->SetDefines (variantDefines);
+
+	Shader* shader = (Shader*)shaderLoader->Load (filename);
+
+	delete shaderLoader;
+
+	return Resource<Shader> (shader, filename);
+}
+
 Resource<Shader> Resources::LoadComputeShader (const std::string& filename)
 {
 	if (Resource<Shader>::GetResource (filename) != nullptr) {
@@ -216,6 +263,47 @@ Resource<Shader> Resources::LoadComputeShader (const std::string& filename)
 	return Resource<Shader> (shader, filename);
 }
 
+Resource<Shader> Resources::LoadComputeShader (const std::string& filename, const std::vector<std::string>& defines)
+{
+	/*
+	 * Same variant rules as drawing shaders, defines are kept only
+	 * when the compute stage declares their keyword
+	*/
+
+	std::vector<std::string> variantDefines;
+
+	for (const std::string& define : defines) {
+		if (LoadShaderContent (filename)->HasKeyword (define.substr (0, define.find (' '))) == true) {
+			variantDefines.push_back (define);
+		}
+	}
+
+	if (variantDefines.empty ()) {
+		return LoadComputeShader (filename);
+	}
+
+	std::string variantFilename = filename;
+
+	for (const std::string& define : variantDefines) {
+		variantFilename += "#" + define;
+	}
+
+	if (Resource<Shader>::GetResource (variantFilename) != nullptr) {
+		return Resource<Shader>::GetResource (variantFilename);
+	}
+
+	ComputeShaderLoader* computeShaderLoader = new ComputeShaderLoader ();
+
+	computeShaderLoader->SetFilenames ({ filename });
+	computeShaderLoader->SetDefines (variantDefines);
+
+	Shader* shader = (Shader*)computeShaderLoader->Load (variantFilename);
+
+	delete computeShaderLoader;
+
+	return Resource<Shader> (shader, variantFilename);
+}
+
 Resource<ShaderContent> Resources::LoadShaderContent (const std::string& filename)
 {
 	if (Resource<ShaderContent>::GetResource (filename) != nullptr) {
@@ -41,7 +41,9 @@ public:
 	static Resource<AudioClip> LoadAudioClip (const std::string& filename);
 
 	static Resource<Shader> LoadShader (const std::vector<std::string>& filenames);
+	static Resource<Shader> LoadShader (const std::vector<std::string>& filenames, const std::vector<std::string>& defines);
 	static Resource<Shader> LoadComputeShader (const std::string& filename);
+	static Resource<Shader> LoadComputeShader (const std::string& filename, const std::vector<std::string>& defines);
 	static Resource<ShaderContent> LoadShaderContent (const std::string& filename);
 	
 	static Resource<Texture> LoadTexture (const std::string& filename);
@@ -163,6 +163,26 @@ Transform & Transform::operator=(const Transform& other)
 	return *this;
 }
 
+void Transform::CopyState (const Transform& other)
+{
+	/*
+	 * Copy world and local state without the hierarchy
+	*/
+
+	_position = other._position;
+	_rotation = other._rotation;
+	_scale = other._scale;
+
+	_localPosition = other._localPosition;
+	_localRotation = other._localRotation;
+	_localScale = other._localScale;
+
+	_isDirty = other._isDirty;
+
+	_localModelMatrix = other._localModelMatrix;
+	_modelMatrix = other._modelMatrix;
+}
+
 bool Transform::IsDirty () const
 {
 	return _isDirty;
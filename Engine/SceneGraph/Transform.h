@@ -70,6 +70,8 @@ public:
 
 	Transform & operator=(const Transform& other);
 
+	void CopyState (const Transform& other);
+
 	const glm::mat4& GetModelMatrix () const;
 
 	MULTIPLE_CONTAINER_TEMPLATE (set)
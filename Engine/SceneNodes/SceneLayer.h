@@ -7,7 +7,8 @@ enum SceneLayer {
 	ANIMATION = 4,
 	NORMAL_MAP = 8,
 	LIGHT_MAP = 16,
-	TRANSLUCENCY = 32
+	TRANSLUCENCY = 32,
+	OCCLUDER = 64
 };
 
 #endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "ShaderContent.h"
 
+#include <algorithm>
+
 void ShaderContent::SetFilename (const std::string& filename)
 {
 	_filename = filename;
@@ -10,6 +12,13 @@ void ShaderContent::SetContent (const std::string& content)
 	_content = content;
 }
 
+void ShaderContent::AddKeyword (const std::string& keyword)
+{
+	if (HasKeyword (keyword) == false) {
+		_keywords.push_back (keyword);
+	}
+}
+
 const std::string& ShaderContent::GetFilename () const
 {
 	return _filename;
@@ -19,3 +28,13 @@ const std::string& ShaderContent::GetContent () const
 {
 	return _content;
 }
+
+const std::vector<std::string>& ShaderContent::GetKeywords () const
+{
+	return _keywords;
+}
+
+bool ShaderContent::HasKeyword (const std::string& keyword) const
+{
+	return std::find (_keywords.begin (), _keywords.end (), keyword) != _keywords.end ();
+}
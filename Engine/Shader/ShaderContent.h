@@ -3,18 +3,25 @@
 
 #include "Core/Interfaces/Object.h"
 
+#include <string>
+#include <vector>
+
 class ShaderContent : public Object
 {
 protected:
 	std::string _filename;
 	std::string _content;
+	std::vector<std::string> _keywords;
 
 public:
 	void SetFilename (const std::string& filename);
 	void SetContent (const std::string& content);
+	void AddKeyword (const std::string& keyword);
 
 	const std::string& GetFilename () const;
 	const std::string& GetContent () const;
+	const std::vector<std::string>& GetKeywords () const;
+	bool HasKeyword (const std::string& keyword) const;
 };
 
 #endif
\ No newline at end of file
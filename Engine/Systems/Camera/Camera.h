@@ -55,6 +55,8 @@ public:
 	virtual FrustumVolume GetFrustumVolume () const = 0;
 
 	virtual glm::mat4 GetProjectionMatrix () const = 0;
+
+	virtual Camera* Clone () const = 0;
 };
 
 #endif
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "Core/Console/Console.h"
 
+#include "Arguments/ArgumentsAnalyzer.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 #include "Systems/Camera/Camera.h"
@@ -35,6 +37,18 @@ bool Window::Init ()
 	
 	std::size_t windowFlags = SDL_WINDOW_OPENGL | (_fullscreen ? SDL_WINDOW_FULLSCREEN : 0) | SDL_WINDOW_RESIZABLE;
 
+	/*
+	 * Headless window is never shown. Software drivers (Mesa llvmpipe)
+	 * expose 4.5 only on core profile contexts.
+	*/
+
+	if (ArgumentsAnalyzer::Instance ()->GetArgument ("headless") != nullptr) {
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+
+		windowFlags = SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN;
+	}
+
 	_window = SDL_CreateWindow (_title.c_str (), 0, 0, _width, _height, windowFlags);
 
 	if (_window == nullptr) {
@@ -48,6 +62,11 @@ bool Window::Init ()
 
 	_glContext = SDL_GL_CreateContext(_window);
 
+	if (_glContext == nullptr) {
+		Console::LogError ("OpenGL context could not be created: " + std::string (SDL_GetError ()));
+		return false;
+	}
+
 	return true;
 }
 
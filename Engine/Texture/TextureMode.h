@@ -38,6 +38,7 @@ enum TEXTURE_SIZED_INTERNAL_FORMAT
 	FORMAT_RGBA8,
 	FORMAT_RGBA16,
 	FORMAT_RGBA32,
+	FORMAT_R11G11B10F,
 	FORMAT_DEPTH16,
 	FORMAT_DEPTH32,
 	FORMAT_DEPTH24_STENCIL8,
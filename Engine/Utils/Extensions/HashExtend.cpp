@@ -0,0 +1,12 @@
+#include "HashExtend.h"
+
+using namespace Extensions;
+
+void HashExtend::Combine (std::size_t& seed, const glm::mat4& matrix)
+{
+	for (std::size_t column = 0; column < 4; column ++) {
+		for (std::size_t row = 0; row < 4; row ++) {
+			Combine (seed, matrix [column][row]);
+		}
+	}
+}
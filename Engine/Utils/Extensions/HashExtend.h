@@ -0,0 +1,30 @@
+#ifndef HASHEXTEND_H
+#define HASHEXTEND_H
+
+#include <functional>
+#include <glm/mat4x4.hpp>
+
+namespace Extensions
+{
+	/*
+	 * Order dependent combination of hashes, for signatures that tell
+	 * whether cached results are still valid
+	*/
+
+	class ENGINE_API HashExtend
+	{
+	public:
+		template <class T>
+		static void Combine (std::size_t& seed, const T& value);
+
+		static void Combine (std::size_t& seed, const glm::mat4& matrix);
+	};
+
+	template <class T>
+	void HashExtend::Combine (std::size_t& seed, const T& value)
+	{
+		seed ^= std::hash<T> () (value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+}
+
+#endif
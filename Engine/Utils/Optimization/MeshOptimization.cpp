@@ -0,0 +1,369 @@
+#include "MeshOptimization.h"
+
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+/*
+ * Tipsify: fan around the last vertex, jump to the neighbour that is
+ * still going to be in cache after its remaining triangles are emitted.
+*/
+
+std::vector<unsigned int> MeshOptimization::OptimizeVertexCache (const std::vector<unsigned int>& indices, std::size_t verticesCount)
+{
+	std::size_t trianglesCount = indices.size () / 3;
+
+	/*
+	 * Build vertex to triangles adjacency
+	*/
+
+	std::vector<std::size_t> liveTriangles (verticesCount, 0);
+
+	for (unsigned int index : indices) {
+		liveTriangles [index] ++;
+	}
+
+	std::vector<std::size_t> adjacencyOffsets (verticesCount + 1, 0);
+
+	for (std::size_t vertex = 0; vertex < verticesCount; vertex ++) {
+		adjacencyOffsets [vertex + 1] = adjacencyOffsets [vertex] + liveTriangles [vertex];
+	}
+
+	std::vector<std::size_t> adjacency (indices.size ());
+	std::vector<std::size_t> adjacencyFill (adjacencyOffsets.begin (), adjacencyOffsets.end () - 1);
+
+	for (std::size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex ++) {
+		for (std::size_t k = 0; k < 3; k++) {
+			unsigned int vertex = indices [triangleIndex * 3 + k];
+			adjacency [adjacencyFill [vertex] ++] = triangleIndex;
+		}
+	}
+
+	std::vector<std::size_t> timestamps (verticesCount, 0);
+	std::vector<bool> emitted (trianglesCount, false);
+	std::vector<unsigned int> deadEnds;
+	std::vector<unsigned int> candidates;
+
+	std::vector<unsigned int> result;
+	result.reserve (indices.size ());
+
+	std::size_t timestamp = VERTEX_CACHE_SIZE + 1;
+	std::size_t cursor = 0;
+
+	/*
+	 * Start with the first vertex used
+	*/
+
+	long long fanningVertex = indices.empty () ? -1 : indices [0];
+
+	while (fanningVertex >= 0) {
+		candidates.clear ();
+
+		for (std::size_t adjacencyIndex = adjacencyOffsets [fanningVertex];
+			adjacencyIndex < adjacencyOffsets [fanningVertex + 1]; adjacencyIndex ++) {
+
+			std::size_t triangleIndex = adjacency [adjacencyIndex];
+
+			if (emitted [triangleIndex]) {
+				continue;
+			}
+
+			for (std::size_t k = 0; k < 3; k++) {
+				unsigned int vertex = indices [triangleIndex * 3 + k];
+
+				result.push_back (vertex);
+				deadEnds.push_back (vertex);
+				candidates.push_back (vertex);
+
+				liveTriangles [vertex] --;
+
+				if (timestamp - timestamps [vertex] > VERTEX_CACHE_SIZE) {
+					timestamps [vertex] = timestamp ++;
+				}
+			}
+
+			emitted [triangleIndex] = true;
+		}
+
+		/*
+		 * Pick the oldest candidate that will still be in cache
+		*/
+
+		fanningVertex = -1;
+		long long bestPriority = -1;
+
+		for (unsigned int vertex : candidates) {
+			if (liveTriangles [vertex] == 0) {
+				continue;
+			}
+
+			long long priority = 0;
+
+			if (timestamp - timestamps [vertex] + 2 * liveTriangles [vertex] <= VERTEX_CACHE_SIZE) {
+				priority = timestamp - timestamps [vertex];
+			}
+
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				fanningVertex = vertex;
+			}
+		}
+
+		if (fanningVertex >= 0) {
+			continue;
+		}
+
+		/*
+		 * Dead end, go back to recently used vertices first
+		*/
+
+		while (!deadEnds.empty ()) {
+			unsigned int vertex = deadEnds.back ();
+			deadEnds.pop_back ();
+
+			if (liveTriangles [vertex] > 0) {
+				fanningVertex = vertex;
+				break;
+			}
+		}
+
+		while (fanningVertex < 0 && cursor < verticesCount) {
+			if (liveTriangles [cursor] > 0) {
+				fanningVertex = cursor;
+			}
+
+			cursor ++;
+		}
+	}
+
+	return result;
+}
+
+/*
+ * Split the cache optimized order in clusters that can be freely
+ * reordered, then draw outward facing clusters first.
+*/
+
+std::vector<unsigned int> MeshOptimization::OptimizeOverdraw (const std::vector<unsigned int>& indices,
+	const std::vector<glm::vec3>& positions, float threshold)
+{
+	std::size_t trianglesCount = indices.size () / 3;
+
+	if (trianglesCount == 0) {
+		return indices;
+	}
+
+	std::vector<std::size_t> cacheMisses = GetCacheMisses (indices, positions.size ());
+
+	std::size_t totalCacheMisses = 0;
+	for (std::size_t misses : cacheMisses) {
+		totalCacheMisses += misses;
+	}
+
+	float meshACMR = (float) totalCacheMisses / trianglesCount;
+
+	/*
+	 * Hard boundaries are triangles missing all their vertices, the
+	 * cache is already cold there. Soft boundaries close a cluster as
+	 * soon as its cold cache ACMR is close enough to the mesh one.
+	*/
+
+	std::vector<std::size_t> clusters;
+
+	std::vector<std::size_t> timestamps (positions.size (), 0);
+	std::size_t timestamp = VERTEX_CACHE_SIZE + 1;
+
+	std::size_t clusterMisses = 0;
+	std::size_t clusterTriangles = 0;
+
+	bool isClusterClosed = true;
+
+	for (std::size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex ++) {
+		if (isClusterClosed == true || cacheMisses [triangleIndex] == 3) {
+			clusters.push_back (triangleIndex);
+
+			timestamp += VERTEX_CACHE_SIZE + 1;
+			clusterMisses = clusterTriangles = 0;
+
+			isClusterClosed = false;
+		}
+
+		for (std::size_t k = 0; k < 3; k++) {
+			unsigned int vertex = indices [triangleIndex * 3 + k];
+
+			if (timestamp - timestamps [vertex] > VERTEX_CACHE_SIZE) {
+				timestamps [vertex] = timestamp ++;
+				clusterMisses ++;
+			}
+		}
+
+		clusterTriangles ++;
+
+		if ((float) clusterMisses / clusterTriangles <= threshold * meshACMR) {
+			isClusterClosed = true;
+		}
+	}
+
+	/*
+	 * Sort clusters by how much they face away from mesh center
+	*/
+
+	glm::vec3 meshCenter = glm::vec3 (0.0f);
+
+	for (unsigned int index : indices) {
+		meshCenter += positions [index];
+	}
+
+	meshCenter /= (float) indices.size ();
+
+	std::vector<std::pair<float, std::size_t>> clusterOrder;
+
+	for (std::size_t clusterIndex = 0; clusterIndex < clusters.size (); clusterIndex ++) {
+		std::size_t begin = clusters [clusterIndex];
+		std::size_t end = clusterIndex + 1 < clusters.size () ? clusters [clusterIndex + 1] : trianglesCount;
+
+		glm::vec3 clusterCenter = glm::vec3 (0.0f);
+		glm::vec3 clusterNormal = glm::vec3 (0.0f);
+		float clusterArea = 0.0f;
+
+		for (std::size_t triangleIndex = begin; triangleIndex < end; triangleIndex ++) {
+			const glm::vec3& p0 = positions [indices [triangleIndex * 3 + 0]];
+			const glm::vec3& p1 = positions [indices [triangleIndex * 3 + 1]];
+			const glm::vec3& p2 = positions [indices [triangleIndex * 3 + 2]];
+
+			glm::vec3 normal = glm::cross (p1 - p0, p2 - p0);
+			float area = glm::length (normal);
+
+			clusterCenter += (p0 + p1 + p2) * (area / 3.0f);
+			clusterNormal += normal;
+			clusterArea += area;
+		}
+
+		float sortKey = 0.0f;
+
+		if (clusterArea > 0.0f && glm::length (clusterNormal) > 0.0f) {
+			clusterCenter /= clusterArea;
+			sortKey = glm::dot (clusterCenter - meshCenter, glm::normalize (clusterNormal));
+		}
+
+		clusterOrder.push_back (std::make_pair (-sortKey, clusterIndex));
+	}
+
+	std::stable_sort (clusterOrder.begin (), clusterOrder.end (),
+		[] (const std::pair<float, std::size_t>& a, const std::pair<float, std::size_t>& b) {
+			return a.first < b.first;
+		});
+
+	std::vector<unsigned int> result;
+	result.reserve (indices.size ());
+
+	for (auto& cluster : clusterOrder) {
+		std::size_t begin = clusters [cluster.second];
+		std::size_t end = cluster.second + 1 < clusters.size () ? clusters [cluster.second + 1] : trianglesCount;
+
+		result.insert (result.end (), indices.begin () + begin * 3, indices.begin () + end * 3);
+	}
+
+	return result;
+}
+
+/*
+ * Renumber vertices in order of first use. Returns old to new vertex
+ * index table, vertices that are never referenced go last.
+*/
+
+std::vector<unsigned int> MeshOptimization::OptimizeVertexFetch (std::vector<unsigned int>& indices, std::size_t verticesCount)
+{
+	const unsigned int UNUSED = (unsigned int) -1;
+
+	std::vector<unsigned int> remap (verticesCount, UNUSED);
+
+	unsigned int nextVertex = 0;
+
+	for (unsigned int& index : indices) {
+		if (remap [index] == UNUSED) {
+			remap [index] = nextVertex ++;
+		}
+
+		index = remap [index];
+	}
+
+	for (unsigned int& vertex : remap) {
+		if (vertex == UNUSED) {
+			vertex = nextVertex ++;
+		}
+	}
+
+	return remap;
+}
+
+/*
+ * Average cache miss ratio, transformed vertices per triangle
+*/
+
+float MeshOptimization::GetACMR (const std::vector<unsigned int>& indices, std::size_t verticesCount)
+{
+	if (indices.empty ()) {
+		return 0.0f;
+	}
+
+	std::size_t totalCacheMisses = 0;
+
+	for (std::size_t misses : GetCacheMisses (indices, verticesCount)) {
+		totalCacheMisses += misses;
+	}
+
+	return (float) totalCacheMisses / (indices.size () / 3);
+}
+
+/*
+ * Average transform to vertex ratio, 1 is optimal
+*/
+
+float MeshOptimization::GetATVR (const std::vector<unsigned int>& indices, std::size_t verticesCount)
+{
+	std::vector<bool> used (verticesCount, false);
+	std::size_t usedVerticesCount = 0;
+
+	for (unsigned int index : indices) {
+		if (used [index] == false) {
+			used [index] = true;
+			usedVerticesCount ++;
+		}
+	}
+
+	if (usedVerticesCount == 0) {
+		return 0.0f;
+	}
+
+	std::size_t totalCacheMisses = 0;
+
+	for (std::size_t misses : GetCacheMisses (indices, verticesCount)) {
+		totalCacheMisses += misses;
+	}
+
+	return (float) totalCacheMisses / usedVerticesCount;
+}
+
+/*
+ * Simulate a FIFO post-transform cache, return misses of every triangle
+*/
+
+std::vector<std::size_t> MeshOptimization::GetCacheMisses (const std::vector<unsigned int>& indices, std::size_t verticesCount)
+{
+	std::vector<std::size_t> cacheMisses (indices.size () / 3, 0);
+
+	std::vector<std::size_t> timestamps (verticesCount, 0);
+	std::size_t timestamp = VERTEX_CACHE_SIZE + 1;
+
+	for (std::size_t index = 0; index < cacheMisses.size () * 3; index ++) {
+		unsigned int vertex = indices [index];
+
+		if (timestamp - timestamps [vertex] > VERTEX_CACHE_SIZE) {
+			timestamps [vertex] = timestamp ++;
+			cacheMisses [index / 3] ++;
+		}
+	}
+
+	return cacheMisses;
+}
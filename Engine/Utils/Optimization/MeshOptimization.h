@@ -0,0 +1,30 @@
+#ifndef MESHOPTIMIZATION_H
+#define MESHOPTIMIZATION_H
+
+#include <vector>
+#include <glm/vec3.hpp>
+
+/*
+ * Index and vertex buffers reordering for the post-transform vertex
+ * cache, overdraw and vertex fetch locality.
+ * Thanks to: Sander, Nehab and Barczak, Fast Triangle Reordering for
+ * Vertex Locality and Reduced Overdraw
+*/
+
+class MeshOptimization
+{
+public:
+	static const std::size_t VERTEX_CACHE_SIZE = 16;
+
+	static std::vector<unsigned int> OptimizeVertexCache (const std::vector<unsigned int>& indices, std::size_t verticesCount);
+	static std::vector<unsigned int> OptimizeOverdraw (const std::vector<unsigned int>& indices,
+		const std::vector<glm::vec3>& positions, float threshold);
+	static std::vector<unsigned int> OptimizeVertexFetch (std::vector<unsigned int>& indices, std::size_t verticesCount);
+
+	static float GetACMR (const std::vector<unsigned int>& indices, std::size_t verticesCount);
+	static float GetATVR (const std::vector<unsigned int>& indices, std::size_t verticesCount);
+protected:
+	static std::vector<std::size_t> GetCacheMisses (const std::vector<unsigned int>& indices, std::size_t verticesCount);
+};
+
+#endif
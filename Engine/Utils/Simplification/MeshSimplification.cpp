@@ -0,0 +1,290 @@
+#include "MeshSimplification.h"
+
+#include <queue>
+#include <functional>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+/*
+ * Symmetric 4x4 matrix of plane equations
+*/
+
+struct Quadric
+{
+	double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+
+	Quadric () :
+		a2 (0), ab (0), ac (0), ad (0), b2 (0), bc (0), bd (0), c2 (0), cd (0), d2 (0)
+	{
+
+	}
+
+	Quadric (double a, double b, double c, double d, double weight) :
+		a2 (a * a * weight), ab (a * b * weight), ac (a * c * weight), ad (a * d * weight),
+		b2 (b * b * weight), bc (b * c * weight), bd (b * d * weight),
+		c2 (c * c * weight), cd (c * d * weight),
+		d2 (d * d * weight)
+	{
+
+	}
+
+	Quadric& operator+= (const Quadric& other)
+	{
+		a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+		b2 += other.b2; bc += other.bc; bd += other.bd;
+		c2 += other.c2; cd += other.cd;
+		d2 += other.d2;
+
+		return *this;
+	}
+
+	double Evaluate (const glm::vec3& v) const
+	{
+		double x = v.x, y = v.y, z = v.z;
+
+		return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+			+ b2 * y * y + 2 * bc * y * z + 2 * bd * y
+			+ c2 * z * z + 2 * cd * z
+			+ d2;
+	}
+};
+
+struct Collapse
+{
+	double cost;
+	unsigned int from;
+	unsigned int to;
+	std::size_t fromVersion;
+	std::size_t toVersion;
+
+	bool operator> (const Collapse& other) const
+	{
+		return cost > other.cost;
+	}
+};
+
+static unsigned long long EdgeKey (unsigned int v0, unsigned int v1)
+{
+	if (v0 > v1) {
+		std::swap (v0, v1);
+	}
+
+	return ((unsigned long long) v0 << 32) | v1;
+}
+
+std::vector<unsigned int> MeshSimplification::Simplify (const std::vector<glm::vec3>& positions,
+	const std::vector<unsigned int>& indices, std::size_t targetIndicesCount)
+{
+	std::vector<unsigned int> triangles = indices;
+
+	std::size_t trianglesCount = triangles.size () / 3;
+
+	std::vector<bool> removed (trianglesCount, false);
+	std::vector<Quadric> quadrics (positions.size ());
+	std::vector<std::vector<std::size_t>> vertexTriangles (positions.size ());
+
+	/*
+	 * Accumulate area weighted plane quadrics on vertices
+	*/
+
+	for (std::size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex ++) {
+		const unsigned int* triangle = &triangles [triangleIndex * 3];
+
+		const glm::vec3& p0 = positions [triangle [0]];
+		const glm::vec3& p1 = positions [triangle [1]];
+		const glm::vec3& p2 = positions [triangle [2]];
+
+		glm::vec3 normal = glm::cross (p1 - p0, p2 - p0);
+		float doubleArea = glm::length (normal);
+
+		if (doubleArea > 0.0f) {
+			normal /= doubleArea;
+
+			Quadric quadric (normal.x, normal.y, normal.z, -glm::dot (normal, p0), doubleArea * 0.5f);
+
+			for (std::size_t k = 0; k < 3; k++) {
+				quadrics [triangle [k]] += quadric;
+			}
+		}
+
+		for (std::size_t k = 0; k < 3; k++) {
+			vertexTriangles [triangle [k]].push_back (triangleIndex);
+		}
+	}
+
+	/*
+	 * Lock vertices on edges that are not shared by exactly two triangles
+	*/
+
+	std::unordered_map<unsigned long long, std::size_t> edgesCount;
+
+	for (std::size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex ++) {
+		const unsigned int* triangle = &triangles [triangleIndex * 3];
+
+		for (std::size_t k = 0; k < 3; k++) {
+			edgesCount [EdgeKey (triangle [k], triangle [(k + 1) % 3])] ++;
+		}
+	}
+
+	std::vector<bool> locked (positions.size (), false);
+
+	for (auto& edgeCount : edgesCount) {
+		if (edgeCount.second != 2) {
+			locked [edgeCount.first >> 32] = true;
+			locked [edgeCount.first & 0xFFFFFFFFull] = true;
+		}
+	}
+
+	/*
+	 * Queue every half edge collapse by its error
+	*/
+
+	std::vector<std::size_t> versions (positions.size (), 0);
+	std::vector<bool> collapsed (positions.size (), false);
+
+	std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+	auto pushCollapse = [&] (unsigned int from, unsigned int to) {
+		if (locked [from] == true) {
+			return;
+		}
+
+		Quadric quadric = quadrics [from];
+		quadric += quadrics [to];
+
+		collapses.push ({ quadric.Evaluate (positions [to]), from, to, versions [from], versions [to] });
+	};
+
+	for (auto& edgeCount : edgesCount) {
+		unsigned int v0 = (unsigned int) (edgeCount.first >> 32);
+		unsigned int v1 = (unsigned int) (edgeCount.first & 0xFFFFFFFFull);
+
+		pushCollapse (v0, v1);
+		pushCollapse (v1, v0);
+	}
+
+	/*
+	 * Collapse cheapest edges until target is reached
+	*/
+
+	std::size_t aliveTrianglesCount = trianglesCount;
+
+	while (aliveTrianglesCount * 3 > targetIndicesCount && !collapses.empty ()) {
+		Collapse collapse = collapses.top ();
+		collapses.pop ();
+
+		if (collapsed [collapse.from] || collapsed [collapse.to] ||
+			versions [collapse.from] != collapse.fromVersion ||
+			versions [collapse.to] != collapse.toVersion) {
+			continue;
+		}
+
+		/*
+		 * Reject collapses that flip any remaining triangle
+		*/
+
+		bool isConnected = false;
+		bool isValid = true;
+
+		for (std::size_t triangleIndex : vertexTriangles [collapse.from]) {
+			if (removed [triangleIndex]) {
+				continue;
+			}
+
+			const unsigned int* triangle = &triangles [triangleIndex * 3];
+
+			if (triangle [0] == collapse.to || triangle [1] == collapse.to || triangle [2] == collapse.to) {
+				isConnected = true;
+				continue;
+			}
+
+			glm::vec3 p [3], q [3];
+
+			for (std::size_t k = 0; k < 3; k++) {
+				p [k] = positions [triangle [k]];
+				q [k] = triangle [k] == collapse.from ? positions [collapse.to] : p [k];
+			}
+
+			glm::vec3 oldNormal = glm::cross (p [1] - p [0], p [2] - p [0]);
+			glm::vec3 newNormal = glm::cross (q [1] - q [0], q [2] - q [0]);
+
+			if (glm::dot (oldNormal, newNormal) <= 0.0f) {
+				isValid = false;
+				break;
+			}
+		}
+
+		if (isConnected == false || isValid == false) {
+			continue;
+		}
+
+		/*
+		 * Move triangles from collapsed vertex to its target
+		*/
+
+		for (std::size_t triangleIndex : vertexTriangles [collapse.from]) {
+			if (removed [triangleIndex]) {
+				continue;
+			}
+
+			unsigned int* triangle = &triangles [triangleIndex * 3];
+
+			if (triangle [0] == collapse.to || triangle [1] == collapse.to || triangle [2] == collapse.to) {
+				removed [triangleIndex] = true;
+				aliveTrianglesCount --;
+
+				continue;
+			}
+
+			for (std::size_t k = 0; k < 3; k++) {
+				if (triangle [k] == collapse.from) {
+					triangle [k] = collapse.to;
+				}
+			}
+
+			vertexTriangles [collapse.to].push_back (triangleIndex);
+		}
+
+		collapsed [collapse.from] = true;
+		quadrics [collapse.to] += quadrics [collapse.from];
+
+		versions [collapse.to] ++;
+
+		/*
+		 * Queue again edges around target vertex
+		*/
+
+		for (std::size_t triangleIndex : vertexTriangles [collapse.to]) {
+			if (removed [triangleIndex]) {
+				continue;
+			}
+
+			const unsigned int* triangle = &triangles [triangleIndex * 3];
+
+			for (std::size_t k = 0; k < 3; k++) {
+				if (triangle [k] != collapse.to) {
+					pushCollapse (collapse.to, triangle [k]);
+					pushCollapse (triangle [k], collapse.to);
+				}
+			}
+		}
+	}
+
+	/*
+	 * Gather remaining triangles
+	*/
+
+	std::vector<unsigned int> result;
+	result.reserve (aliveTrianglesCount * 3);
+
+	for (std::size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex ++) {
+		if (removed [triangleIndex]) {
+			continue;
+		}
+
+		result.insert (result.end (), triangles.begin () + triangleIndex * 3, triangles.begin () + triangleIndex * 3 + 3);
+	}
+
+	return result;
+}
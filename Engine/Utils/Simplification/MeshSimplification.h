@@ -0,0 +1,23 @@
+#ifndef MESHSIMPLIFICATION_H
+#define MESHSIMPLIFICATION_H
+
+#include <vector>
+#include <glm/vec3.hpp>
+
+/*
+ * Quadric error metric edge collapse simplification.
+ * Thanks to: Garland and Heckbert, Surface Simplification Using Quadric Error Metrics
+ *
+ * Vertices are only collapsed into their neighbours, so the result indexes
+ * the same vertex buffer. Vertices on open edges (mesh borders and attribute
+ * seams) are locked.
+*/
+
+class MeshSimplification
+{
+public:
+	static std::vector<unsigned int> Simplify (const std::vector<glm::vec3>& positions,
+		const std::vector<unsigned int>& indices, std::size_t targetIndicesCount);
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "TangentSpaceGeneration.h"
+
+#include <glm/glm.hpp>
+
+std::vector<glm::vec4> TangentSpaceGeneration::Generate (const std::vector<glm::vec3>& positions,
+	const std::vector<glm::vec3>& normals, const std::vector<glm::vec2>& texcoords,
+	const std::vector<unsigned int>& indices)
+{
+	std::vector<glm::vec3> tangents (positions.size (), glm::vec3 (0.0f));
+	std::vector<glm::vec3> bitangents (positions.size (), glm::vec3 (0.0f));
+
+	/*
+	 * Accumulate texture space directions of every triangle
+	*/
+
+	for (std::size_t index = 0; index + 2 < indices.size (); index += 3) {
+		unsigned int i0 = indices [index];
+		unsigned int i1 = indices [index + 1];
+		unsigned int i2 = indices [index + 2];
+
+		glm::vec3 deltaPos1 = positions [i1] - positions [i0];
+		glm::vec3 deltaPos2 = positions [i2] - positions [i0];
+
+		glm::vec2 deltaUV1 = texcoords [i1] - texcoords [i0];
+		glm::vec2 deltaUV2 = texcoords [i2] - texcoords [i0];
+
+		/*
+		 * Skip triangles with degenerated texture mapping
+		*/
+
+		float determinant = deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x;
+
+		if (glm::abs (determinant) < 1e-12f) {
+			continue;
+		}
+
+		float r = 1.0f / determinant;
+
+		glm::vec3 tangent = (deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y) * r;
+		glm::vec3 bitangent = (deltaPos2 * deltaUV1.x - deltaPos1 * deltaUV2.x) * r;
+
+		for (unsigned int vertexIndex : { i0, i1, i2 }) {
+			tangents [vertexIndex] += tangent;
+			bitangents [vertexIndex] += bitangent;
+		}
+	}
+
+	/*
+	 * Gram-Schmidt orthogonalize against the normal and keep handedness
+	*/
+
+	std::vector<glm::vec4> result (positions.size ());
+
+	for (std::size_t index = 0; index < positions.size (); index ++) {
+		const glm::vec3& normal = normals [index];
+
+		glm::vec3 tangent = tangents [index] - normal * glm::dot (normal, tangents [index]);
+
+		/*
+		 * Fall back to any direction perpendicular to the normal
+		*/
+
+		if (glm::dot (tangent, tangent) < 1e-12f) {
+			tangent = glm::abs (normal.x) < 0.9f ?
+				glm::cross (normal, glm::vec3 (1.0f, 0.0f, 0.0f)) :
+				glm::cross (normal, glm::vec3 (0.0f, 1.0f, 0.0f));
+
+			if (glm::dot (tangent, tangent) < 1e-12f) {
+				tangent = glm::vec3 (1.0f, 0.0f, 0.0f);
+			}
+		}
+
+		tangent = glm::normalize (tangent);
+
+		float handedness = glm::dot (glm::cross (normal, tangent), bitangents [index]) < 0.0f ? -1.0f : 1.0f;
+
+		result [index] = glm::vec4 (tangent, handedness);
+	}
+
+	return result;
+}
@@ -0,0 +1,25 @@
+#ifndef TANGENTSPACEGENERATION_H
+#define TANGENTSPACEGENERATION_H
+
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+/*
+ * Per vertex tangents over an indexed triangle list.
+ * Thanks to: Lengyel, Computing Tangent Space Basis Vectors for an Arbitrary Mesh
+ *
+ * Triangle tangents are accumulated on their vertices, then orthonormalized
+ * against the vertex normal. Handedness of the texture space is stored in w.
+*/
+
+class TangentSpaceGeneration
+{
+public:
+	static std::vector<glm::vec4> Generate (const std::vector<glm::vec3>& positions,
+		const std::vector<glm::vec3>& normals, const std::vector<glm::vec2>& texcoords,
+		const std::vector<unsigned int>& indices);
+};
+
+#endif
@@ -142,5 +142,5 @@ void ParticleSystem::Update ()
 		bufferIndex += particle->GetSize ();
 	}
 
-	RenderSystem::UpdateInstanceModelView (_modelView, _instanceBufferSize, _particles.size (), _instanceBuffer);
+	RenderSystem::UpdateInstanceModelView (_modelView, bufferIndex, _particles.size (), _instanceBuffer);
 }
@@ -195,6 +195,31 @@ void GL::BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const G
 	ErrorCheck ("glBufferSubData");
 }
 
+void GL::BufferStorage (GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags)
+{
+	glBufferStorage (target, size, data, flags);
+
+	ErrorCheck ("glBufferStorage");
+}
+
+void* GL::MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void* result = glMapBufferRange (target, offset, length, access);
+
+	ErrorCheck ("glMapBufferRange");
+
+	return result;
+}
+
+GLboolean GL::UnmapBuffer (GLenum target)
+{
+	GLboolean result = glUnmapBuffer (target);
+
+	ErrorCheck ("glUnmapBuffer");
+
+	return result;
+}
+
 /*
  * Vertex Attributes
 */
@@ -308,6 +333,13 @@ void GL::BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 	ErrorCheck ("glBindBufferBase");
 }
 
+void GL::BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	glBindBufferRange (target, index, buffer, offset, size);
+
+	ErrorCheck ("glBindBufferRange");
+}
+
 void GL::UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
 	glUniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
@@ -682,6 +714,35 @@ void GL::MemoryBarrier (GLbitfield barriers)
 	ErrorCheck ("glMemoryBarrier");
 }
 
+/*
+ * Synchronization
+*/
+
+GLsync GL::FenceSync (GLenum condition, GLbitfield flags)
+{
+	GLsync sync = glFenceSync (condition, flags);
+
+	ErrorCheck ("glFenceSync");
+
+	return sync;
+}
+
+GLenum GL::ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	GLenum result = glClientWaitSync (sync, flags, timeout);
+
+	ErrorCheck ("glClientWaitSync");
+
+	return result;
+}
+
+void GL::DeleteSync (GLsync sync)
+{
+	glDeleteSync (sync);
+
+	ErrorCheck ("glDeleteSync");
+}
+
 /*
  * Queries
 */
@@ -885,6 +946,31 @@ void GL::BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean l
 	ErrorCheck ("glBindImageTexture");
 }
 
+void GL::ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void * data)
+{
+	glClearTexImage (texture, level, format, type, data);
+
+	ErrorCheck ("glClearTexImage");
+}
+
+void GL::ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+	GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data)
+{
+	glClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+
+	ErrorCheck ("glClearTexSubImage");
+}
+
+void GL::CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ,
+	GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ,
+	GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	glCopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
+		dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+
+	ErrorCheck ("glCopyImageSubData");
+}
+
 /*
  * Shaders
 */
@@ -963,6 +1049,27 @@ void GL::LinkProgram(GLuint program)
 	ErrorCheck ("glLinkProgram");
 }
 
+void GL::GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei *length, GLchar *infoLog)
+{
+	glGetProgramInfoLog(program, maxLength, length, infoLog);
+
+	ErrorCheck ("glGetProgramInfoLog");
+}
+
+void GL::GetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	glGetProgramiv(program, pname, params);
+
+	ErrorCheck ("glGetProgramiv");
+}
+
+void GL::MaxShaderCompilerThreads(GLuint count)
+{
+	glMaxShaderCompilerThreadsARB (count);
+
+	ErrorCheck ("glMaxShaderCompilerThreadsARB");
+}
+
 void GL::AttachShader(GLuint program, GLuint shader)
 {
 	glAttachShader(program, shader);
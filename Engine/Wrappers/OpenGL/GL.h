@@ -73,6 +73,9 @@ public:
 	// Buffers
 	static void BufferData (GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage);
 	static void BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data);
+	static void BufferStorage (GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags);
+	static void* MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+	static GLboolean UnmapBuffer (GLenum target);
 
 	/*
 	 * Vertex Attributes
@@ -95,6 +98,7 @@ public:
 	static void BindVertexArray (GLuint array);
 	static void BindBuffer (GLenum target, GLuint buffer);
 	static void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+	static void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
 	static void UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
 
 	/*
@@ -160,6 +164,12 @@ public:
 	*/
 
 	static void BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+	static void ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void * data);
+	static void ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+		GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data);
+	static void CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ,
+		GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ,
+		GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth);
 
 	/*
 	 * Shaders
@@ -176,6 +186,9 @@ public:
 	static void DeleteProgram(GLuint program);
 	static void UseProgram (GLuint program);
 	static void LinkProgram(GLuint program);
+	static void GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei *length, GLchar *infoLog);
+	static void GetProgramiv(GLuint program, GLenum pname, GLint *params);
+	static void MaxShaderCompilerThreads(GLuint count);
 
 	static void AttachShader(GLuint program, GLuint shader);
 	static void DetachShader(GLuint program, GLuint shader);
@@ -228,6 +241,14 @@ public:
 
 	static void MemoryBarrier(GLbitfield barriers);
 
+	/*
+	 * Synchronization
+	*/
+
+	static GLsync FenceSync(GLenum condition, GLbitfield flags);
+	static GLenum ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+	static void DeleteSync(GLsync sync);
+
 	/*
 	 * Queries
 	*/
@@ -4,10 +4,20 @@
 
 #include "Arguments/ArgumentsAnalyzer.h"
 
+#include "Debug/SelfCheck/SelfCheck.h"
+
 int main(int argc, char **argv) 
 {
 	ArgumentsAnalyzer::Instance ()->ProcessArguments (argc, argv);
 
+	/*
+	 * Self check runs the CPU only checks without starting the engine
+	*/
+
+	if (ArgumentsAnalyzer::Instance ()->GetArgument ("selfcheck") != nullptr) {
+		return SelfCheck::Run () == true ? 0 : 1;
+	}
+
 	GameEngine::Init ();
 
 	Game::Instance ()->Start ();